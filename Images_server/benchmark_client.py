@@ -0,0 +1,76 @@
+from argparse import ArgumentParser
+import sys
+import time
+
+if sys.version_info >= (3, 0):
+    from http.client import HTTPConnection
+else:
+    from httplib import HTTPConnection
+
+ROUTE_IMAGE = "/image"
+ROUTE_IMAGES = "/images"
+
+IMAGE_SIZE = 28 * 28
+IMAGE_COUNT = 28000
+
+
+def get(host, port, path):
+    """Sends a GET request on a new connection, like the ESP32 client does"""
+
+    connection = HTTPConnection(host, port)
+    try:
+        connection.request("GET", path)
+        response = connection.getresponse()
+        body = response.read()
+        if response.status != 200:
+            raise RuntimeError("GET %s returned %d" % (path, response.status))
+        return body
+    finally:
+        connection.close()
+
+
+def bench_single(host, port, count):
+    """Fetches count PNG images, one per request"""
+
+    for image_id in range(count):
+        get(host, port, "%s?outputFormat=png&ImageID=%d" % (ROUTE_IMAGE, image_id))
+
+
+def bench_batched(host, port, count, batch_size):
+    """Fetches count raw images, batch_size per request"""
+
+    for start in range(0, count, batch_size):
+        batch = min(batch_size, count - start)
+        body = get(host, port, "%s?start=%d&count=%d" % (ROUTE_IMAGES, start, batch))
+        if len(body) != batch * IMAGE_SIZE:
+            raise RuntimeError("Batch %d truncated: %d bytes" % (start, len(body)))
+
+
+def report(name, count, elapsed):
+    print(u"%-24s %6d images in %7.2f s: %8.1f images/s" % (name, count, elapsed, count / elapsed))
+
+
+# Define and parse the command line arguments
+cli = ArgumentParser(description='Compares single and batched image downloads')
+cli.add_argument(
+    "-p", "--port", type=int, metavar="PORT", dest="port", default=8000)
+cli.add_argument(
+    "--host", type=str, metavar="HOST", dest="host", default="localhost")
+cli.add_argument(
+    "-n", "--count", type=int, metavar="COUNT", dest="count", default=1000)
+cli.add_argument(
+    "-b", "--batch", type=int, metavar="BATCH", dest="batch", nargs="+",
+    default=[4, 16, 64, 256])
+arguments = cli.parse_args()
+
+if __name__ == '__main__':
+    count = min(arguments.count, IMAGE_COUNT)
+
+    start = time.time()
+    bench_single(arguments.host, arguments.port, count)
+    report("single (png)", count, time.time() - start)
+
+    for batch_size in arguments.batch:
+        start = time.time()
+        bench_batched(arguments.host, arguments.port, count, batch_size)
+        report("batched (raw) x%d" % batch_size, count, time.time() - start)
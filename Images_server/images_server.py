@@ -6,6 +6,7 @@ from json import dumps as json_encode
 from json import load
 from json.decoder import JSONDecodeError
 from PIL import Image
+from threading import Lock
 import os
 import sys
 import pandas as pd
@@ -24,7 +25,12 @@ else:
 # response
 IMAGE_FORMATS = {"png": "image/png",
                  "jpeg": "image/jpeg",
-                 "webp": "image/webp"}
+                 "webp": "image/webp",
+                 "pgm": "image/x-portable-graymap",
+                 "raw": "application/octet-stream"}
+
+# PIL format names that differ from the output format used in the client
+PIL_FORMATS = {"pgm": "PPM"}
 
 ResponseStatus = namedtuple("HTTPStatus",
                             ["code", "message"])
@@ -38,18 +44,38 @@ HTTP_STATUS = {"OK": ResponseStatus(code = 200, message = "OK"),
                "INTERNAL_SERVER_ERROR" : ResponseStatus(code = 500, message = "Internal server error"),
                "NOT_IMPLEMENTED": ResponseStatus(code = 501, message = "Method not implemented")}
 
+# Fixed-layout little-endian record sent to ROUTE_RESULTS, one per image.
+# Must match RESULT_RECORD_SIZE in src/app_httpClient.c.
+TOP_K = 3
+RESULT_RECORD_DTYPE = np.dtype([("image_id", "<u4"),
+                                ("invoke_us", "<u4"),
+                                ("labels", "u1", (TOP_K,)),
+                                ("scores", "i1", (TOP_K,)),
+                                ("reserved", "u1", (2,))])
+
 ResponseData = namedtuple("ResponseData",
                           ["status", "content_type", "data_stream"])
 
 CHUNK_SIZE = 1024
+MAX_BATCH_SIZE = 256
+IMAGE_COUNT = 28000
 PROTOCOL = "http"
 ROUTE_INDEX = "/"
 ROUTE_IMAGE = "/image"
+ROUTE_IMAGES = "/images"
 ROUTE_RESULT = "/result"
+ROUTE_RESULTS = "/results"
 ROUTE_EXPORT = "/export"
+ROUTE_ACCURACY = "/accuracy"
+ROUTE_MODELS = "/models/"
+MODEL_EXTENSION = ".tflite"
 
 test_img_arr = np.ones((28000, 28, 28), dtype = np.uint8) # global variable
 predictions = np.ones((28000)) # global variable
+invoke_times = np.zeros((28000), dtype = np.uint32) # global variable
+test_labels = None # global variable, only known when serving a labelled csv
+connection_count = 0 # global variable
+connection_lock = Lock()
 
 class HTTPStatusError(Exception):
     """Exception wrapping a value from http.server.HTTPStatus"""
@@ -74,6 +100,19 @@ class ChunkedHTTPRequestHandler(BaseHTTPRequestHandler):
     """"HTTP 1.1 Chunked encoding request handler"""
     # Use HTTP 1.1 as 1.0 doesn't support chunked encoding
     protocol_version = "HTTP/1.1"
+    # Headers and body are written separately, on a kept-alive connection
+    # Nagle would hold the body back until the client's delayed ACK.
+    disable_nagle_algorithm = True
+
+    def setup(self):
+        """Counts the TCP connections, one handler is created per connection"""
+
+        global connection_count
+
+        BaseHTTPRequestHandler.setup(self)
+        with connection_lock:
+            connection_count += 1
+            print(u"[CONNECTION]: #%d from %s" % (connection_count, self.client_address[0]))
 
     def query_get(self, queryData, key, default=""):
         """Helper for getting values from a pre-parsed query string"""
@@ -96,6 +135,12 @@ class ChunkedHTTPRequestHandler(BaseHTTPRequestHandler):
                 response = self.route_index(path, query)
             elif path == ROUTE_IMAGE:
                 response = self.route_image(path, query)
+            elif path == ROUTE_IMAGES:
+                response = self.route_images(path, query)
+            elif path == ROUTE_ACCURACY:
+                response = self.route_accuracy(path, query)
+            elif path.startswith(ROUTE_MODELS):
+                response = self.route_models(path, query)
             else:
                 raise HTTPStatusError(HTTP_STATUS["NOT_FOUND"], "Resource not found")
 
@@ -161,11 +206,16 @@ class ChunkedHTTPRequestHandler(BaseHTTPRequestHandler):
                 img_array = np.array(np.reshape(test_img_arr[int(ImageID)], (28, 28)), 
                                     dtype = np.uint8)
                 
-                PIL_img = Image.fromarray(img_array, mode = "L")
+                if outputFormat == "raw":
+                    # Bare 28x28 uint8 pixels
+                    ImageStream = BytesIO(img_array.tobytes())
+                else:
+                    PIL_img = Image.fromarray(img_array, mode = "L")
 
-                ImageStream = BytesIO()
-                PIL_img.save(ImageStream, format = outputFormat)
-                ImageStream.seek(0)
+                    ImageStream = BytesIO()
+                    PIL_img.save(ImageStream,
+                                 format = PIL_FORMATS.get(outputFormat, outputFormat))
+                    ImageStream.seek(0)
 
             except SystemError as err:
                 # The service returned an error
@@ -178,6 +228,83 @@ class ChunkedHTTPRequestHandler(BaseHTTPRequestHandler):
                                     data_stream = ImageStream
                                     )
         
+    def route_images(self, path, query):
+        """Handles routing for reading a batch of raw images"""
+
+        global test_img_arr
+
+        # Get the parameters from the query string
+        try:
+            start = int(self.query_get(query, "start"))
+            count = int(self.query_get(query, "count"))
+        except ValueError:
+            raise HTTPStatusError(HTTP_STATUS["BAD_REQUEST"],
+                                  "Wrong parameters")
+
+        # Validate the parameters, set error flag in case of unexpected
+        # values
+        if (start < 0) or (count < 1) or (count > MAX_BATCH_SIZE) \
+             or (start + count > IMAGE_COUNT):
+            raise HTTPStatusError(HTTP_STATUS["BAD_REQUEST"],
+                                  "Wrong parameters")
+
+        print(u"[route_images]: Received GET for images %d to %d" \
+            % (start, start + count - 1))
+
+        # The images are sent back to back as 28x28 uint8 pixels, without
+        # any container format, so the client can copy them as they arrive
+        batch = np.ascontiguousarray(test_img_arr[start:start + count], dtype = np.uint8)
+
+        return ResponseData(status = HTTP_STATUS["OK"],
+                            content_type = "application/octet-stream",
+                            data_stream = BytesIO(batch.tobytes()))
+
+    def route_accuracy(self, path, query):
+        """Handles routing for the accuracy of the predictions received so far"""
+
+        global predictions
+        global test_labels
+
+        if test_labels is None:
+            raise HTTPStatusError(HTTP_STATUS["NOT_FOUND"],
+                                  "The served csv file has no labels")
+        try:
+            count = int(self.query_get(query, "count", IMAGE_COUNT))
+        except ValueError:
+            raise HTTPStatusError(HTTP_STATUS["BAD_REQUEST"],
+                                  "Wrong parameters")
+        if (count < 1) or (count > IMAGE_COUNT):
+            raise HTTPStatusError(HTTP_STATUS["BAD_REQUEST"],
+                                  "Wrong parameters")
+
+        # Only the first count images, a shorter run leaves the predictions
+        # of the following ones untouched
+        accuracy = float(np.mean(predictions[:count] == test_labels[:count]))
+        print(u"[route_accuracy]: accuracy over %d images: %.4f" % (count, accuracy))
+
+        body = json_encode({"images": count, "accuracy": accuracy})
+        return ResponseData(status = HTTP_STATUS["OK"],
+                            content_type = "application/json",
+                            data_stream = BytesIO(body.encode("utf-8")))
+
+    def route_models(self, path, query):
+        """Handles routing for downloading the .tflite models"""
+
+        # Only the file names listed in the models directory are served,
+        # nothing outside of it
+        name = path[len(ROUTE_MODELS):]
+        if not name.endswith(MODEL_EXTENSION) or name not in os.listdir(arguments.models):
+            raise HTTPStatusError(HTTP_STATUS["NOT_FOUND"],
+                                  "No model %s" % name)
+
+        print(u"[route_models]: Received GET for model %s" % name)
+        with open(os.path.join(arguments.models, name), "rb") as model_file:
+            data = model_file.read()
+
+        return ResponseData(status = HTTP_STATUS["OK"],
+                            content_type = "application/octet-stream",
+                            data_stream = BytesIO(data))
+
     def send_headers(self, status, content_type):
         """Send out the group of headers for a successful request"""
 
@@ -185,7 +312,6 @@ class ChunkedHTTPRequestHandler(BaseHTTPRequestHandler):
         self.send_response(status.code, status.message)
         self.send_header('Content-type', content_type)
         self.send_header('Transfer-Encoding', 'chunked')
-        self.send_header('Connection', 'close')
         self.end_headers()
 
     def stream_data(self, stream):
@@ -235,12 +361,17 @@ class ChunkedHTTPRequestHandler(BaseHTTPRequestHandler):
                 status = HTTP_STATUS["METHOD_NOT_ALLOWED"]
             elif path == ROUTE_RESULT:
                 status = self.route_result()
+            elif path == ROUTE_RESULTS:
+                status = self.route_results()
             elif path == ROUTE_EXPORT:
                 status = self.route_export()
             else:
                 raise HTTPStatusError(HTTP_STATUS["NOT_FOUND"], "Resource not found")
 
             self.send_response(int(status.code), str(status.message))
+            # The connection is kept alive, so the end of the (empty) body
+            # must be explicit
+            self.send_header('Content-Length', '0')
             self.end_headers()
 
         except HTTPStatusError as err:
@@ -278,11 +409,53 @@ class ChunkedHTTPRequestHandler(BaseHTTPRequestHandler):
         else:
             return HTTP_STATUS["No_Content"]
     
+    def route_results(self):
+        """Handles routing for saving a batch of binary results from inference"""
+
+        global predictions
+        global invoke_times
+
+        try:
+            length = int(self.headers['Content-Length'])
+        except (TypeError, ValueError):
+            # Missing or not a number
+            raise HTTPStatusError(HTTP_STATUS["BAD_REQUEST"],
+                                  "Invalid Content-Length")
+        if length < 0 or length % RESULT_RECORD_DTYPE.itemsize != 0:
+            raise HTTPStatusError(HTTP_STATUS["BAD_REQUEST"],
+                                  "Truncated result record")
+
+        body = self.rfile.read(length)
+        if len(body) != length:
+            raise HTTPStatusError(HTTP_STATUS["BAD_REQUEST"],
+                                  "Truncated result record")
+
+        records = np.frombuffer(body, dtype = RESULT_RECORD_DTYPE)
+        if records.size == 0:
+            return HTTP_STATUS["No_Content"]
+
+        image_ids = records["image_id"]
+        if image_ids.max() >= len(predictions):
+            raise HTTPStatusError(HTTP_STATUS["BAD_REQUEST"], "Wrong image ID")
+
+        print(u"[route_results]: Received POST with %d results" % records.size)
+        predictions[image_ids] = records["labels"][:, 0]
+        invoke_times[image_ids] = records["invoke_us"]
+
+        return HTTP_STATUS["No_Content"]
+
     def route_export(self):
         """Handles routing for saving all the inference results in a csv file"""
         
         global predictions
+        global invoke_times
         
+        timed = invoke_times[invoke_times > 0]
+        if timed.size > 0:
+            print(u"[route_export]: invoke time over %d images: mean %.0f us, "
+                  u"p50 %.0f us, p99 %.0f us" % (timed.size, timed.mean(),
+                  np.percentile(timed, 50), np.percentile(timed, 99)))
+
         try:
             df_pred = pd.DataFrame({'ImageId' : np.arange(1, 28001, 1),
                             'Label' : predictions})
@@ -296,11 +469,16 @@ class ChunkedHTTPRequestHandler(BaseHTTPRequestHandler):
             return HTTP_STATUS["No_Content"]
 
 
-def load_images():
+def load_images(csv_path):
     global test_img_arr
+    global test_labels
     try:
-        df_test = pd.read_csv("test.csv", sep=',')
-        test_img_arr = np.reshape(np.array(df_test), (28000, 28, 28))
+        df_test = pd.read_csv(csv_path, sep=',')
+        # The labelled train.csv can be served instead of test.csv to
+        # measure the accuracy, its first 28000 images are used
+        if "label" in df_test.columns:
+            test_labels = np.array(df_test.pop("label"))[:IMAGE_COUNT]
+        test_img_arr = np.reshape(np.array(df_test)[:IMAGE_COUNT], (IMAGE_COUNT, 28, 28))
 
     except pd.errors.EmptyDataError as err:
         print("Cannot open/read csv test file")
@@ -316,6 +494,13 @@ cli.add_argument(
     "-p", "--port", type=int, metavar="PORT", dest="port", default=8000)
 cli.add_argument(
     "--host", type=str, metavar="HOST", dest="host", default="localhost")
+cli.add_argument(
+    "--csv", type=str, metavar="CSV", dest="csv", default="test.csv",
+    help="Kaggle images to serve, train.csv also gives the accuracy")
+cli.add_argument(
+    "--models", type=str, metavar="DIR", dest="models",
+    default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "TF_models"),
+    help="Directory of the .tflite models served under /models/")
 arguments = cli.parse_args()
 
 # If the module is invoked directly, initialize the application
@@ -329,7 +514,7 @@ if __name__ == '__main__':
                                                             arguments.port,
                                                             ROUTE_INDEX))
 
-    load_images()
+    load_images(arguments.csv)
     
     try:
         # Listen for requests indefinitely
@@ -0,0 +1,537 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_CONV_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_CONV_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/simd.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Portable int8 convolution, as an im2col followed by a matrix product, with
+// the same results as reference_integer_ops::ConvPerChannel():
+//  - Each output row is unrolled into the patches of its pixels, one row of
+//    filter_height * filter_width * input_depth values each, padded with the
+//    input zero point, so that the product has no bounds check left.
+//  - The input offset is not added to every input value: its product with
+//    the sum of each filter is folded into the bias once, by
+//    FoldConvInputOffset(), and a padded value, the zero point, adds 0.
+//  - The product runs on blocks of kConvBlockPixels pixels by
+//    kConvBlockChannels output channels, which the compiler keeps in
+//    registers, so that each value loaded is used by several accumulators.
+//  - With the vectors of simd.h, the products over a patch run
+//    kSimdDotDepth values at a time, and the output stage kSimdLanes
+//    channels at a time when a block spans that many.
+
+constexpr int kConvBlockPixels = 4;
+constexpr int kConvBlockChannels = 2;
+
+// Returns whether the rows of the input are already their patches: 1x1
+// filters without stride nor padding, that need no im2col buffer.
+inline bool ConvInputIsIm2col(const ConvParams& params,
+                              const RuntimeShape& filter_shape) {
+  return filter_shape.Dims(1) == 1 && filter_shape.Dims(2) == 1 &&
+         params.stride_width == 1 && params.stride_height == 1 &&
+         params.padding_values.width == 0 &&
+         params.padding_values.height == 0;
+}
+
+// Bytes of the im2col buffer ConvPerChannel() needs, the patches of one
+// output row.
+inline int ConvIm2colBufferSize(const ConvParams& params,
+                                const RuntimeShape& filter_shape,
+                                const RuntimeShape& output_shape) {
+  if (ConvInputIsIm2col(params, filter_shape)) {
+    return 0;
+  }
+  return output_shape.Dims(2) * filter_shape.Dims(1) * filter_shape.Dims(2) *
+         filter_shape.Dims(3);
+}
+
+// folded_bias[c] = bias[c] + input_offset * sum(filter[c]), the part of
+// each output of channel c that does not depend on the input. bias_data may
+// be null.
+inline void FoldConvInputOffset(int32_t input_offset,
+                                const RuntimeShape& filter_shape,
+                                const int8_t* filter_data,
+                                const int32_t* bias_data,
+                                int32_t* folded_bias) {
+  const int output_depth = filter_shape.Dims(0);
+  const int patch_size = filter_shape.FlatSize() / output_depth;
+  for (int c = 0; c < output_depth; ++c) {
+    int32_t filter_sum = 0;
+    for (int k = 0; k < patch_size; ++k) {
+      filter_sum += filter_data[c * patch_size + k];
+    }
+    folded_bias[c] =
+        (bias_data != nullptr ? bias_data[c] : 0) + input_offset * filter_sum;
+  }
+}
+
+// Unrolls the patches of output row out_y of batch into im2col_data.
+inline void Im2colRow(const ConvParams& params,
+                      const RuntimeShape& input_shape, const int8_t* input_data,
+                      const RuntimeShape& filter_shape, int output_width,
+                      int batch, int out_y, int8_t* im2col_data) {
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int dilation_width = params.dilation_width_factor;
+  const int dilation_height = params.dilation_height_factor;
+  const int8_t zero = static_cast<int8_t>(-params.input_offset);
+  const int row_size = input_width * input_depth;
+  const int patch_row_size = filter_width * input_depth;
+  const int8_t* batch_data =
+      input_data + batch * input_height * row_size;
+
+  const int in_y_origin = out_y * params.stride_height -
+                          params.padding_values.height;
+  int8_t* patch = im2col_data;
+  for (int out_x = 0; out_x < output_width; ++out_x) {
+    const int in_x_origin =
+        out_x * params.stride_width - params.padding_values.width;
+    const bool row_inside =
+        in_x_origin >= 0 &&
+        in_x_origin + (filter_width - 1) * dilation_width < input_width;
+    for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+      const int in_y = in_y_origin + filter_y * dilation_height;
+      if (in_y < 0 || in_y >= input_height) {
+        std::memset(patch, zero, patch_row_size);
+      } else if (row_inside && dilation_width == 1) {
+        std::memcpy(patch, batch_data + in_y * row_size +
+                               in_x_origin * input_depth,
+                    patch_row_size);
+      } else {
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+          const int in_x = in_x_origin + filter_x * dilation_width;
+          int8_t* value = patch + filter_x * input_depth;
+          if (in_x < 0 || in_x >= input_width) {
+            std::memset(value, zero, input_depth);
+          } else {
+            std::memcpy(value,
+                        batch_data + in_y * row_size + in_x * input_depth,
+                        input_depth);
+          }
+        }
+      }
+      patch += patch_row_size;
+    }
+  }
+}
+
+// Requantizes the accumulators of kPixels pixels by kChannels channels
+// into the output.
+template <int kPixels, int kChannels>
+inline void ConvOutputBlock(const int32_t (&acc)[kPixels][kChannels],
+                            const int32_t* folded_bias,
+                            const int32_t* output_multiplier,
+                            const int32_t* output_shift, int32_t output_offset,
+                            int32_t output_activation_min,
+                            int32_t output_activation_max, int output_depth,
+                            int8_t* output_data) {
+  int c = 0;
+  if (kSimdLanes > 1) {
+    for (; c + kSimdLanes <= kChannels; c += kSimdLanes) {
+      const SimdInt32 bias = SimdLoad(folded_bias + c);
+      const SimdInt32 multiplier = SimdLoad(output_multiplier + c);
+      const SimdInt32 shift = SimdLoad(output_shift + c);
+      for (int p = 0; p < kPixels; ++p) {
+        SimdStoreInt8(output_data + p * output_depth + c,
+                      SimdRequantizeLanes(SimdAdd(SimdLoad(&acc[p][c]), bias),
+                                          multiplier, shift, output_offset,
+                                          output_activation_min,
+                                          output_activation_max));
+      }
+    }
+  }
+  for (; c < kChannels; ++c) {
+    for (int p = 0; p < kPixels; ++p) {
+      int32_t value = MultiplyByQuantizedMultiplier(
+          acc[p][c] + folded_bias[c], output_multiplier[c], output_shift[c]);
+      value += output_offset;
+      value = std::max(value, output_activation_min);
+      value = std::min(value, output_activation_max);
+      output_data[p * output_depth + c] = static_cast<int8_t>(value);
+    }
+  }
+}
+
+// Outputs kPixels pixels by kChannels channels, from the patches of the
+// pixels and the filters of the channels, patch_size values each.
+template <int kPixels, int kChannels>
+inline void ConvBlock(const int8_t* patches, const int8_t* filters,
+                      int patch_size, const int32_t* folded_bias,
+                      const int32_t* output_multiplier,
+                      const int32_t* output_shift, int32_t output_offset,
+                      int32_t output_activation_min,
+                      int32_t output_activation_max, int output_depth,
+                      int8_t* output_data) {
+  int32_t acc[kPixels][kChannels] = {};
+  int k = 0;
+  if (kSimdLanes > 1) {
+    SimdInt32 dot[kPixels][kChannels];
+    for (int p = 0; p < kPixels; ++p) {
+      for (int c = 0; c < kChannels; ++c) {
+        dot[p][c] = SimdDup(0);
+      }
+    }
+    for (; k + kSimdDotDepth <= patch_size; k += kSimdDotDepth) {
+      for (int c = 0; c < kChannels; ++c) {
+        for (int p = 0; p < kPixels; ++p) {
+          dot[p][c] = SimdDotInt8(dot[p][c], patches + p * patch_size + k,
+                                  filters + c * patch_size + k);
+        }
+      }
+    }
+    for (int p = 0; p < kPixels; ++p) {
+      for (int c = 0; c < kChannels; ++c) {
+        acc[p][c] = SimdReduceAdd(dot[p][c]);
+      }
+    }
+  }
+  for (; k < patch_size; ++k) {
+    int32_t input_val[kPixels];
+    for (int p = 0; p < kPixels; ++p) {
+      input_val[p] = patches[p * patch_size + k];
+    }
+    for (int c = 0; c < kChannels; ++c) {
+      const int32_t filter_val = filters[c * patch_size + k];
+      for (int p = 0; p < kPixels; ++p) {
+        acc[p][c] += filter_val * input_val[p];
+      }
+    }
+  }
+  ConvOutputBlock<kPixels, kChannels>(
+      acc, folded_bias, output_multiplier, output_shift, output_offset,
+      output_activation_min, output_activation_max, output_depth,
+      output_data);
+}
+
+// Outputs every channel of kPixels pixels.
+template <int kPixels>
+inline void ConvPixels(const int8_t* patches, const int8_t* filter_data,
+                       int patch_size, const int32_t* folded_bias,
+                       const int32_t* output_multiplier,
+                       const int32_t* output_shift, int32_t output_offset,
+                       int32_t output_activation_min,
+                       int32_t output_activation_max, int output_depth,
+                       int8_t* output_data) {
+  int c = 0;
+  for (; c + kConvBlockChannels <= output_depth; c += kConvBlockChannels) {
+    ConvBlock<kPixels, kConvBlockChannels>(
+        patches, filter_data + c * patch_size, patch_size, folded_bias + c,
+        output_multiplier + c, output_shift + c, output_offset,
+        output_activation_min, output_activation_max, output_depth,
+        output_data + c);
+  }
+  for (; c < output_depth; ++c) {
+    ConvBlock<kPixels, 1>(patches, filter_data + c * patch_size, patch_size,
+                          folded_bias + c, output_multiplier + c,
+                          output_shift + c, output_offset,
+                          output_activation_min, output_activation_max,
+                          output_depth, output_data + c);
+  }
+}
+
+// Fixed-point per-channel-quantization convolution. folded_bias comes from
+// FoldConvInputOffset(), im2col_data holds ConvIm2colBufferSize() bytes.
+inline void ConvPerChannel(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const int32_t* folded_bias,
+    const RuntimeShape& input_shape, const int8_t* input_data,
+    const RuntimeShape& filter_shape, const int8_t* filter_data,
+    const RuntimeShape& output_shape, int8_t* output_data,
+    int8_t* im2col_data) {
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  TFLITE_DCHECK_LE(output_activation_min, output_activation_max);
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int patch_size = filter_shape.Dims(1) * filter_shape.Dims(2) *
+                         input_depth;
+  const bool input_is_im2col = ConvInputIsIm2col(params, filter_shape);
+
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int8_t* patches;
+      if (input_is_im2col) {
+        patches = input_data + Offset(input_shape, batch, out_y, 0, 0);
+      } else {
+        Im2colRow(params, input_shape, input_data, filter_shape,
+                  output_width, batch, out_y, im2col_data);
+        patches = im2col_data;
+      }
+      int8_t* output_row =
+          output_data + Offset(output_shape, batch, out_y, 0, 0);
+
+      int out_x = 0;
+      for (; out_x + kConvBlockPixels <= output_width;
+           out_x += kConvBlockPixels) {
+        ConvPixels<kConvBlockPixels>(
+            patches + out_x * patch_size, filter_data, patch_size,
+            folded_bias, output_multiplier, output_shift, output_offset,
+            output_activation_min, output_activation_max, output_depth,
+            output_row + out_x * output_depth);
+      }
+      for (; out_x < output_width; ++out_x) {
+        ConvPixels<1>(patches + out_x * patch_size, filter_data, patch_size,
+                      folded_bias, output_multiplier, output_shift,
+                      output_offset, output_activation_min,
+                      output_activation_max, output_depth,
+                      output_row + out_x * output_depth);
+      }
+    }
+  }
+}
+
+// The first layers of image models have few input channels and small
+// filters, for which the patches are only a few values: the kernels below
+// have the filter size, the input depth and the stride as constants, so
+// that the product over a patch is fully unrolled, and read the patches
+// straight from the input. Only the pixels whose patch crosses the padding
+// have it copied first. With the patch in registers, the blocks are
+// narrower and span more channels than the im2col ones, at least a vector
+// of them for their output stage.
+
+constexpr int kFixedConvBlockPixels = 2;
+constexpr int kFixedConvBlockChannels = kSimdLanes > 4 ? kSimdLanes : 4;
+
+// Outputs kPixels pixels by kChannels channels, the patch of the first
+// pixel starting at input, rows of the input input_row_size bytes apart.
+template <int kFilterHeight, int kFilterWidth, int kInputDepth, int kStride,
+          int kPixels, int kChannels>
+inline void FixedConvBlock(const int8_t* input, int input_row_size,
+                           const int8_t* filters, const int32_t* folded_bias,
+                           const int32_t* output_multiplier,
+                           const int32_t* output_shift, int32_t output_offset,
+                           int32_t output_activation_min,
+                           int32_t output_activation_max, int output_depth,
+                           int8_t* output_data) {
+  constexpr int kPatchSize = kFilterHeight * kFilterWidth * kInputDepth;
+  int32_t acc[kPixels][kChannels] = {};
+  for (int filter_y = 0; filter_y < kFilterHeight; ++filter_y) {
+    const int8_t* input_row = input + filter_y * input_row_size;
+    for (int i = 0; i < kFilterWidth * kInputDepth; ++i) {
+      const int k = filter_y * kFilterWidth * kInputDepth + i;
+      int32_t input_val[kPixels];
+      for (int p = 0; p < kPixels; ++p) {
+        input_val[p] = input_row[p * kStride * kInputDepth + i];
+      }
+      for (int c = 0; c < kChannels; ++c) {
+        const int32_t filter_val = filters[c * kPatchSize + k];
+        for (int p = 0; p < kPixels; ++p) {
+          acc[p][c] += filter_val * input_val[p];
+        }
+      }
+    }
+  }
+  ConvOutputBlock<kPixels, kChannels>(
+      acc, folded_bias, output_multiplier, output_shift, output_offset,
+      output_activation_min, output_activation_max, output_depth,
+      output_data);
+}
+
+// Outputs every channel of kPixels pixels.
+template <int kFilterHeight, int kFilterWidth, int kInputDepth, int kStride,
+          int kPixels>
+inline void FixedConvPixels(const int8_t* input, int input_row_size,
+                            const int8_t* filter_data,
+                            const int32_t* folded_bias,
+                            const int32_t* output_multiplier,
+                            const int32_t* output_shift, int32_t output_offset,
+                            int32_t output_activation_min,
+                            int32_t output_activation_max, int output_depth,
+                            int8_t* output_data) {
+  constexpr int kPatchSize = kFilterHeight * kFilterWidth * kInputDepth;
+  int c = 0;
+  for (; c + kFixedConvBlockChannels <= output_depth;
+       c += kFixedConvBlockChannels) {
+    FixedConvBlock<kFilterHeight, kFilterWidth, kInputDepth, kStride, kPixels,
+                   kFixedConvBlockChannels>(
+        input, input_row_size, filter_data + c * kPatchSize, folded_bias + c,
+        output_multiplier + c, output_shift + c, output_offset,
+        output_activation_min, output_activation_max, output_depth,
+        output_data + c);
+  }
+  for (; c < output_depth; ++c) {
+    FixedConvBlock<kFilterHeight, kFilterWidth, kInputDepth, kStride, kPixels,
+                   1>(input, input_row_size, filter_data + c * kPatchSize,
+                      folded_bias + c, output_multiplier + c,
+                      output_shift + c, output_offset, output_activation_min,
+                      output_activation_max, output_depth, output_data + c);
+  }
+}
+
+// ConvPerChannel() for kFilterHeight x kFilterWidth filters over
+// kInputDepth channels, with a stride of kStride along both axes and no
+// dilation. Needs no im2col buffer.
+template <int kFilterHeight, int kFilterWidth, int kInputDepth, int kStride>
+inline void FixedConvPerChannel(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const int32_t* folded_bias,
+    const RuntimeShape& input_shape, const int8_t* input_data,
+    const RuntimeShape& filter_shape, const int8_t* filter_data,
+    const RuntimeShape& output_shape, int8_t* output_data,
+    int8_t* im2col_data) {
+  // Only there to be a ConvPerChannelKernel.
+  (void)im2col_data;
+  constexpr int kPatchRowSize = kFilterWidth * kInputDepth;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  TFLITE_DCHECK_LE(output_activation_min, output_activation_max);
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.Dims(1), kFilterHeight);
+  TFLITE_DCHECK_EQ(filter_shape.Dims(2), kFilterWidth);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  TFLITE_DCHECK_EQ(input_shape.Dims(3), kInputDepth);
+  TFLITE_DCHECK_EQ(filter_shape.Dims(3), kInputDepth);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int row_size = input_width * kInputDepth;
+  const int8_t zero = static_cast<int8_t>(-params.input_offset);
+
+  for (int batch = 0; batch < batches; ++batch) {
+    const int8_t* batch_data = input_data + batch * input_height * row_size;
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin =
+          out_y * kStride - params.padding_values.height;
+      const bool rows_inside =
+          in_y_origin >= 0 && in_y_origin + kFilterHeight <= input_height;
+      const int8_t* input_row = batch_data + in_y_origin * row_size;
+      int8_t* output_row =
+          output_data + Offset(output_shape, batch, out_y, 0, 0);
+
+      int out_x = 0;
+      while (out_x < output_width) {
+        const int in_x_origin = out_x * kStride - params.padding_values.width;
+        int8_t* output_pixel = output_row + out_x * output_depth;
+        if (rows_inside && in_x_origin >= 0 &&
+            out_x + kFixedConvBlockPixels <= output_width &&
+            in_x_origin + (kFixedConvBlockPixels - 1) * kStride +
+                    kFilterWidth <=
+                input_width) {
+          FixedConvPixels<kFilterHeight, kFilterWidth, kInputDepth, kStride,
+                          kFixedConvBlockPixels>(
+              input_row + in_x_origin * kInputDepth, row_size, filter_data,
+              folded_bias, output_multiplier, output_shift, output_offset,
+              output_activation_min, output_activation_max, output_depth,
+              output_pixel);
+          out_x += kFixedConvBlockPixels;
+          continue;
+        }
+        if (rows_inside && in_x_origin >= 0 &&
+            in_x_origin + kFilterWidth <= input_width) {
+          FixedConvPixels<kFilterHeight, kFilterWidth, kInputDepth, kStride,
+                          1>(input_row + in_x_origin * kInputDepth, row_size,
+                             filter_data, folded_bias, output_multiplier,
+                             output_shift, output_offset,
+                             output_activation_min, output_activation_max,
+                             output_depth, output_pixel);
+        } else {
+          // The patch crosses the padding, which is the zero point.
+          int8_t patch[kFilterHeight * kPatchRowSize];
+          for (int filter_y = 0; filter_y < kFilterHeight; ++filter_y) {
+            const int in_y = in_y_origin + filter_y;
+            for (int filter_x = 0; filter_x < kFilterWidth; ++filter_x) {
+              const int in_x = in_x_origin + filter_x;
+              int8_t* value =
+                  patch + filter_y * kPatchRowSize + filter_x * kInputDepth;
+              if (in_y < 0 || in_y >= input_height || in_x < 0 ||
+                  in_x >= input_width) {
+                std::memset(value, zero, kInputDepth);
+              } else {
+                std::memcpy(value,
+                            batch_data + in_y * row_size + in_x * kInputDepth,
+                            kInputDepth);
+              }
+            }
+          }
+          FixedConvPixels<kFilterHeight, kFilterWidth, kInputDepth, kStride,
+                          1>(patch, kPatchRowSize, filter_data, folded_bias,
+                             output_multiplier, output_shift, output_offset,
+                             output_activation_min, output_activation_max,
+                             output_depth, output_pixel);
+        }
+        ++out_x;
+      }
+    }
+  }
+}
+
+// A ConvPerChannel() kernel, the generic one or a FixedConvPerChannel().
+typedef void (*ConvPerChannelKernel)(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const int32_t* folded_bias,
+    const RuntimeShape& input_shape, const int8_t* input_data,
+    const RuntimeShape& filter_shape, const int8_t* filter_data,
+    const RuntimeShape& output_shape, int8_t* output_data,
+    int8_t* im2col_data);
+
+// Returns the fixed-shape kernel for the filter and stride of a
+// convolution, the input depth being the filter's, or nullptr if there is
+// none: 3x3 and 5x5 filters over 1 or 3 channels, with a stride of 1 or 2.
+inline ConvPerChannelKernel SelectFixedConvPerChannel(
+    const ConvParams& params, const RuntimeShape& filter_shape) {
+  if (params.dilation_width_factor != 1 ||
+      params.dilation_height_factor != 1 ||
+      params.stride_width != params.stride_height ||
+      filter_shape.Dims(1) != filter_shape.Dims(2)) {
+    return nullptr;
+  }
+  const int filter_size = filter_shape.Dims(1);
+  const int input_depth = filter_shape.Dims(3);
+  const int stride = params.stride_width;
+#define TF_LITE_FIXED_CONV(size, depth, stride_value)                    \
+  if (filter_size == size && input_depth == depth &&                     \
+      stride == stride_value) {                                          \
+    return FixedConvPerChannel<size, size, depth, stride_value>;         \
+  }
+  TF_LITE_FIXED_CONV(3, 1, 1)
+  TF_LITE_FIXED_CONV(3, 1, 2)
+  TF_LITE_FIXED_CONV(3, 3, 1)
+  TF_LITE_FIXED_CONV(3, 3, 2)
+  TF_LITE_FIXED_CONV(5, 1, 1)
+  TF_LITE_FIXED_CONV(5, 1, 2)
+  TF_LITE_FIXED_CONV(5, 3, 1)
+  TF_LITE_FIXED_CONV(5, 3, 2)
+#undef TF_LITE_FIXED_CONV
+  return nullptr;
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_CONV_H_
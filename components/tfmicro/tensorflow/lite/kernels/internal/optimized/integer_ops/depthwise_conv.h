@@ -0,0 +1,139 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/simd.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Int8 depthwise convolution with a depth multiplier of 1, with the same
+// results as reference_integer_ops::DepthwiseConvPerChannel(). The channels
+// are the innermost dimension of the input, the filter and the output, and
+// each output channel only reads its input channel: an output pixel is
+// computed kSimdLanes channels at a time, each tap of the filter being a
+// vector of input values and one of weights.
+
+// Returns whether DepthwiseConvPerChannel() runs the convolution, which
+// otherwise needs the reference kernel.
+inline bool DepthwiseConvIsVectorized(const DepthwiseParams& params) {
+  return params.depth_multiplier == 1;
+}
+
+// Outputs count channels of a pixel from channel on, the window of the
+// pixel starting at in_y_origin, in_x_origin in the input.
+template <bool kPartial>
+inline void DepthwiseConvChannels(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const int32_t* bias_data, int batch,
+    int in_y_origin, int in_x_origin, int channel, int count,
+    int8_t* output_data) {
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const SimdInt32 input_offset = SimdDup(params.input_offset);
+
+  SimdInt32 acc = bias_data != nullptr
+                      ? SimdLoadLanes<kPartial>(bias_data + channel, count)
+                      : SimdDup(0);
+  for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+    const int in_y = in_y_origin + params.dilation_height_factor * filter_y;
+    if (in_y < 0 || in_y >= input_height) {
+      continue;
+    }
+    for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+      const int in_x = in_x_origin + params.dilation_width_factor * filter_x;
+      if (in_x < 0 || in_x >= input_width) {
+        continue;
+      }
+      const SimdInt32 input_val = SimdLoadInt8Lanes<kPartial>(
+          input_data + Offset(input_shape, batch, in_y, in_x, channel),
+          count);
+      const SimdInt32 filter_val = SimdLoadInt8Lanes<kPartial>(
+          filter_data + Offset(filter_shape, 0, filter_y, filter_x, channel),
+          count);
+      acc = SimdAdd(acc, SimdMul(filter_val, SimdAdd(input_val, input_offset)));
+    }
+  }
+  SimdStoreInt8Lanes<kPartial>(
+      output_data + channel,
+      SimdRequantizeLanes(
+          acc, SimdLoadLanes<kPartial>(output_multiplier + channel, count),
+          SimdLoadLanes<kPartial>(output_shift + channel, count),
+          params.output_offset, params.quantized_activation_min,
+          params.quantized_activation_max),
+      count);
+}
+
+// Fixed-point per-channel-quantization depthwise convolution, for the
+// params DepthwiseConvIsVectorized() accepts. bias_data may be null.
+inline void DepthwiseConvPerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const int32_t* bias_data,
+    const RuntimeShape& output_shape, int8_t* output_data) {
+  TFLITE_DCHECK(DepthwiseConvIsVectorized(params));
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  TFLITE_DCHECK_EQ(filter_shape.Dims(3), depth);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin =
+          out_y * params.stride_height - params.padding_values.height;
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin =
+            out_x * params.stride_width - params.padding_values.width;
+        int8_t* output_pixel =
+            output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        int channel = 0;
+        for (; channel + kSimdLanes <= depth; channel += kSimdLanes) {
+          DepthwiseConvChannels<false>(
+              params, output_multiplier, output_shift, input_shape,
+              input_data, filter_shape, filter_data, bias_data, batch,
+              in_y_origin, in_x_origin, channel, kSimdLanes, output_pixel);
+        }
+        if (channel < depth) {
+          DepthwiseConvChannels<true>(
+              params, output_multiplier, output_shift, input_shape,
+              input_data, filter_shape, filter_data, bias_data, batch,
+              in_y_origin, in_x_origin, channel, depth - channel,
+              output_pixel);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H_
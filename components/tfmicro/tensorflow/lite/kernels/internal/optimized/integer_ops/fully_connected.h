@@ -0,0 +1,183 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_FULLY_CONNECTED_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_FULLY_CONNECTED_H_
+
+#include <algorithm>
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/simd.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Portable int8 fully connected layer, with the same results as
+// reference_integer_ops::FullyConnected():
+//  - The outputs are computed in blocks of kFullyConnectedBlockRows rows of
+//    weights, the rows left over in blocks of half as many, down to one: a
+//    pass over the input computes the outputs of a whole block, which the
+//    compiler keeps in registers, so that each input value loaded is used
+//    by every row of the block instead of being loaded again for each.
+//  - The input offset is not added to every input value: its product with
+//    the sum of each row of weights is folded into the bias once, by
+//    FoldFullyConnectedInputOffset(). The weights must be symmetric, of
+//    offset 0, the others are left to the reference kernel.
+//  - The weights are read in place, each once per batch, one sequential
+//    stream per row of the block. Interleaving the rows of each block into
+//    a packed copy would make a single stream of them, but would take a
+//    second copy of the whole matrix in the arena of every interpreter, for
+//    no measured gain.
+//  - With the vectors of simd.h, the products over a row run kSimdDotDepth
+//    values at a time.
+
+constexpr int kFullyConnectedBlockRows = 4;
+
+// folded_bias[c] = bias[c] + input_offset * sum(filter[c]), the part of
+// output c that does not depend on the input. bias_data may be null.
+inline void FoldFullyConnectedInputOffset(int32_t input_offset,
+                                          const RuntimeShape& filter_shape,
+                                          const int8_t* filter_data,
+                                          const int32_t* bias_data,
+                                          int32_t* folded_bias) {
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int output_depth = filter_shape.Dims(filter_dim_count - 2);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+  for (int out_c = 0; out_c < output_depth; ++out_c) {
+    int32_t filter_sum = 0;
+    for (int d = 0; d < accum_depth; ++d) {
+      filter_sum += filter_data[out_c * accum_depth + d];
+    }
+    folded_bias[out_c] = (bias_data != nullptr ? bias_data[out_c] : 0) +
+                         input_offset * filter_sum;
+  }
+}
+
+// acc[r] += weights[r * accum_depth] * input_val for the kRows rows of a
+// block, unrolled so that the accumulators stay in registers.
+template <int kRows>
+inline void AccumulateRows(const int8_t* weights, int accum_depth,
+                           int32_t input_val, int32_t* acc) {
+  AccumulateRows<kRows - 1>(weights, accum_depth, input_val, acc);
+  acc[kRows - 1] += weights[(kRows - 1) * accum_depth] * input_val;
+}
+
+template <>
+inline void AccumulateRows<0>(const int8_t* weights, int accum_depth,
+                              int32_t input_val, int32_t* acc) {}
+
+// Outputs the kRows rows of weights from filter_data on for every batch.
+template <int kRows>
+inline void FullyConnectedBlock(const FullyConnectedParams& params,
+                                const int8_t* input_data,
+                                const int8_t* filter_data,
+                                const int32_t* folded_bias, int batches,
+                                int accum_depth, int output_depth,
+                                int8_t* output_data) {
+  for (int b = 0; b < batches; ++b) {
+    const int8_t* input = input_data + b * accum_depth;
+    int32_t acc[kRows] = {};
+    int d = 0;
+    if (kSimdLanes > 1) {
+      SimdInt32 dot[kRows];
+      for (int r = 0; r < kRows; ++r) {
+        dot[r] = SimdDup(0);
+      }
+      for (; d + kSimdDotDepth <= accum_depth; d += kSimdDotDepth) {
+        for (int r = 0; r < kRows; ++r) {
+          dot[r] = SimdDotInt8(dot[r], input + d,
+                               filter_data + r * accum_depth + d);
+        }
+      }
+      for (int r = 0; r < kRows; ++r) {
+        acc[r] = SimdReduceAdd(dot[r]);
+      }
+    }
+    for (; d < accum_depth; ++d) {
+      const int32_t input_val = input[d];
+      AccumulateRows<kRows>(filter_data + d, accum_depth, input_val, acc);
+    }
+    for (int r = 0; r < kRows; ++r) {
+      int32_t value = MultiplyByQuantizedMultiplier(
+          acc[r] + folded_bias[r], params.output_multiplier,
+          params.output_shift);
+      value += params.output_offset;
+      value = std::max(value, params.quantized_activation_min);
+      value = std::min(value, params.quantized_activation_max);
+      output_data[b * output_depth + r] = static_cast<int8_t>(value);
+    }
+  }
+}
+
+// Outputs the blocks of kRows rows from *out_c on, then the ones of half as
+// many rows, down to one, leaving *out_c at output_depth.
+template <int kRows>
+inline void FullyConnectedBlocks(const FullyConnectedParams& params,
+                                 const int8_t* input_data,
+                                 const int8_t* filter_data,
+                                 const int32_t* folded_bias, int batches,
+                                 int accum_depth, int output_depth,
+                                 int8_t* output_data, int* out_c) {
+  for (; *out_c + kRows <= output_depth; *out_c += kRows) {
+    FullyConnectedBlock<kRows>(params, input_data,
+                               filter_data + *out_c * accum_depth,
+                               folded_bias + *out_c, batches, accum_depth,
+                               output_depth, output_data + *out_c);
+  }
+  FullyConnectedBlocks<kRows / 2>(params, input_data, filter_data,
+                                  folded_bias, batches, accum_depth,
+                                  output_depth, output_data, out_c);
+}
+
+template <>
+inline void FullyConnectedBlocks<0>(const FullyConnectedParams& params,
+                                    const int8_t* input_data,
+                                    const int8_t* filter_data,
+                                    const int32_t* folded_bias, int batches,
+                                    int accum_depth, int output_depth,
+                                    int8_t* output_data, int* out_c) {}
+
+// Fixed-point fully connected layer, folded_bias from
+// FoldFullyConnectedInputOffset().
+inline void FullyConnected(const FullyConnectedParams& params,
+                           const RuntimeShape& input_shape,
+                           const int8_t* input_data,
+                           const RuntimeShape& filter_shape,
+                           const int8_t* filter_data,
+                           const int32_t* folded_bias,
+                           const RuntimeShape& output_shape,
+                           int8_t* output_data) {
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  TFLITE_DCHECK_EQ(params.weights_offset, 0);
+  TFLITE_DCHECK_GE(filter_shape.DimensionsCount(), 2);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 2);
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = output_shape.Dims(0);
+  const int output_depth = output_shape.Dims(1);
+  TFLITE_DCHECK_EQ(output_depth, filter_shape.Dims(filter_dim_count - 2));
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  int out_c = 0;
+  FullyConnectedBlocks<kFullyConnectedBlockRows>(
+      params, input_data, filter_data, folded_bias, batches, accum_depth,
+      output_depth, output_data, &out_c);
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_FULLY_CONNECTED_H_
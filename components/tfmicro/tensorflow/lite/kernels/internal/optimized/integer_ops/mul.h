@@ -0,0 +1,75 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_MUL_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_MUL_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/simd.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Int8 multiplication of tensors of the same shape, with the same results
+// as reference_integer_ops::Mul(), kSimdLanes elements at a time. The
+// broadcasts are left to reference_integer_ops::BroadcastMul4DSlow().
+
+// Outputs count elements, kSimdLanes unless kPartial.
+template <bool kPartial>
+inline void MulLanes(const ArithmeticParams& params, const int8_t* input1_data,
+                     const int8_t* input2_data, int count,
+                     int8_t* output_data) {
+  const SimdInt32 input1_val =
+      SimdAdd(SimdLoadInt8Lanes<kPartial>(input1_data, count),
+              SimdDup(params.input1_offset));
+  const SimdInt32 input2_val =
+      SimdAdd(SimdLoadInt8Lanes<kPartial>(input2_data, count),
+              SimdDup(params.input2_offset));
+  SimdInt32 output_val =
+      SimdAdd(SimdMultiplyByQuantizedMultiplier(
+                  SimdMul(input1_val, input2_val), params.output_multiplier,
+                  params.output_shift),
+              SimdDup(params.output_offset));
+  output_val = SimdMax(output_val, SimdDup(params.quantized_activation_min));
+  output_val = SimdMin(output_val, SimdDup(params.quantized_activation_max));
+  SimdStoreInt8Lanes<kPartial>(output_data, output_val, count);
+}
+
+inline void Mul(const ArithmeticParams& params,
+                const RuntimeShape& input1_shape, const int8_t* input1_data,
+                const RuntimeShape& input2_shape, const int8_t* input2_data,
+                const RuntimeShape& output_shape, int8_t* output_data) {
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  const int flat_size =
+      MatchingElementsSize(input1_shape, input2_shape, output_shape);
+
+  int i = 0;
+  for (; i + kSimdLanes <= flat_size; i += kSimdLanes) {
+    MulLanes<false>(params, input1_data + i, input2_data + i, kSimdLanes,
+                    output_data + i);
+  }
+  if (i < flat_size) {
+    MulLanes<true>(params, input1_data + i, input2_data + i, flat_size - i,
+                   output_data + i);
+  }
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_MUL_H_
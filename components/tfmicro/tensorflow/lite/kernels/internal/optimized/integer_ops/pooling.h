@@ -0,0 +1,166 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_POOLING_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_POOLING_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/simd.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Int8 max and average pooling, with the same results as
+// reference_integer_ops::MaxPool() and AveragePool(): the window of an
+// output pixel is clamped to the input once, then reduced kSimdLanes
+// channels at a time, each of its pixels being a vector load. The rounding
+// division of the average runs lane by lane, on the sums of the window.
+
+// The part of the window of output pixel out_y, out_x inside the input:
+// rows [*in_y_start, *in_y_end) and columns [*in_x_start, *in_x_end).
+inline void PoolWindow(const PoolParams& params, int input_height,
+                       int input_width, int out_y, int out_x, int* in_y_start,
+                       int* in_y_end, int* in_x_start, int* in_x_end) {
+  const int in_y_origin =
+      out_y * params.stride_height - params.padding_values.height;
+  const int in_x_origin =
+      out_x * params.stride_width - params.padding_values.width;
+  *in_y_start = std::max(in_y_origin, 0);
+  *in_y_end = std::min(in_y_origin + params.filter_height, input_height);
+  *in_x_start = std::max(in_x_origin, 0);
+  *in_x_end = std::min(in_x_origin + params.filter_width, input_width);
+}
+
+// Outputs count channels from channel on of a pixel, from its window of
+// window_height rows of window_width pixels, the first pixel of which is
+// input_pixel, the rows input_row_size bytes apart: their maximum, or their
+// rounded average when kAverage.
+template <bool kAverage, bool kPartial>
+inline void PoolChannels(const PoolParams& params, const int8_t* input_pixel,
+                         int input_row_size, int depth, int window_height,
+                         int window_width, int channel, int count,
+                         int8_t* output_pixel) {
+  SimdInt32 acc =
+      SimdDup(kAverage ? 0 : std::numeric_limits<int8_t>::lowest());
+  for (int y = 0; y < window_height; ++y) {
+    const int8_t* input_row = input_pixel + y * input_row_size + channel;
+    for (int x = 0; x < window_width; ++x) {
+      const SimdInt32 input_val =
+          SimdLoadInt8Lanes<kPartial>(input_row + x * depth, count);
+      acc = kAverage ? SimdAdd(acc, input_val) : SimdMax(acc, input_val);
+    }
+  }
+  if (!kAverage) {
+    acc = SimdMax(acc, SimdDup(params.quantized_activation_min));
+    acc = SimdMin(acc, SimdDup(params.quantized_activation_max));
+    SimdStoreInt8Lanes<kPartial>(output_pixel + channel, acc, count);
+    return;
+  }
+  const int window_count = window_height * window_width;
+  int32_t sums[kSimdLanes];
+  SimdStore(sums, acc);
+  for (int i = 0; i < count; ++i) {
+    // Round to the closest integer value.
+    int32_t value = sums[i];
+    value = value > 0 ? (value + window_count / 2) / window_count
+                      : (value - window_count / 2) / window_count;
+    value = std::max(value, params.quantized_activation_min);
+    value = std::min(value, params.quantized_activation_max);
+    output_pixel[channel + i] = static_cast<int8_t>(value);
+  }
+}
+
+// Pools every output pixel, kSimdLanes channels at a time. Returns false
+// if the window of a pixel has no pixel inside the input to average, the
+// maximum of none being the lowest value.
+template <bool kAverage>
+inline bool Pool(const PoolParams& params, const RuntimeShape& input_shape,
+                 const int8_t* input_data, const RuntimeShape& output_shape,
+                 int8_t* output_data) {
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int input_row_size = input_width * depth;
+
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        int in_y_start, in_y_end, in_x_start, in_x_end;
+        PoolWindow(params, input_height, input_width, out_y, out_x,
+                   &in_y_start, &in_y_end, &in_x_start, &in_x_end);
+        const int window_height = std::max(in_y_end - in_y_start, 0);
+        const int window_width = std::max(in_x_end - in_x_start, 0);
+        const bool window_empty = window_height == 0 || window_width == 0;
+        if (kAverage && window_empty) {
+          return false;
+        }
+        const int8_t* input_pixel =
+            window_empty ? input_data
+                         : input_data + Offset(input_shape, batch, in_y_start,
+                                               in_x_start, 0);
+        int8_t* output_pixel =
+            output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        int channel = 0;
+        for (; channel + kSimdLanes <= depth; channel += kSimdLanes) {
+          PoolChannels<kAverage, false>(params, input_pixel, input_row_size,
+                                        depth, window_height, window_width,
+                                        channel, kSimdLanes, output_pixel);
+        }
+        if (channel < depth) {
+          PoolChannels<kAverage, true>(params, input_pixel, input_row_size,
+                                       depth, window_height, window_width,
+                                       channel, depth - channel,
+                                       output_pixel);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+inline void MaxPool(const PoolParams& params, const RuntimeShape& input_shape,
+                    const int8_t* input_data, const RuntimeShape& output_shape,
+                    int8_t* output_data) {
+  TFLITE_DCHECK_GE(params.quantized_activation_min,
+                   std::numeric_limits<int8_t>::min());
+  TFLITE_DCHECK_LE(params.quantized_activation_max,
+                   std::numeric_limits<int8_t>::max());
+  Pool<false>(params, input_shape, input_data, output_shape, output_data);
+}
+
+inline bool AveragePool(const PoolParams& params,
+                        const RuntimeShape& input_shape,
+                        const int8_t* input_data,
+                        const RuntimeShape& output_shape,
+                        int8_t* output_data) {
+  return Pool<true>(params, input_shape, input_data, output_shape,
+                    output_data);
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_POOLING_H_
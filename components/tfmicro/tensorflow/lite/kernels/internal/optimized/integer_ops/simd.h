@@ -0,0 +1,461 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_SIMD_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_SIMD_H_
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TFLITE_SIMD_AVX2
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define TFLITE_SIMD_SSE4_1
+#endif
+
+#include "tensorflow/lite/kernels/internal/common.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Vectors of kSimdLanes int32 values, on which the int8 kernels compute
+// kSimdLanes channels, or outputs, at once, with the same results lane by
+// lane as their scalar code. The flavor is the one of the instruction set
+// the code is compiled for:
+//  - AVX2 (-mavx2): 8 lanes.
+//  - SSE4.1 (-msse4.1): 4 lanes.
+//  - Portable, anywhere else: a single lane, a plain int32_t, so that the
+//    kernels reduce to their scalar loops.
+// The int8 values are widened to int32 when loaded and narrowed back when
+// stored, which leaves the kernels no overflow to care about.
+
+#if defined(TFLITE_SIMD_AVX2)
+
+typedef __m256i SimdInt32;
+constexpr int kSimdLanes = 8;
+
+inline SimdInt32 SimdDup(int32_t value) { return _mm256_set1_epi32(value); }
+
+inline SimdInt32 SimdLoad(const int32_t* data) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+}
+
+inline void SimdStore(int32_t* data, SimdInt32 value) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), value);
+}
+
+inline SimdInt32 SimdLoadInt8(const int8_t* data) {
+  return _mm256_cvtepi8_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+}
+
+// The lanes must be int8 values.
+inline void SimdStoreInt8(int8_t* data, SimdInt32 value) {
+  const __m128i value16 = _mm_packs_epi32(_mm256_castsi256_si128(value),
+                                          _mm256_extracti128_si256(value, 1));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(data),
+                   _mm_packs_epi16(value16, value16));
+}
+
+inline SimdInt32 SimdAdd(SimdInt32 a, SimdInt32 b) {
+  return _mm256_add_epi32(a, b);
+}
+
+inline SimdInt32 SimdSub(SimdInt32 a, SimdInt32 b) {
+  return _mm256_sub_epi32(a, b);
+}
+
+inline SimdInt32 SimdMul(SimdInt32 a, SimdInt32 b) {
+  return _mm256_mullo_epi32(a, b);
+}
+
+inline SimdInt32 SimdMin(SimdInt32 a, SimdInt32 b) {
+  return _mm256_min_epi32(a, b);
+}
+
+inline SimdInt32 SimdMax(SimdInt32 a, SimdInt32 b) {
+  return _mm256_max_epi32(a, b);
+}
+
+inline SimdInt32 SimdAnd(SimdInt32 a, SimdInt32 b) {
+  return _mm256_and_si256(a, b);
+}
+
+// All ones in the lanes where a > b, zeros elsewhere.
+inline SimdInt32 SimdGreaterThan(SimdInt32 a, SimdInt32 b) {
+  return _mm256_cmpgt_epi32(a, b);
+}
+
+inline SimdInt32 SimdEqual(SimdInt32 a, SimdInt32 b) {
+  return _mm256_cmpeq_epi32(a, b);
+}
+
+// a in the lanes where mask is all ones, b elsewhere.
+inline SimdInt32 SimdSelect(SimdInt32 mask, SimdInt32 a, SimdInt32 b) {
+  return _mm256_blendv_epi8(b, a, mask);
+}
+
+// Shifts of every lane by the same count, and of each lane by its own.
+inline SimdInt32 SimdShiftLeft(SimdInt32 a, int count) {
+  return _mm256_sll_epi32(a, _mm_cvtsi32_si128(count));
+}
+
+inline SimdInt32 SimdShiftRight(SimdInt32 a, int count) {
+  return _mm256_sra_epi32(a, _mm_cvtsi32_si128(count));
+}
+
+inline SimdInt32 SimdShiftLeftLanes(SimdInt32 a, SimdInt32 count) {
+  return _mm256_sllv_epi32(a, count);
+}
+
+inline SimdInt32 SimdShiftRightLanes(SimdInt32 a, SimdInt32 count) {
+  return _mm256_srav_epi32(a, count);
+}
+
+// The high 32 bits of the 64-bit products of the even lanes of a and b, and
+// of their odd lanes, each doubled after adding a nudge of 1 << 30.
+inline SimdInt32 SimdRoundingDoublingHighMul(SimdInt32 a, SimdInt32 b) {
+  const __m256i nudge = _mm256_set1_epi64x(1ll << 30);
+  const __m256i even = _mm256_slli_epi64(
+      _mm256_add_epi64(_mm256_mul_epi32(a, b), nudge), 1);
+  const __m256i odd = _mm256_slli_epi64(
+      _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(a, 32),
+                                        _mm256_srli_epi64(b, 32)),
+                       nudge),
+      1);
+  return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xaa);
+}
+
+// Values of the dot products SimdDotInt8() accumulates per call.
+constexpr int kSimdDotDepth = 16;
+
+// Adds the products of the kSimdDotDepth values of a and b to the lanes of
+// acc, two products to each.
+inline SimdInt32 SimdDotInt8(SimdInt32 acc, const int8_t* a,
+                             const int8_t* b) {
+  const __m256i a16 = _mm256_cvtepi8_epi16(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(a)));
+  const __m256i b16 = _mm256_cvtepi8_epi16(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(b)));
+  return _mm256_add_epi32(acc, _mm256_madd_epi16(a16, b16));
+}
+
+inline int32_t SimdReduceAdd(SimdInt32 value) {
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(value),
+                              _mm256_extracti128_si256(value, 1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(sum);
+}
+
+#elif defined(TFLITE_SIMD_SSE4_1)
+
+typedef __m128i SimdInt32;
+constexpr int kSimdLanes = 4;
+
+inline SimdInt32 SimdDup(int32_t value) { return _mm_set1_epi32(value); }
+
+inline SimdInt32 SimdLoad(const int32_t* data) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+inline void SimdStore(int32_t* data, SimdInt32 value) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+}
+
+inline SimdInt32 SimdLoadInt8(const int8_t* data) {
+  int32_t values;
+  std::memcpy(&values, data, sizeof(values));
+  return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(values));
+}
+
+// The lanes must be int8 values.
+inline void SimdStoreInt8(int8_t* data, SimdInt32 value) {
+  const __m128i value16 = _mm_packs_epi32(value, value);
+  const int32_t values = _mm_cvtsi128_si32(_mm_packs_epi16(value16, value16));
+  std::memcpy(data, &values, sizeof(values));
+}
+
+inline SimdInt32 SimdAdd(SimdInt32 a, SimdInt32 b) {
+  return _mm_add_epi32(a, b);
+}
+
+inline SimdInt32 SimdSub(SimdInt32 a, SimdInt32 b) {
+  return _mm_sub_epi32(a, b);
+}
+
+inline SimdInt32 SimdMul(SimdInt32 a, SimdInt32 b) {
+  return _mm_mullo_epi32(a, b);
+}
+
+inline SimdInt32 SimdMin(SimdInt32 a, SimdInt32 b) {
+  return _mm_min_epi32(a, b);
+}
+
+inline SimdInt32 SimdMax(SimdInt32 a, SimdInt32 b) {
+  return _mm_max_epi32(a, b);
+}
+
+inline SimdInt32 SimdAnd(SimdInt32 a, SimdInt32 b) {
+  return _mm_and_si128(a, b);
+}
+
+// All ones in the lanes where a > b, zeros elsewhere.
+inline SimdInt32 SimdGreaterThan(SimdInt32 a, SimdInt32 b) {
+  return _mm_cmpgt_epi32(a, b);
+}
+
+inline SimdInt32 SimdEqual(SimdInt32 a, SimdInt32 b) {
+  return _mm_cmpeq_epi32(a, b);
+}
+
+// a in the lanes where mask is all ones, b elsewhere.
+inline SimdInt32 SimdSelect(SimdInt32 mask, SimdInt32 a, SimdInt32 b) {
+  return _mm_blendv_epi8(b, a, mask);
+}
+
+// Shifts of every lane by the same count, and of each lane by its own.
+// SSE4.1 has no shift by lane: the left one multiplies by 2^count, made a
+// float exponent, and the right one blends a shift by each count.
+inline SimdInt32 SimdShiftLeft(SimdInt32 a, int count) {
+  return _mm_sll_epi32(a, _mm_cvtsi32_si128(count));
+}
+
+inline SimdInt32 SimdShiftRight(SimdInt32 a, int count) {
+  return _mm_sra_epi32(a, _mm_cvtsi32_si128(count));
+}
+
+inline SimdInt32 SimdShiftLeftLanes(SimdInt32 a, SimdInt32 count) {
+  const __m128i power_of_two = _mm_cvttps_epi32(_mm_castsi128_ps(
+      _mm_slli_epi32(_mm_add_epi32(count, _mm_set1_epi32(127)), 23)));
+  return _mm_mullo_epi32(a, power_of_two);
+}
+
+inline SimdInt32 SimdShiftRightLanes(SimdInt32 a, SimdInt32 count) {
+  const __m128i lane0 =
+      _mm_sra_epi32(a, _mm_cvtsi32_si128(_mm_extract_epi32(count, 0)));
+  const __m128i lane1 =
+      _mm_sra_epi32(a, _mm_cvtsi32_si128(_mm_extract_epi32(count, 1)));
+  const __m128i lane2 =
+      _mm_sra_epi32(a, _mm_cvtsi32_si128(_mm_extract_epi32(count, 2)));
+  const __m128i lane3 =
+      _mm_sra_epi32(a, _mm_cvtsi32_si128(_mm_extract_epi32(count, 3)));
+  return _mm_blend_epi16(_mm_blend_epi16(lane0, lane1, 0x0c),
+                         _mm_blend_epi16(lane2, lane3, 0xc0), 0xf0);
+}
+
+// The high 32 bits of the 64-bit products of the even lanes of a and b, and
+// of their odd lanes, each doubled after adding a nudge of 1 << 30.
+inline SimdInt32 SimdRoundingDoublingHighMul(SimdInt32 a, SimdInt32 b) {
+  const __m128i nudge = _mm_set1_epi64x(1ll << 30);
+  const __m128i even =
+      _mm_slli_epi64(_mm_add_epi64(_mm_mul_epi32(a, b), nudge), 1);
+  const __m128i odd = _mm_slli_epi64(
+      _mm_add_epi64(
+          _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), nudge),
+      1);
+  return _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xcc);
+}
+
+// Values of the dot products SimdDotInt8() accumulates per call.
+constexpr int kSimdDotDepth = 8;
+
+// Adds the products of the kSimdDotDepth values of a and b to the lanes of
+// acc, two products to each.
+inline SimdInt32 SimdDotInt8(SimdInt32 acc, const int8_t* a,
+                             const int8_t* b) {
+  const __m128i a16 = _mm_cvtepi8_epi16(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(a)));
+  const __m128i b16 = _mm_cvtepi8_epi16(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(b)));
+  return _mm_add_epi32(acc, _mm_madd_epi16(a16, b16));
+}
+
+inline int32_t SimdReduceAdd(SimdInt32 value) {
+  __m128i sum = _mm_add_epi32(
+      value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(sum);
+}
+
+#else
+
+typedef int32_t SimdInt32;
+constexpr int kSimdLanes = 1;
+
+inline SimdInt32 SimdDup(int32_t value) { return value; }
+
+inline SimdInt32 SimdLoad(const int32_t* data) { return *data; }
+
+inline void SimdStore(int32_t* data, SimdInt32 value) { *data = value; }
+
+inline SimdInt32 SimdLoadInt8(const int8_t* data) { return *data; }
+
+// The lanes must be int8 values.
+inline void SimdStoreInt8(int8_t* data, SimdInt32 value) {
+  *data = static_cast<int8_t>(value);
+}
+
+inline SimdInt32 SimdAdd(SimdInt32 a, SimdInt32 b) { return a + b; }
+
+inline SimdInt32 SimdSub(SimdInt32 a, SimdInt32 b) { return a - b; }
+
+inline SimdInt32 SimdMul(SimdInt32 a, SimdInt32 b) { return a * b; }
+
+inline SimdInt32 SimdMin(SimdInt32 a, SimdInt32 b) { return a < b ? a : b; }
+
+inline SimdInt32 SimdMax(SimdInt32 a, SimdInt32 b) { return a > b ? a : b; }
+
+inline SimdInt32 SimdShiftLeft(SimdInt32 a, int count) {
+  return a * (1 << count);
+}
+
+// Values of the dot products SimdDotInt8() accumulates per call.
+constexpr int kSimdDotDepth = 1;
+
+inline SimdInt32 SimdDotInt8(SimdInt32 acc, const int8_t* a,
+                             const int8_t* b) {
+  return acc + *a * *b;
+}
+
+inline int32_t SimdReduceAdd(SimdInt32 value) { return value; }
+
+#endif
+
+// The loads and stores of the kernels that compute count channels at a
+// time, count being kSimdLanes unless kPartial: only the first count lanes
+// are then read, the others being 0, or written, for the last channels of a
+// row that do not fill a vector.
+template <bool kPartial>
+inline SimdInt32 SimdLoadLanes(const int32_t* data, int count) {
+  if (!kPartial) {
+    return SimdLoad(data);
+  }
+  int32_t lanes[kSimdLanes] = {};
+  std::memcpy(lanes, data, count * sizeof(int32_t));
+  return SimdLoad(lanes);
+}
+
+template <bool kPartial>
+inline SimdInt32 SimdLoadInt8Lanes(const int8_t* data, int count) {
+  if (!kPartial) {
+    return SimdLoadInt8(data);
+  }
+  int8_t lanes[kSimdLanes] = {};
+  std::memcpy(lanes, data, count);
+  return SimdLoadInt8(lanes);
+}
+
+template <bool kPartial>
+inline void SimdStoreInt8Lanes(int8_t* data, SimdInt32 value, int count) {
+  if (!kPartial) {
+    SimdStoreInt8(data, value);
+    return;
+  }
+  int8_t lanes[kSimdLanes];
+  SimdStoreInt8(lanes, value);
+  std::memcpy(data, lanes, count);
+}
+
+#if defined(TFLITE_SIMD_AVX2) || defined(TFLITE_SIMD_SSE4_1)
+
+// The lanes of gemmlowp::SaturatingRoundingDoublingHighMul(a, b).
+inline SimdInt32 SimdSaturatingRoundingDoublingHighMul(SimdInt32 a,
+                                                       SimdInt32 b) {
+  const SimdInt32 min = SimdDup(std::numeric_limits<int32_t>::min());
+  const SimdInt32 overflow = SimdAnd(SimdEqual(a, b), SimdEqual(a, min));
+  return SimdSelect(overflow, SimdDup(std::numeric_limits<int32_t>::max()),
+                    SimdRoundingDoublingHighMul(a, b));
+}
+
+// The lanes of gemmlowp::RoundingDivideByPOT(x, exponent), from
+// mask = (1 << exponent) - 1 and x >> exponent.
+inline SimdInt32 SimdRoundingDivideByPOT(SimdInt32 x, SimdInt32 mask,
+                                         SimdInt32 shifted) {
+  const SimdInt32 one = SimdDup(1);
+  const SimdInt32 threshold =
+      SimdAdd(SimdShiftRight(mask, 1),
+              SimdAnd(SimdGreaterThan(SimdDup(0), x), one));
+  return SimdAdd(shifted,
+                 SimdAnd(SimdGreaterThan(SimdAnd(x, mask), threshold), one));
+}
+
+// The lanes of MultiplyByQuantizedMultiplier(x, multiplier, shift), the
+// same multiplier and shift for every lane.
+inline SimdInt32 SimdMultiplyByQuantizedMultiplier(SimdInt32 x,
+                                                   int32_t multiplier,
+                                                   int shift) {
+  const int left_shift = shift > 0 ? shift : 0;
+  const int right_shift = shift > 0 ? 0 : -shift;
+  const SimdInt32 product = SimdSaturatingRoundingDoublingHighMul(
+      SimdShiftLeft(x, left_shift), SimdDup(multiplier));
+  return SimdRoundingDivideByPOT(
+      product, SimdDup(static_cast<int32_t>((1ll << right_shift) - 1)),
+      SimdShiftRight(product, right_shift));
+}
+
+// The lanes of MultiplyByQuantizedMultiplier(x, multiplier, shift), with a
+// multiplier and shift for each lane, the ones of per-channel quantization.
+inline SimdInt32 SimdMultiplyByQuantizedMultiplierLanes(SimdInt32 x,
+                                                        SimdInt32 multiplier,
+                                                        SimdInt32 shift) {
+  const SimdInt32 zero = SimdDup(0);
+  const SimdInt32 left_shift = SimdMax(shift, zero);
+  const SimdInt32 right_shift = SimdMax(SimdSub(zero, shift), zero);
+  const SimdInt32 product = SimdSaturatingRoundingDoublingHighMul(
+      SimdShiftLeftLanes(x, left_shift), multiplier);
+  const SimdInt32 one = SimdDup(1);
+  return SimdRoundingDivideByPOT(
+      product, SimdSub(SimdShiftLeftLanes(one, right_shift), one),
+      SimdShiftRightLanes(product, right_shift));
+}
+
+#else
+
+inline SimdInt32 SimdMultiplyByQuantizedMultiplier(SimdInt32 x,
+                                                   int32_t multiplier,
+                                                   int shift) {
+  return MultiplyByQuantizedMultiplier(x, multiplier, shift);
+}
+
+inline SimdInt32 SimdMultiplyByQuantizedMultiplierLanes(SimdInt32 x,
+                                                        SimdInt32 multiplier,
+                                                        SimdInt32 shift) {
+  return MultiplyByQuantizedMultiplier(x, multiplier, shift);
+}
+
+#endif
+
+// The lanes of MultiplyByQuantizedMultiplier(x, multiplier, shift) +
+// output_offset, clamped to [output_activation_min, output_activation_max]:
+// the output stage of the int8 kernels, with per-channel multipliers and
+// shifts.
+inline SimdInt32 SimdRequantizeLanes(SimdInt32 x, SimdInt32 multiplier,
+                                     SimdInt32 shift, int32_t output_offset,
+                                     int32_t output_activation_min,
+                                     int32_t output_activation_max) {
+  SimdInt32 value = SimdAdd(
+      SimdMultiplyByQuantizedMultiplierLanes(x, multiplier, shift),
+      SimdDup(output_offset));
+  value = SimdMax(value, SimdDup(output_activation_min));
+  return SimdMin(value, SimdDup(output_activation_max));
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_SIMD_H_
@@ -15,23 +15,164 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/kernels/conv.h"
 
+#include <algorithm>
+
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/pooling.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/kernels/internal/reference/conv.h"
 #include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/pooling.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/kernels/padding.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
 
 namespace tflite {
 namespace {
 
+struct OpData {
+  // First, for ConvPrepare() to fill in.
+  OpDataConv reference_op_data;
+
+  // The int8 convolution: the kernel for its shape, the bias with the input
+  // offset folded in, and the scratch buffer the patches of an output row
+  // are unrolled into, -1 when the kernel needs none. No kernel when the
+  // filter or the bias are not constant, the reference kernel runs then.
+  optimized_integer_ops::ConvPerChannelKernel kernel;
+  int32_t* folded_bias;
+  int im2col_buffer_index;
+};
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
-  return context->AllocatePersistentBuffer(context, sizeof(OpDataConv));
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(ConvPrepare(context, node));
+
+  OpData* data = static_cast<OpData*>(node->user_data);
+  data->kernel = nullptr;
+  data->folded_bias = nullptr;
+  data->im2col_buffer_index = -1;
+  const TfLiteTensor* input = GetInput(context, node, kConvInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  if (input->type != kTfLiteInt8) {
+    return kTfLiteOk;
+  }
+
+  const auto& params =
+      *(static_cast<const TfLiteConvParams*>(node->builtin_data));
+  const TfLiteTensor* filter = GetInput(context, node, kConvWeightsTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  const TfLiteTensor* bias =
+      GetOptionalInputTensor(context, node, kConvBiasTensor);
+  TfLiteTensor* output = GetOutput(context, node, kConvOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+  // The input offset is folded into the bias once, which only holds when
+  // the filter and the bias do not change between invocations.
+  if (!IsConstantTensor(filter) ||
+      (bias != nullptr && !IsConstantTensor(bias))) {
+    return kTfLiteOk;
+  }
+
+  const RuntimeShape filter_shape = GetTensorShape(filter);
+  const int output_depth = filter_shape.Dims(0);
+  data->folded_bias = static_cast<int32_t*>(context->AllocatePersistentBuffer(
+      context, output_depth * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->folded_bias != nullptr);
+  optimized_integer_ops::FoldConvInputOffset(
+      -data->reference_op_data.input_zero_point, filter_shape,
+      GetTensorData<int8_t>(filter),
+      bias != nullptr ? GetTensorData<int32_t>(bias) : nullptr,
+      data->folded_bias);
+
+  // The small filters of the first layers have kernels of their own,
+  // unrolled for their shape.
+  const ConvParams conv_params =
+      ConvParamsQuantized(params, data->reference_op_data);
+  data->kernel = optimized_integer_ops::SelectFixedConvPerChannel(
+      conv_params, filter_shape);
+  if (data->kernel != nullptr) {
+    return kTfLiteOk;
+  }
+  data->kernel = optimized_integer_ops::ConvPerChannel;
+  const int im2col_bytes = optimized_integer_ops::ConvIm2colBufferSize(
+      conv_params, filter_shape, GetTensorShape(output));
+  if (im2col_bytes > 0) {
+    TF_LITE_ENSURE_STATUS(context->RequestScratchBufferInArena(
+        context, im2col_bytes, &data->im2col_buffer_index));
+  }
+  return kTfLiteOk;
+}
+
+ConvParams ConvParamsForType(TfLiteType type, const TfLiteConvParams& params,
+                             const OpDataConv& data) {
+  return type == kTfLiteFloat32 ? ConvParamsFloat(params, data)
+                                : ConvParamsQuantized(params, data);
+}
+
+// The convolution of input into output, which have the layout of the node's
+// tensors but may only cover some of their rows, conv_params then having the
+// padding of these rows.
+TfLiteStatus EvalConv(TfLiteContext* context, const OpData& op_data,
+                      const ConvParams& conv_params, TfLiteType type,
+                      const RuntimeShape& input_shape, const void* input_data,
+                      const TfLiteEvalTensor* filter,
+                      const TfLiteEvalTensor* bias,
+                      const RuntimeShape& output_shape, void* output_data) {
+  switch (type) {
+    case kTfLiteFloat32: {
+      tflite::reference_ops::Conv(
+          conv_params, input_shape, static_cast<const float*>(input_data),
+          tflite::micro::GetTensorShape(filter),
+          tflite::micro::GetTensorData<float>(filter),
+          tflite::micro::GetTensorShape(bias),
+          tflite::micro::GetTensorData<float>(bias), output_shape,
+          static_cast<float*>(output_data),
+          tflite::micro::GetTensorShape(nullptr), nullptr);
+      break;
+    }
+    case kTfLiteInt8: {
+      const auto& data = op_data.reference_op_data;
+      if (op_data.kernel == nullptr) {
+        reference_integer_ops::ConvPerChannel(
+            conv_params, data.per_channel_output_multiplier,
+            data.per_channel_output_shift, input_shape,
+            static_cast<const int8_t*>(input_data),
+            tflite::micro::GetTensorShape(filter),
+            tflite::micro::GetTensorData<int8_t>(filter),
+            tflite::micro::GetTensorShape(bias),
+            bias != nullptr ? tflite::micro::GetTensorData<int32_t>(bias)
+                            : nullptr,
+            output_shape, static_cast<int8_t*>(output_data));
+        break;
+      }
+      int8_t* im2col_data =
+          (op_data.im2col_buffer_index >= 0)
+              ? static_cast<int8_t*>(context->GetScratchBuffer(
+                    context, op_data.im2col_buffer_index))
+              : nullptr;
+      op_data.kernel(conv_params, data.per_channel_output_multiplier,
+                     data.per_channel_output_shift, op_data.folded_bias,
+                     input_shape, static_cast<const int8_t*>(input_data),
+                     tflite::micro::GetTensorShape(filter),
+                     tflite::micro::GetTensorData<int8_t>(filter),
+                     output_shape, static_cast<int8_t*>(output_data),
+                     im2col_data);
+      break;
+    }
+    default:
+      TF_LITE_KERNEL_LOG(context, "Type %s (%d) not supported.",
+                         TfLiteTypeGetName(type), type);
+      return kTfLiteError;
+  }
+  return kTfLiteOk;
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
@@ -50,43 +191,216 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const auto& params =
       *(reinterpret_cast<TfLiteConvParams*>(node->builtin_data));
   TFLITE_DCHECK(node->user_data != nullptr);
-  const auto& data = *(static_cast<const OpDataConv*>(node->user_data));
+  const auto& op_data = *(static_cast<const OpData*>(node->user_data));
 
   TF_LITE_ENSURE_EQ(context, input->type, output->type);
   TF_LITE_ENSURE_MSG(context, input->type == filter->type,
                      "Hybrid models are not supported on TFLite Micro.");
 
-  switch (input->type) {  // Already know in/out types are same.
-    case kTfLiteFloat32: {
-      tflite::reference_ops::Conv(
-          ConvParamsFloat(params, data), tflite::micro::GetTensorShape(input),
-          tflite::micro::GetTensorData<float>(input),
-          tflite::micro::GetTensorShape(filter),
-          tflite::micro::GetTensorData<float>(filter),
-          tflite::micro::GetTensorShape(bias),
-          tflite::micro::GetTensorData<float>(bias),
-          tflite::micro::GetTensorShape(output),
-          tflite::micro::GetTensorData<float>(output),
-          tflite::micro::GetTensorShape(nullptr), nullptr);
-      break;
-    }
-    case kTfLiteInt8: {
-      reference_integer_ops::ConvPerChannel(
-          ConvParamsQuantized(params, data), data.per_channel_output_multiplier,
-          data.per_channel_output_shift, tflite::micro::GetTensorShape(input),
-          tflite::micro::GetTensorData<int8_t>(input),
-          tflite::micro::GetTensorShape(filter),
-          tflite::micro::GetTensorData<int8_t>(filter),
-          tflite::micro::GetTensorShape(bias),
-          tflite::micro::GetTensorData<int32_t>(bias),
-          tflite::micro::GetTensorShape(output),
-          tflite::micro::GetTensorData<int8_t>(output));
-      break;
+  return EvalConv(
+      context, op_data,
+      ConvParamsForType(input->type, params, op_data.reference_op_data),
+      input->type, tflite::micro::GetTensorShape(input), input->data.data,
+      filter, bias, tflite::micro::GetTensorShape(output), output->data.data);
+}
+
+// CONV_2D_MAX_POOL_2D, a CONV_2D and the MAX_POOL_2D of its output, fused by
+// MicroGraph::FuseSubgraphs(). For each row of the pooling, the convolution
+// computes the rows its window reads into a scratch buffer, which the
+// pooling then reduces into the output: the output of the convolution is
+// never written whole. Both operators run as they do on their own, so the
+// results are the same.
+struct ConvMaxPoolOpData {
+  // First, for the CONV_2D Prepare() to fill in.
+  OpData conv;
+
+  // The nodes of the model, conv_node with conv as its user data.
+  TfLiteNode conv_node;
+  TfLiteNode pool_node;
+
+  TfLitePaddingValues pool_padding;
+  int32_t pool_activation_min;
+  int32_t pool_activation_max;
+  float pool_activation_min_f32;
+  float pool_activation_max_f32;
+
+  // The scratch buffer of the convolution rows a pooling window reads.
+  int rows_buffer_index;
+};
+
+void* ConvMaxPoolInit(TfLiteContext* context, const char* buffer,
+                      size_t length) {
+  TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
+  TFLITE_DCHECK(length == 2 * sizeof(TfLiteNode));
+  auto* data = static_cast<ConvMaxPoolOpData*>(
+      context->AllocatePersistentBuffer(context, sizeof(ConvMaxPoolOpData)));
+  if (data == nullptr) {
+    return nullptr;
+  }
+  const TfLiteNode* chain = reinterpret_cast<const TfLiteNode*>(buffer);
+  data->conv_node = chain[0];
+  data->conv_node.user_data = &data->conv;
+  data->pool_node = chain[1];
+  return data;
+}
+
+TfLiteStatus ConvMaxPoolPrepare(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  auto* data = static_cast<ConvMaxPoolOpData*>(node->user_data);
+  TF_LITE_ENSURE_STATUS(Prepare(context, &data->conv_node));
+
+  TFLITE_DCHECK(data->pool_node.builtin_data != nullptr);
+  const auto& pool_params =
+      *(static_cast<const TfLitePoolParams*>(data->pool_node.builtin_data));
+  const TfLiteTensor* conv_output =
+      GetOutput(context, &data->conv_node, kConvOutputTensor);
+  TF_LITE_ENSURE(context, conv_output != nullptr);
+  TfLiteTensor* output = GetOutput(context, node, 0);
+  TF_LITE_ENSURE(context, output != nullptr);
+  TF_LITE_ENSURE_TYPES_EQ(context, conv_output->type, output->type);
+
+  const int conv_height = SizeOfDimension(conv_output, 1);
+  const int conv_width = SizeOfDimension(conv_output, 2);
+  int out_height, out_width;
+  data->pool_padding = ComputePaddingHeightWidth(
+      pool_params.stride_height, pool_params.stride_width,
+      /*dilation_rate_height=*/1,
+      /*dilation_rate_width=*/1, conv_height, conv_width,
+      pool_params.filter_height, pool_params.filter_width, pool_params.padding,
+      &out_height, &out_width);
+
+  if (output->type == kTfLiteFloat32) {
+    CalculateActivationRange(pool_params.activation,
+                             &data->pool_activation_min_f32,
+                             &data->pool_activation_max_f32);
+  } else if (output->type == kTfLiteInt8) {
+    TF_LITE_ENSURE_STATUS(CalculateActivationRangeQuantized(
+        context, pool_params.activation, output, &data->pool_activation_min,
+        &data->pool_activation_max));
+  } else {
+    TF_LITE_KERNEL_LOG(context, "Type %s (%d) not supported.",
+                       TfLiteTypeGetName(output->type), output->type);
+    return kTfLiteError;
+  }
+
+  size_t element_size;
+  TF_LITE_ENSURE_STATUS(TfLiteTypeSizeOf(output->type, &element_size));
+  const int rows = std::min(pool_params.filter_height, conv_height);
+  return context->RequestScratchBufferInArena(
+      context,
+      rows * conv_width * SizeOfDimension(conv_output, 3) * element_size,
+      &data->rows_buffer_index);
+}
+
+TfLiteStatus ConvMaxPoolEval(TfLiteContext* context, TfLiteNode* node) {
+  TFLITE_DCHECK(node->user_data != nullptr);
+  const auto& data = *(static_cast<const ConvMaxPoolOpData*>(node->user_data));
+  const TfLiteNode* conv_node = &data.conv_node;
+  const TfLiteEvalTensor* input =
+      tflite::micro::GetEvalInput(context, conv_node, kConvInputTensor);
+  const TfLiteEvalTensor* filter =
+      tflite::micro::GetEvalInput(context, conv_node, kConvWeightsTensor);
+  const TfLiteEvalTensor* bias =
+      (NumInputs(conv_node) == 3)
+          ? tflite::micro::GetEvalInput(context, conv_node, kConvBiasTensor)
+          : nullptr;
+  // Only for its shape, it is not allocated.
+  const TfLiteEvalTensor* conv_output =
+      tflite::micro::GetEvalOutput(context, conv_node, kConvOutputTensor);
+  TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, 0);
+
+  const auto& params =
+      *(static_cast<const TfLiteConvParams*>(conv_node->builtin_data));
+  const auto& pool_params =
+      *(static_cast<const TfLitePoolParams*>(data.pool_node.builtin_data));
+
+  TF_LITE_ENSURE_EQ(context, input->type, output->type);
+  TF_LITE_ENSURE_MSG(context, input->type == filter->type,
+                     "Hybrid models are not supported on TFLite Micro.");
+  const ConvParams conv_params =
+      ConvParamsForType(input->type, params, data.conv.reference_op_data);
+  PoolParams pool_op_params;
+  pool_op_params.stride_height = pool_params.stride_height;
+  pool_op_params.stride_width = pool_params.stride_width;
+  pool_op_params.filter_height = pool_params.filter_height;
+  pool_op_params.filter_width = pool_params.filter_width;
+  pool_op_params.padding_values.width = data.pool_padding.width;
+  pool_op_params.quantized_activation_min = data.pool_activation_min;
+  pool_op_params.quantized_activation_max = data.pool_activation_max;
+  pool_op_params.float_activation_min = data.pool_activation_min_f32;
+  pool_op_params.float_activation_max = data.pool_activation_max_f32;
+
+  const RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+  const RuntimeShape conv_shape = tflite::micro::GetTensorShape(conv_output);
+  const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int conv_height = conv_shape.Dims(1);
+  const int conv_width = conv_shape.Dims(2);
+  const int conv_depth = MatchingDim(conv_shape, 3, output_shape, 3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int filter_extent =
+      (tflite::micro::GetTensorShape(filter).Dims(1) - 1) *
+          conv_params.dilation_height_factor +
+      1;
+  size_t element_size;
+  TF_LITE_ENSURE_STATUS(TfLiteTypeSizeOf(input->type, &element_size));
+
+  const uint8_t* input_data = tflite::micro::GetTensorData<uint8_t>(input);
+  uint8_t* output_data = tflite::micro::GetTensorData<uint8_t>(output);
+  uint8_t* rows_data = static_cast<uint8_t*>(
+      context->GetScratchBuffer(context, data.rows_buffer_index));
+  for (int batch = 0; batch < batches; ++batch) {
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      // The convolution rows the pooling window reads, then the input rows
+      // these read, the others being padding.
+      const int window_y =
+          out_y * pool_params.stride_height - data.pool_padding.height;
+      const int conv_y_begin = std::max(window_y, 0);
+      const int conv_y_end =
+          std::min(window_y + pool_params.filter_height, conv_height);
+      const int in_y_origin = conv_y_begin * conv_params.stride_height -
+                              conv_params.padding_values.height;
+      const int in_y_begin = std::max(in_y_origin, 0);
+      const int in_y_end = std::min((conv_y_end - 1) *
+                                            conv_params.stride_height -
+                                        conv_params.padding_values.height +
+                                        filter_extent,
+                                    input_height);
+      TFLITE_DCHECK_LT(conv_y_begin, conv_y_end);
+      TFLITE_DCHECK_LT(in_y_begin, in_y_end);
+
+      ConvParams rows_params = conv_params;
+      rows_params.padding_values.height = in_y_begin - in_y_origin;
+      const RuntimeShape rows_shape(
+          {1, conv_y_end - conv_y_begin, conv_width, conv_depth});
+      TF_LITE_ENSURE_STATUS(EvalConv(
+          context, data.conv, rows_params, input->type,
+          RuntimeShape({1, in_y_end - in_y_begin, input_width, input_depth}),
+          input_data + ((batch * input_height + in_y_begin) * input_width *
+                        input_depth * element_size),
+          filter, bias, rows_shape, rows_data));
+
+      PoolParams row_pool_params = pool_op_params;
+      row_pool_params.padding_values.height = conv_y_begin - window_y;
+      const RuntimeShape row_shape({1, 1, output_width, conv_depth});
+      uint8_t* row_data = output_data + ((batch * output_height + out_y) *
+                                         output_width * conv_depth *
+                                         element_size);
+      if (input->type == kTfLiteFloat32) {
+        reference_ops::MaxPool(row_pool_params, rows_shape,
+                               reinterpret_cast<const float*>(rows_data),
+                               row_shape, reinterpret_cast<float*>(row_data));
+      } else {
+        optimized_integer_ops::MaxPool(
+            row_pool_params, rows_shape,
+            reinterpret_cast<const int8_t*>(rows_data), row_shape,
+            reinterpret_cast<int8_t*>(row_data));
+      }
     }
-    default:
-      TF_LITE_KERNEL_LOG(context, "Type %s (%d) not supported.",
-                         TfLiteTypeGetName(input->type), input->type);
-      return kTfLiteError;
   }
   return kTfLiteOk;
 }
@@ -96,7 +410,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 TfLiteRegistration Register_CONV_2D() {
   return {/*init=*/Init,
           /*free=*/nullptr,
-          /*prepare=*/ConvPrepare,
+          /*prepare=*/Prepare,
           /*invoke=*/Eval,
           /*profiling_string=*/nullptr,
           /*builtin_code=*/0,
@@ -104,4 +418,15 @@ TfLiteRegistration Register_CONV_2D() {
           /*version=*/0};
 }
 
+TfLiteRegistration Register_CONV_2D_MAX_POOL_2D() {
+  return {/*init=*/ConvMaxPoolInit,
+          /*free=*/nullptr,
+          /*prepare=*/ConvMaxPoolPrepare,
+          /*invoke=*/ConvMaxPoolEval,
+          /*profiling_string=*/nullptr,
+          /*builtin_code=*/0,
+          /*custom_name=*/nullptr,
+          /*version=*/0};
+}
+
 }  // namespace tflite
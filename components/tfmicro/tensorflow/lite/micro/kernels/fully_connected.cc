@@ -18,6 +18,7 @@ limitations under the License.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/fully_connected.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
 #include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
@@ -28,17 +29,25 @@ limitations under the License.
 namespace tflite {
 namespace {
 
+struct OpData {
+  // First, for CalculateOpDataFullyConnected() to fill in.
+  OpDataFullyConnected reference_op_data;
+
+  // The int8 layer on constant weights: the bias with the input offset
+  // folded in, null when the reference kernel runs instead.
+  int32_t* folded_bias;
+};
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
-  return context->AllocatePersistentBuffer(context,
-                                           sizeof(OpDataFullyConnected));
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
 }
 
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TFLITE_DCHECK(node->user_data != nullptr);
   TFLITE_DCHECK(node->builtin_data != nullptr);
 
-  auto* data = static_cast<OpDataFullyConnected*>(node->user_data);
+  auto* data = static_cast<OpData*>(node->user_data);
   const auto params =
       static_cast<const TfLiteFullyConnectedParams*>(node->builtin_data);
 
@@ -57,8 +66,33 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_MSG(context, input->type == filter->type,
                      "Hybrid models are not supported on TFLite Micro.");
 
-  return CalculateOpDataFullyConnected(context, params->activation, input->type,
-                                       input, filter, bias, output, data);
+  TF_LITE_ENSURE_STATUS(CalculateOpDataFullyConnected(
+      context, params->activation, input->type, input, filter, bias, output,
+      &data->reference_op_data));
+
+  // The input offset is folded into the bias once, which only holds when
+  // the weights and the bias do not change between invocations. The
+  // optimized kernel also takes symmetric weights, of zero point 0.
+  data->folded_bias = nullptr;
+  const RuntimeShape filter_shape = GetTensorShape(filter);
+  const RuntimeShape output_shape = GetTensorShape(output);
+  if (input->type != kTfLiteInt8 || !IsConstantTensor(filter) ||
+      filter->params.zero_point != 0 ||
+      (bias != nullptr && !IsConstantTensor(bias)) ||
+      output_shape.DimensionsCount() != 2 ||
+      output_shape.Dims(1) !=
+          filter_shape.Dims(filter_shape.DimensionsCount() - 2)) {
+    return kTfLiteOk;
+  }
+  data->folded_bias = static_cast<int32_t*>(context->AllocatePersistentBuffer(
+      context, output_shape.Dims(1) * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->folded_bias != nullptr);
+  optimized_integer_ops::FoldFullyConnectedInputOffset(
+      -data->reference_op_data.input_zero_point, filter_shape,
+      GetTensorData<int8_t>(filter),
+      bias != nullptr ? GetTensorData<int32_t>(bias) : nullptr,
+      data->folded_bias);
+  return kTfLiteOk;
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
@@ -76,8 +110,8 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       tflite::micro::GetEvalOutput(context, node, kFullyConnectedOutputTensor);
 
   TFLITE_DCHECK(node->user_data != nullptr);
-  const auto& data =
-      *(static_cast<const OpDataFullyConnected*>(node->user_data));
+  const auto& op_data = *(static_cast<const OpData*>(node->user_data));
+  const auto& data = op_data.reference_op_data;
 
   // Checks in Prepare ensure input, output and filter types are all the same.
   switch (input->type) {
@@ -96,6 +130,17 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
     }
 
     case kTfLiteInt8: {
+      if (op_data.folded_bias != nullptr) {
+        tflite::optimized_integer_ops::FullyConnected(
+            FullyConnectedParamsQuantized(data),
+            tflite::micro::GetTensorShape(input),
+            tflite::micro::GetTensorData<int8_t>(input),
+            tflite::micro::GetTensorShape(filter),
+            tflite::micro::GetTensorData<int8_t>(filter), op_data.folded_bias,
+            tflite::micro::GetTensorShape(output),
+            tflite::micro::GetTensorData<int8_t>(output));
+        break;
+      }
       tflite::reference_integer_ops::FullyConnected(
           FullyConnectedParamsQuantized(data),
           tflite::micro::GetTensorShape(input),
@@ -16,6 +16,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 
 #include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
 
 namespace tflite {
 namespace micro {
@@ -73,5 +74,26 @@ TfLiteStatus CreateWritableTensorDimsWithCopy(TfLiteContext* context,
   return kTfLiteOk;
 }
 
+// Element-wise ops converted from quantization-aware training graphs can
+// have outputs without a shape in the FlatBuffer, which the allocator would
+// otherwise size as a scalar. Such outputs share the input dims instead.
+// Only use during Prepare phase.
+TfLiteStatus ShareInputDimsIfUnknown(TfLiteContext* context, TfLiteNode* node,
+                                     const TfLiteTensor* input,
+                                     TfLiteTensor* output) {
+  TF_LITE_ENSURE(context, input != nullptr);
+  TF_LITE_ENSURE(context, output != nullptr);
+  if (output->dims->size != 0 || input->dims->size == 0) {
+    return kTfLiteOk;
+  }
+  const TfLiteEvalTensor* input_eval = GetEvalInput(context, node, 0);
+  TfLiteEvalTensor* output_eval = GetEvalOutput(context, node, 0);
+  TF_LITE_ENSURE(context, input_eval != nullptr);
+  TF_LITE_ENSURE(context, output_eval != nullptr);
+  output->dims = input_eval->dims;
+  output_eval->dims = input_eval->dims;
+  return TfLiteEvalTensorByteLength(output_eval, &output->bytes);
+}
+
 }  // namespace micro
 }  // namespace tflite
@@ -80,6 +80,13 @@ TfLiteStatus CreateWritableTensorDimsWithCopy(TfLiteContext* context,
                                               TfLiteTensor* tensor,
                                               TfLiteEvalTensor* eval_tensor);
 
+// Gives a shapeless single output the dims of the node's first input, for
+// element-wise ops whose converter left the output shape out.
+// Only use during Prepare phase.
+TfLiteStatus ShareInputDimsIfUnknown(TfLiteContext* context, TfLiteNode* node,
+                                     const TfLiteTensor* input,
+                                     TfLiteTensor* output);
+
 }  // namespace micro
 }  // namespace tflite
 
@@ -35,6 +35,8 @@ TfLiteRegistration Register_ADD_N();
 TfLiteRegistration Register_BATCH_TO_SPACE_ND();
 TfLiteRegistration Register_CAST();
 TfLiteRegistration Register_CONV_2D();
+// A CONV_2D and the MAX_POOL_2D of its output, see MicroGraph::FuseSubgraphs().
+TfLiteRegistration Register_CONV_2D_MAX_POOL_2D();
 TfLiteRegistration Register_CUMSUM();
 TfLiteRegistration Register_DEPTH_TO_SPACE();
 TfLiteRegistration Register_DEPTHWISE_CONV_2D();
@@ -37,6 +37,8 @@ TfLiteStatus PrepareQuantizeReference(TfLiteContext* context,
   TF_LITE_ENSURE(context, input != nullptr);
   TfLiteTensor* output = GetOutput(context, node, 0);
   TF_LITE_ENSURE(context, output != nullptr);
+  TF_LITE_ENSURE_OK(context, tflite::micro::ShareInputDimsIfUnknown(
+                                 context, node, input, output));
 
   // TODO(b/128934713): Add support for fixed-point per-channel quantization.
   // Currently this only support affine per-layer quantization.
@@ -52,6 +54,7 @@ TfLiteStatus PrepareQuantizeReference(TfLiteContext* context,
                               input->type == kTfLiteInt16 ||
                               input->type == kTfLiteInt8);
   TF_LITE_ENSURE(context, output->type == kTfLiteInt8 ||
+                              output->type == kTfLiteUInt8 ||
                               output->type == kTfLiteInt16 ||
                               output->type == kTfLiteInt32);
 
@@ -90,6 +93,15 @@ TfLiteStatus EvalQuantizeReference(TfLiteContext* context, TfLiteNode* node) {
             tflite::micro::GetTensorShape(output),
             tflite::micro::GetTensorData<int8_t>(output));
         break;
+      // Quantization-aware trained models fake-quantize their activations
+      // with a float -> uint8 QUANTIZE followed by a DEQUANTIZE.
+      case kTfLiteUInt8:
+        reference_ops::AffineQuantize(
+            data->quantization_params, tflite::micro::GetTensorShape(input),
+            tflite::micro::GetTensorData<float>(input),
+            tflite::micro::GetTensorShape(output),
+            tflite::micro::GetTensorData<uint8_t>(output));
+        break;
       case kTfLiteInt16:
         reference_ops::AffineQuantize(
             data->quantization_params, tflite::micro::GetTensorShape(input),
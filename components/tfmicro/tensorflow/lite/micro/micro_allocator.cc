@@ -17,6 +17,7 @@ limitations under the License.
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include "flatbuffers/flatbuffers.h"  // from @flatbuffers
 #include "tensorflow/lite/c/common.h"
@@ -167,8 +168,11 @@ class AllocationInfoBuilder {
   TfLiteStatus GetOfflinePlannedOffsets(
       const Model* model, const int32_t** offline_planner_offsets);
 
-  // Add allocaiton information for the tensors.
+  // Add allocaiton information for the tensors. Their lifetimes come from
+  // the nodes rather than the operators of the flatbuffer, which
+  // MicroGraph::FuseSubgraphs() may have rewritten.
   TfLiteStatus AddTensors(const SubGraph* subgraph,
+                          const NodeAndRegistration* node_and_registrations,
                           const int32_t* offline_offsets,
                           TfLiteEvalTensor* eval_tensors);
 
@@ -187,9 +191,9 @@ class AllocationInfoBuilder {
   ErrorReporter* reporter_ = nullptr;
 };
 
-TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
-                                               const int32_t* offline_offsets,
-                                               TfLiteEvalTensor* eval_tensors) {
+TfLiteStatus AllocationInfoBuilder::AddTensors(
+    const SubGraph* subgraph, const NodeAndRegistration* node_and_registrations,
+    const int32_t* offline_offsets, TfLiteEvalTensor* eval_tensors) {
   TFLITE_DCHECK(eval_tensors != nullptr);
 
   // Set up allocation info for all tensors.
@@ -226,20 +230,37 @@ TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
 
   // Figure out when the first and last use of each tensor is.
   for (int i = (subgraph->operators()->size() - 1); i >= 0; --i) {
-    const auto* op = subgraph->operators()->Get(i);
-    for (size_t n = 0; n < op->inputs()->size(); ++n) {
-      const int tensor_index = op->inputs()->Get(n);
+    const TfLiteNode& node = node_and_registrations[i].node;
+    for (int n = 0; n < node.inputs->size; ++n) {
+      const int tensor_index = node.inputs->data[n];
+      if (tensor_index < 0) {
+        continue;
+      }
       AllocationInfo* current = &info_[tensor_index];
       if (((current->last_used == -1) || (current->last_used < i))) {
         current->last_used = i;
       }
     }
-    for (size_t n = 0; n < op->outputs()->size(); ++n) {
-      const int tensor_index = op->outputs()->Get(n);
+    for (int n = 0; n < node.outputs->size; ++n) {
+      const int tensor_index = node.outputs->data[n];
       AllocationInfo* current = &info_[tensor_index];
       if ((current->first_created == -1) || (current->first_created > i)) {
         current->first_created = i;
       }
+      // Outputs no operator consumes must still live while their producer
+      // writes them, or the planner may overlay them on its inputs.
+      if (current->last_used < current->first_created) {
+        current->last_used = current->first_created;
+      }
+    }
+  }
+
+  // Tensors no node uses, such as the intermediate of fused nodes, take no
+  // room.
+  for (size_t i = 0; i < tensor_count_; ++i) {
+    AllocationInfo* current = &info_[i];
+    if (current->first_created == -1 && current->last_used == -1) {
+      current->needs_allocating = false;
     }
   }
   return kTfLiteOk;
@@ -340,6 +361,16 @@ TfLiteStatus CommitPlan(ErrorReporter* error_reporter, MemoryPlanner* planner,
   }
   return kTfLiteOk;
 }
+
+// TfLiteTensor structs are populated from the flatbuffer, whose shapes may no
+// longer be those of the TfLiteEvalTensor source of truth.
+void SyncTfLiteTensorDims(const TfLiteEvalTensor& eval_tensor,
+                          TfLiteTensor* tensor) {
+  if (eval_tensor.dims != nullptr && eval_tensor.dims != tensor->dims) {
+    tensor->dims = eval_tensor.dims;
+    TfLiteEvalTensorByteLength(&eval_tensor, &tensor->bytes);
+  }
+}
 }  // namespace
 
 namespace internal {
@@ -646,6 +677,7 @@ TfLiteStatus MicroAllocator::FinishModelAllocation(
         scratch_buffer_handles, scratch_buffer_request_count_));
     TF_LITE_ENSURE_STATUS(CommitStaticMemoryPlan(
         model, subgraph_allocations[subgraph_idx].tensors,
+        subgraph_allocations[subgraph_idx].node_and_registrations,
         *scratch_buffer_handles, subgraph_idx));
     TF_LITE_ENSURE_STATUS(AllocateVariables(
         subgraph, subgraph_allocations[subgraph_idx].tensors));
@@ -654,6 +686,141 @@ TfLiteStatus MicroAllocator::FinishModelAllocation(
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroAllocator::ResizeBatch(
+    const Model* model, SubgraphAllocations* subgraph_allocations,
+    int batch_size) {
+  TFLITE_DCHECK(subgraph_allocations != nullptr);
+  if (!model_is_allocating_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "MicroAllocator: Batch resized outside of a model "
+                         "allocation");
+    return kTfLiteError;
+  }
+  if (batch_size < 1) {
+    TF_LITE_REPORT_ERROR(error_reporter_, "Invalid batch size %d",
+                         batch_size);
+    return kTfLiteError;
+  }
+  if (batch_size == 1) {
+    return kTfLiteOk;
+  }
+  if (model->metadata()) {
+    for (size_t i = 0; i < model->metadata()->size(); ++i) {
+      if (strncmp(model->metadata()->Get(i)->name()->c_str(),
+                  kOfflineMemAllocMetadata,
+                  strlen(kOfflineMemAllocMetadata)) == 0) {
+        TF_LITE_REPORT_ERROR(error_reporter_,
+                             "Models with an offline memory plan cannot be "
+                             "run with a batch of %d",
+                             batch_size);
+        return kTfLiteError;
+      }
+    }
+  }
+
+  for (size_t subgraph_idx = 0; subgraph_idx < model->subgraphs()->size();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
+    TFLITE_DCHECK(subgraph != nullptr);
+    TfLiteEvalTensor* tensors = subgraph_allocations[subgraph_idx].tensors;
+
+    for (size_t i = 0; i < subgraph->tensors()->size(); ++i) {
+      // Constant tensors already point to their buffer in the flatbuffer.
+      TfLiteEvalTensor* tensor = &tensors[i];
+      if (tensor->data.data != nullptr ||
+          subgraph->tensors()->Get(i)->is_variable() ||
+          tensor->dims->size == 0) {
+        continue;
+      }
+      if (tensor->dims->data[0] != 1) {
+        TF_LITE_REPORT_ERROR(error_reporter_,
+                             "Tensor %d has no batch dimension to resize", i);
+        return kTfLiteError;
+      }
+      // The dims usually point into the read-only flatbuffer.
+      TfLiteIntArray* dims =
+          reinterpret_cast<TfLiteIntArray*>(memory_allocator_->AllocateFromTail(
+              TfLiteIntArrayGetSizeInBytes(tensor->dims->size),
+              alignof(TfLiteIntArray)));
+      if (dims == nullptr) {
+        TF_LITE_REPORT_ERROR(
+            error_reporter_,
+            "Failed to allocate memory for the dims of tensor %d", i);
+        return kTfLiteError;
+      }
+      dims->size = tensor->dims->size;
+      dims->data[0] = batch_size;
+      for (int d = 1; d < dims->size; ++d) {
+        dims->data[d] = tensor->dims->data[d];
+      }
+      tensor->dims = dims;
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroAllocator::PlaceConstantTensors(
+    const Model* model, SubgraphAllocations* subgraph_allocations,
+    const TensorPlacementPolicy& policy, uint8_t* buffer, size_t buffer_size,
+    TensorPlacementStats* stats) {
+  TFLITE_DCHECK(subgraph_allocations != nullptr);
+  TFLITE_DCHECK(stats != nullptr);
+  *stats = {};
+  if (!model_is_allocating_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "MicroAllocator: Tensors placed outside of a model "
+                         "allocation");
+    return kTfLiteError;
+  }
+
+  uint8_t* next = buffer;
+  uint8_t* end = buffer + buffer_size;
+  for (size_t subgraph_idx = 0; subgraph_idx < model->subgraphs()->size();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
+    TFLITE_DCHECK(subgraph != nullptr);
+    TfLiteEvalTensor* tensors = subgraph_allocations[subgraph_idx].tensors;
+
+    for (size_t i = 0; i < subgraph->tensors()->size(); ++i) {
+      TfLiteEvalTensor* tensor = &tensors[i];
+      if (tensor->data.data == nullptr) {
+        continue;
+      }
+      // The same buffer is only offered, and counted, once.
+      const uint32_t buffer_index = subgraph->tensors()->Get(i)->buffer();
+      size_t shared = i;
+      for (size_t j = 0; j < i && shared == i; ++j) {
+        if (tensors[j].data.data != nullptr &&
+            subgraph->tensors()->Get(j)->buffer() == buffer_index) {
+          shared = j;
+        }
+      }
+      if (shared != i) {
+        tensor->data.data = tensors[shared].data.data;
+        continue;
+      }
+
+      size_t bytes;
+      TF_LITE_ENSURE_STATUS(TfLiteEvalTensorByteLength(tensor, &bytes));
+      uint8_t* copy = AlignPointerUp(next, kBufferAlignment);
+      size_t free_bytes =
+          (next != nullptr && copy < end) ? static_cast<size_t>(end - copy) : 0;
+      if (bytes > free_bytes ||
+          !policy.ShouldPlace(subgraph_idx, i, bytes, free_bytes)) {
+        stats->model_count++;
+        stats->model_bytes += bytes;
+        continue;
+      }
+      std::memcpy(copy, tensor->data.data, bytes);
+      tensor->data.data = copy;
+      stats->placed_count++;
+      stats->placed_bytes += copy + bytes - next;
+      next = copy + bytes;
+    }
+  }
+  return kTfLiteOk;
+}
+
 void* MicroAllocator::AllocatePersistentBuffer(size_t bytes) {
   return memory_allocator_->AllocateFromTail(bytes, kBufferAlignment);
 }
@@ -733,6 +900,13 @@ size_t MicroAllocator::used_bytes() const {
   return memory_allocator_->GetUsedBytes();
 }
 
+void MicroAllocator::GetArenaBounds(uint8_t** head, uint8_t** persistent,
+                                    uint8_t** tail) const {
+  *head = memory_allocator_->GetHeadBuffer();
+  *tail = memory_allocator_->GetBufferTail();
+  *persistent = *tail - memory_allocator_->GetTailUsedBytes();
+}
+
 TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
     const Model* model, SubgraphAllocations* subgraph_allocations) {
   TFLITE_DCHECK(subgraph_allocations != nullptr);
@@ -784,8 +958,10 @@ TfLiteTensor* MicroAllocator::AllocatePersistentTfLiteTensor(
     // and not located in the flatbuffer are stored on the pre-allocated list of
     // TfLiteEvalTensors structs. These structs are the source of truth, simply
     // point the corresponding buffer to the new TfLiteTensor data value.
-    tensor->data.data =
-        subgraph_allocations[subgraph_index].tensors[tensor_index].data.data;
+    const TfLiteEvalTensor& eval_tensor =
+        subgraph_allocations[subgraph_index].tensors[tensor_index];
+    tensor->data.data = eval_tensor.data.data;
+    SyncTfLiteTensorDims(eval_tensor, tensor);
   }
   return tensor;
 }
@@ -820,8 +996,13 @@ TfLiteTensor* MicroAllocator::AllocateTempTfLiteTensor(
     // and not located in the flatbuffer are stored on the pre-allocated list of
     // TfLiteEvalTensors structs. These structs are the source of truth, simply
     // point the corresponding buffer to the new TfLiteTensor data value.
-    tensor->data.data =
-        subgraph_allocations[subgraph_index].tensors[tensor_index].data.data;
+    const TfLiteEvalTensor& eval_tensor =
+        subgraph_allocations[subgraph_index].tensors[tensor_index];
+    tensor->data.data = eval_tensor.data.data;
+    // Kernels may have relocated the dims of an upstream output during
+    // Prepare, and ResizeBatch() those of the activations, keep the temp
+    // struct consistent with them.
+    SyncTfLiteTensorDims(eval_tensor, tensor);
   }
   return tensor;
 }
@@ -912,6 +1093,7 @@ ErrorReporter* MicroAllocator::error_reporter() const {
 
 TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
     const Model* model, TfLiteEvalTensor* eval_tensors,
+    const NodeAndRegistration* node_and_registrations,
     ScratchBufferHandle* scratch_buffer_handles, int subgraph_idx) {
   size_t head_usage = 0;
   // Create static memory plan
@@ -950,7 +1132,8 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
   TF_LITE_ENSURE_STATUS(
       builder.GetOfflinePlannedOffsets(model, &offline_planner_offsets));
   TF_LITE_ENSURE_STATUS(
-      builder.AddTensors(subgraph, offline_planner_offsets, eval_tensors));
+      builder.AddTensors(subgraph, node_and_registrations,
+                         offline_planner_offsets, eval_tensors));
 
   internal::ScratchBufferRequest* scratch_buffer_requests =
       GetScratchBufferRequests();
@@ -24,6 +24,7 @@ limitations under the License.
 #include "tensorflow/lite/core/api/flatbuffer_conversions.h"
 #include "tensorflow/lite/micro/compatibility.h"
 #include "tensorflow/lite/micro/simple_memory_allocator.h"
+#include "tensorflow/lite/micro/tensor_placement.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
 namespace tflite {
@@ -148,6 +149,33 @@ class MicroAllocator {
       const Model* model, SubgraphAllocations* subgraph_allocations,
       ScratchBufferHandle** scratch_buffer_handles);
 
+  // Sets the first dimension of every tensor computed at runtime to
+  // batch_size, so that each invoke runs batch_size inputs at once. The
+  // tensors must be batched along their first dimension, of 1 in the model.
+  // Constant and variable tensors keep their shape.
+  //
+  // This method should be called between StartModelAllocation() and the
+  // preparation of the kernels, which size their outputs from these shapes.
+  // The resized shapes are allocated from the tail of the arena. Models with
+  // an offline memory plan cannot be resized, the plan only holds for their
+  // own shapes.
+  TfLiteStatus ResizeBatch(const Model* model,
+                           SubgraphAllocations* subgraph_allocations,
+                           int batch_size);
+
+  // Copies the constant tensors the policy selects into buffer, outside of
+  // the arena, and points their TfLiteEvalTensor data at the copies. The
+  // others keep pointing into the model. Tensors sharing a buffer of the
+  // model share the copy. Fills stats with the resulting placement.
+  //
+  // This method should be called between StartModelAllocation() and the
+  // preparation of the kernels, so that they only ever see the copies.
+  TfLiteStatus PlaceConstantTensors(const Model* model,
+                                    SubgraphAllocations* subgraph_allocations,
+                                    const TensorPlacementPolicy& policy,
+                                    uint8_t* buffer, size_t buffer_size,
+                                    TensorPlacementStats* stats);
+
   // Allocates a TfLiteTensor struct and populates the returned value with
   // properties from the model flatbuffer. This struct is allocated from
   // persistent arena memory is only guaranteed for the lifetime of the
@@ -196,6 +224,15 @@ class MicroAllocator {
   // `FinishModelAllocation`. Otherwise, it will return 0.
   size_t used_bytes() const;
 
+  // Returns the bounds of the arena, [head, tail), and of its persistent
+  // section, [persistent, tail): the allocations from the tail, which outlive
+  // the allocation of the model, along with this allocator itself. The head
+  // only holds data the planner can overwrite, so an allocated model is
+  // entirely restored, in an arena at the same address, by restoring its
+  // persistent section.
+  void GetArenaBounds(uint8_t** head, uint8_t** persistent,
+                      uint8_t** tail) const;
+
   // Converts a flatbuffer int32_t array to a TfLiteIntArray, accounting for
   // endiannes.
   TfLiteStatus FlatBufferVectorToTfLiteTypeArray(
@@ -245,11 +282,13 @@ class MicroAllocator {
   // 'head' section of the memory arena. The eval_tensors pointer is the list of
   // pre-allocated TfLiteEvalTensor structs that will point to the buffers that
   // will be allocated into the head section in this function call. The
-  // scratch_buffer_handles pointer is the array of pre-allocated
+  // lifetimes of the tensors come from the nodes of node_and_registrations.
+  // The scratch_buffer_handles pointer is the array of pre-allocated
   // ScratchBufferHandle structs that will point to allocated buffers also in
   // the head section.
   virtual TfLiteStatus CommitStaticMemoryPlan(
       const Model* model, TfLiteEvalTensor* eval_tensors,
+      const NodeAndRegistration* node_and_registrations,
       ScratchBufferHandle* scratch_buffer_handles, int subgraph_idx);
 
   // Allocates an array of ScratchBufferHandle structs in the tail section for a
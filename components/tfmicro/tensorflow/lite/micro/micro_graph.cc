@@ -15,6 +15,8 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/micro_graph.h"
 
+#include <cstring>
+
 #include "flatbuffers/flatbuffers.h"  // from @flatbuffers
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/compatibility.h"
@@ -36,6 +38,85 @@ const char* OpNameFromRegistration(const TfLiteRegistration* registration) {
 }
 #endif  // !defined(TF_LITE_STRIP_ERROR_STRINGS)
 
+// A chain of two builtin operators, the second one reading the single output
+// of the first one, and the name of the custom operator fusing them.
+struct OperatorFusion {
+  BuiltinOperator first;
+  BuiltinOperator second;
+  const char* name;
+};
+
+constexpr OperatorFusion kOperatorFusions[] = {
+    {BuiltinOperator_CONV_2D, BuiltinOperator_MAX_POOL_2D,
+     kConv2DMaxPool2DOpName},
+};
+
+// As in MicroAllocator.
+constexpr char kOfflineMemAllocMetadata[] = "OfflineMemoryAllocation";
+
+TfLiteStatus InvokeFusedNode(TfLiteContext* context, TfLiteNode* node) {
+  (void)context;
+  (void)node;
+  return kTfLiteOk;
+}
+
+// Registration of the nodes a fused node runs along with its own.
+const TfLiteRegistration kFusedNodeRegistration = {
+    /*init=*/nullptr,
+    /*free=*/nullptr,
+    /*prepare=*/nullptr,
+    /*invoke=*/InvokeFusedNode,
+    /*profiling_string=*/nullptr,
+    /*builtin_code=*/BuiltinOperator_CUSTOM,
+    /*custom_name=*/"FUSED",
+    /*version=*/0};
+
+bool HasOfflinePlan(const Model* model) {
+  if (model->metadata() == nullptr) {
+    return false;
+  }
+  for (size_t i = 0; i < model->metadata()->size(); ++i) {
+    if (strncmp(model->metadata()->Get(i)->name()->c_str(),
+                kOfflineMemAllocMetadata,
+                strlen(kOfflineMemAllocMetadata)) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Whether nodes[index] and nodes[index + 1] are the chain of fusion, and no
+// other node nor the subgraph outputs read the intermediate tensor.
+bool CanFuse(const SubGraph* subgraph, const NodeAndRegistration* nodes,
+             size_t node_count, size_t index, const OperatorFusion& fusion) {
+  const NodeAndRegistration& first = nodes[index];
+  const NodeAndRegistration& second = nodes[index + 1];
+  if (first.registration->builtin_code != fusion.first ||
+      second.registration->builtin_code != fusion.second ||
+      first.node.outputs->size != 1 || second.node.inputs->size != 1 ||
+      second.node.inputs->data[0] != first.node.outputs->data[0]) {
+    return false;
+  }
+  const int intermediate = first.node.outputs->data[0];
+  for (size_t i = 0; i < subgraph->outputs()->size(); ++i) {
+    if (subgraph->outputs()->Get(i) == intermediate) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < node_count; ++i) {
+    if (i == index + 1) {
+      continue;
+    }
+    const TfLiteIntArray* inputs = nodes[i].node.inputs;
+    for (int n = 0; n < inputs->size; ++n) {
+      if (inputs->data[n] == intermediate) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 }  // namespace
 
 MicroGraph::MicroGraph(TfLiteContext* context, const Model* model,
@@ -51,6 +132,56 @@ MicroGraph::MicroGraph(TfLiteContext* context, const Model* model,
 
 MicroGraph::~MicroGraph() {}
 
+TfLiteStatus MicroGraph::FuseSubgraphs(const MicroOpResolver& op_resolver) {
+  if (HasOfflinePlan(model_)) {
+    return kTfLiteOk;
+  }
+
+  for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
+       subgraph_idx++) {
+    const SubGraph* subgraph = (*subgraphs_)[subgraph_idx];
+    NodeAndRegistration* nodes =
+        subgraph_allocations_[subgraph_idx].node_and_registrations;
+    const size_t node_count = subgraph->operators()->size();
+    for (size_t i = 0; i + 1 < node_count; ++i) {
+      for (const OperatorFusion& fusion : kOperatorFusions) {
+        if (!CanFuse(subgraph, nodes, node_count, i, fusion)) {
+          continue;
+        }
+        const TfLiteRegistration* registration =
+            op_resolver.FindOp(fusion.name);
+        if (registration == nullptr) {
+          continue;
+        }
+
+        TfLiteNode* chain = reinterpret_cast<TfLiteNode*>(
+            allocator_->AllocatePersistentBuffer(2 * sizeof(TfLiteNode)));
+        TfLiteIntArray* no_tensors = reinterpret_cast<TfLiteIntArray*>(
+            allocator_->AllocatePersistentBuffer(
+                TfLiteIntArrayGetSizeInBytes(0)));
+        // The allocator reports the arena running out.
+        if (chain == nullptr || no_tensors == nullptr) {
+          return kTfLiteError;
+        }
+        chain[0] = nodes[i].node;
+        chain[1] = nodes[i + 1].node;
+        no_tensors->size = 0;
+
+        nodes[i].registration = registration;
+        nodes[i].node.outputs = chain[1].outputs;
+        nodes[i].node.custom_initial_data = chain;
+        nodes[i].node.custom_initial_data_size = 2 * sizeof(TfLiteNode);
+        nodes[i + 1].registration = &kFusedNodeRegistration;
+        nodes[i + 1].node.inputs = no_tensors;
+        nodes[i + 1].node.outputs = no_tensors;
+        ++i;
+        break;
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroGraph::InitSubgraphs() {
   int previous_subgraph_idx = current_subgraph_index_;
 
@@ -160,6 +291,9 @@ TfLiteStatus MicroGraph::InvokeSubgraph(int subgraph_idx) {
     const TfLiteRegistration* registration = subgraph_allocations_[subgraph_idx]
                                                  .node_and_registrations[i]
                                                  .registration;
+    if (registration == &kFusedNodeRegistration) {
+      continue;
+    }
 
 // This ifdef is needed (even though ScopedMicroProfiler itself is a no-op with
 // -DTF_LITE_STRIP_ERROR_STRINGS) because the function OpNameFromRegistration is
@@ -191,6 +325,101 @@ TfLiteStatus MicroGraph::InvokeSubgraph(int subgraph_idx) {
   return kTfLiteOk;
 }
 
+size_t MicroGraph::NumInvokedNodes(int subgraph_idx) const {
+  const size_t node_count = (*subgraphs_)[subgraph_idx]->operators()->size();
+  const NodeAndRegistration* nodes =
+      subgraph_allocations_[subgraph_idx].node_and_registrations;
+  size_t invoked_node_count = 0;
+  for (size_t i = 0; i < node_count; ++i) {
+    if (nodes[i].registration != &kFusedNodeRegistration) {
+      ++invoked_node_count;
+    }
+  }
+  return invoked_node_count;
+}
+
+TfLiteStatus MicroGraph::FreezeSubgraph(int subgraph_idx) {
+  if (static_cast<size_t>(subgraph_idx) >= subgraphs_->size()) {
+    MicroPrintf("Accessing subgraph %d but only %d subgraphs found",
+                subgraph_idx, subgraphs_->size());
+    return kTfLiteError;
+  }
+  const size_t node_count = (*subgraphs_)[subgraph_idx]->operators()->size();
+  FrozenNode* frozen_nodes = reinterpret_cast<FrozenNode*>(
+      allocator_->AllocatePersistentBuffer(sizeof(FrozenNode) * node_count));
+  // The allocator reports the arena running out.
+  if (frozen_nodes == nullptr) {
+    return kTfLiteError;
+  }
+  size_t frozen_node_count = 0;
+  for (size_t i = 0; i < node_count; ++i) {
+    NodeAndRegistration* node_and_registration =
+        &subgraph_allocations_[subgraph_idx].node_and_registrations[i];
+    if (node_and_registration->registration == &kFusedNodeRegistration) {
+      continue;
+    }
+    TFLITE_DCHECK(node_and_registration->registration->invoke);
+    frozen_nodes[frozen_node_count].invoke =
+        node_and_registration->registration->invoke;
+    frozen_nodes[frozen_node_count].node = &node_and_registration->node;
+    ++frozen_node_count;
+  }
+  frozen_nodes_ = frozen_nodes;
+  frozen_node_count_ = frozen_node_count;
+  frozen_subgraph_index_ = subgraph_idx;
+  return kTfLiteOk;
+}
+
+void MicroGraph::GetFrozenSubgraph(FrozenNode** nodes, size_t* node_count,
+                                   int* subgraph_idx) const {
+  *nodes = frozen_nodes_;
+  *node_count = frozen_node_count_;
+  *subgraph_idx = frozen_subgraph_index_;
+}
+
+void MicroGraph::SetFrozenSubgraph(FrozenNode* nodes, size_t node_count,
+                                   int subgraph_idx) {
+  frozen_nodes_ = nodes;
+  frozen_node_count_ = node_count;
+  frozen_subgraph_index_ = subgraph_idx;
+}
+
+TfLiteStatus MicroGraph::InvokeFrozenSubgraph() {
+  int previous_subgraph_idx = current_subgraph_index_;
+  current_subgraph_index_ = frozen_subgraph_index_;
+
+  const FrozenNode* end = frozen_nodes_ + frozen_node_count_;
+  for (const FrozenNode* frozen_node = frozen_nodes_; frozen_node < end;
+       ++frozen_node) {
+    TfLiteStatus invoke_status =
+        frozen_node->invoke(context_, frozen_node->node);
+
+    // Kernels may still allocate TfLiteTensor structs from temp memory.
+    allocator_->ResetTempAllocations();
+
+    if (invoke_status != kTfLiteOk) {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+      // Fused nodes are not frozen, find the node's index in the subgraph.
+      const NodeAndRegistration* nodes =
+          subgraph_allocations_[frozen_subgraph_index_].node_and_registrations;
+      size_t i = 0;
+      while (&nodes[i].node != frozen_node->node) {
+        ++i;
+      }
+      if (invoke_status == kTfLiteError) {
+        MicroPrintf("Node %s (number %d) failed to invoke with status %d",
+                    OpNameFromRegistration(nodes[i].registration), i,
+                    invoke_status);
+      }
+#endif
+      current_subgraph_index_ = previous_subgraph_idx;
+      return invoke_status;
+    }
+  }
+  current_subgraph_index_ = previous_subgraph_idx;
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroGraph::ResetVariableTensors() {
   for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
        subgraph_idx++) {
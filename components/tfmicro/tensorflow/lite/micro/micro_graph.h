@@ -18,10 +18,22 @@ limitations under the License.
 
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
 namespace tflite {
 
+// Name under which an op resolver provides the kernel FuseSubgraphs() runs a
+// CONV_2D and the MAX_POOL_2D of its output with.
+constexpr char kConv2DMaxPool2DOpName[] = "CONV_2D_MAX_POOL_2D";
+
+// One operator of a frozen subgraph: all InvokeFrozenSubgraph() needs to run
+// it. The kernel's user_data is reached through the node.
+struct FrozenNode {
+  TfLiteStatus (*invoke)(TfLiteContext* context, TfLiteNode* node);
+  TfLiteNode* node;
+};
+
 // Abstracts the details of interacting with the tflite::Model.
 //
 // Provides methods to access, initialize, prepare, invoke and free any
@@ -35,6 +47,17 @@ class MicroGraph {
              MicroAllocator* allocator);
   virtual ~MicroGraph();
 
+  // Replaces each chain of two operators that op_resolver has a fused kernel
+  // for, and whose intermediate tensor nothing else reads, with one node
+  // running that kernel. The fused node has the inputs of the first node,
+  // the outputs of the second one, the builtin data of the first one and, as
+  // custom initial data, the two nodes as they were. The second node is left
+  // without inputs or outputs and is no longer invoked, so the intermediate
+  // tensor is never allocated. Called before InitSubgraphs(). Models with an
+  // offline memory plan are left as they are, the plan is for their
+  // operators.
+  TfLiteStatus FuseSubgraphs(const MicroOpResolver& op_resolver);
+
   // Sets up builtin data and calls TfLiteRegistration->Init for every operator
   // in every subgraph in the model.
   virtual TfLiteStatus InitSubgraphs();
@@ -51,6 +74,29 @@ class MicroGraph {
   // the model.
   virtual TfLiteStatus InvokeSubgraph(int subgraph_idx);
 
+  // Number of nodes InvokeSubgraph() runs in a subgraph: its operators less
+  // the ones FuseSubgraphs() merged into the node before them.
+  size_t NumInvokedNodes(int subgraph_idx) const;
+
+  // Flattens the operators of an allocated subgraph into an array of their
+  // invoke functions and nodes, allocated from the arena, for
+  // InvokeFrozenSubgraph(). The graph must not change afterwards.
+  TfLiteStatus FreezeSubgraph(int subgraph_idx);
+
+  // Runs the frozen subgraph like InvokeSubgraph() does, without going
+  // through the model's flatbuffer or the profiler for each operator.
+  TfLiteStatus InvokeFrozenSubgraph();
+
+  // Whether FreezeSubgraph() has succeeded.
+  bool IsFrozen() const { return frozen_nodes_ != nullptr; }
+
+  // The frozen subgraph, to restore it along with the arena its nodes are
+  // allocated from. Nodes are nullptr while the graph is not frozen.
+  void GetFrozenSubgraph(FrozenNode** nodes, size_t* node_count,
+                         int* subgraph_idx) const;
+  void SetFrozenSubgraph(FrozenNode* nodes, size_t node_count,
+                         int subgraph_idx);
+
   // Zeros out all variable tensors in all subgraphs in the model.
   virtual TfLiteStatus ResetVariableTensors();
 
@@ -79,7 +125,7 @@ class MicroGraph {
 
   // Gets the list of alloctions for each subgraph. This is the source of truth
   // for all per-subgraph allocation data.
-  SubgraphAllocations* GetAllocations() { return subgraph_allocations_; }
+  SubgraphAllocations* GetAllocations() const { return subgraph_allocations_; }
 
  private:
   TfLiteContext* context_;
@@ -88,6 +134,9 @@ class MicroGraph {
   SubgraphAllocations* subgraph_allocations_ = nullptr;
   int current_subgraph_index_;
   const flatbuffers::Vector<flatbuffers::Offset<SubGraph>>* subgraphs_;
+  FrozenNode* frozen_nodes_ = nullptr;
+  size_t frozen_node_count_ = 0;
+  int frozen_subgraph_index_ = 0;
 
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
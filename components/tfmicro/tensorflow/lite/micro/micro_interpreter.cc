@@ -17,6 +17,7 @@ limitations under the License.
 #include <cstdarg>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include "flatbuffers/flatbuffers.h"  // from @flatbuffers
 #include "tensorflow/lite/c/common.h"
@@ -31,6 +32,57 @@ limitations under the License.
 #include "tensorflow/lite/schema/schema_utils.h"
 
 namespace tflite {
+namespace {
+
+// "TFMS", then the version of the layout below.
+constexpr uint32_t kSavedStateMagic = 0x534d4654;
+constexpr uint32_t kSavedStateVersion = 1;
+
+// Header of a saved state, followed by the persistent section of the arena
+// and the placed constant tensors.
+struct SavedStateHeader {
+  uint32_t magic;
+  uint32_t version;
+  // FNV-1a of everything after it, the storage may not keep it intact.
+  uint32_t checksum;
+  uint32_t total_bytes;
+  uint64_t key;
+  // What the state points to, which must not have moved.
+  const void* interpreter;
+  const void* model;
+  const void* op_resolver;
+  const void* arena_head;
+  const void* arena_tail;
+  const void* placement_policy;
+  const void* placement_buffer;
+  uint32_t placement_buffer_size;
+  uint32_t interpreter_bytes;
+  int32_t batch_size;
+  uint32_t persistent_bytes;
+  uint32_t placement_bytes;
+  // The interpreter's own pointers into the arena.
+  SubgraphAllocations* allocations;
+  ScratchBufferHandle* scratch_buffer_handles;
+  TfLiteTensor** input_tensors;
+  TfLiteTensor** output_tensors;
+  FrozenNode* frozen_nodes;
+  uint32_t frozen_node_count;
+  int32_t frozen_subgraph_index;
+  TensorPlacementStats placement_stats;
+};
+
+constexpr size_t kChecksumEnd =
+    offsetof(SavedStateHeader, checksum) + sizeof(uint32_t);
+
+uint32_t SavedStateChecksum(const uint8_t* state, size_t total_bytes) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = kChecksumEnd; i < total_bytes; ++i) {
+    hash = (hash ^ state[i]) * 16777619u;
+  }
+  return hash;
+}
+
+}  // namespace
 
 MicroInterpreter::MicroInterpreter(const Model* model,
                                    const MicroOpResolver& op_resolver,
@@ -190,7 +242,17 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
 
   graph_.SetSubgraphAllocations(allocations);
 
+  TF_LITE_ENSURE_STATUS(
+      allocator_.ResizeBatch(model_, allocations, batch_size_));
+  if (tensor_placement_policy_ != nullptr) {
+    TF_LITE_ENSURE_STATUS(allocator_.PlaceConstantTensors(
+        model_, allocations, *tensor_placement_policy_,
+        tensor_placement_buffer_, tensor_placement_buffer_size_,
+        &tensor_placement_stats_));
+  }
+
   TF_LITE_ENSURE_STATUS(PrepareNodeAndRegistrationDataFromFlatbuffer());
+  TF_LITE_ENSURE_STATUS(graph_.FuseSubgraphs(op_resolver_));
 
   // Only allow AllocatePersistentBuffer in Init stage.
   context_.AllocatePersistentBuffer = AllocatePersistentBuffer;
@@ -268,6 +330,35 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroInterpreter::SetBatchSize(int batch_size) {
+  if (tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "SetBatchSize() called after AllocateTensors()\n");
+    return kTfLiteError;
+  }
+  if (batch_size < 1) {
+    TF_LITE_REPORT_ERROR(error_reporter_, "Invalid batch size %d\n",
+                         batch_size);
+    return kTfLiteError;
+  }
+  batch_size_ = batch_size;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::SetTensorPlacement(
+    const TensorPlacementPolicy* policy, uint8_t* buffer, size_t buffer_size) {
+  if (tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(
+        error_reporter_,
+        "SetTensorPlacement() called after AllocateTensors()\n");
+    return kTfLiteError;
+  }
+  tensor_placement_policy_ = policy;
+  tensor_placement_buffer_ = buffer;
+  tensor_placement_buffer_size_ = buffer_size;
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroInterpreter::Invoke() {
   if (initialization_status_ != kTfLiteOk) {
     TF_LITE_REPORT_ERROR(error_reporter_,
@@ -280,9 +371,160 @@ TfLiteStatus MicroInterpreter::Invoke() {
   if (!tensors_allocated_) {
     TF_LITE_ENSURE_OK(&context_, AllocateTensors());
   }
+  if (graph_.IsFrozen() && context_.profiler == nullptr) {
+    return graph_.InvokeFrozenSubgraph();
+  }
   return graph_.InvokeSubgraph(0);
 }
 
+TfLiteStatus MicroInterpreter::FreezeGraph() {
+  if (!tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "FreezeGraph() called before AllocateTensors()\n");
+    return kTfLiteError;
+  }
+  if (graph_.IsFrozen()) {
+    return kTfLiteOk;
+  }
+  return graph_.FreezeSubgraph(0);
+}
+
+size_t MicroInterpreter::SavedStateSize() const {
+  if (!tensors_allocated_) {
+    return 0;
+  }
+  uint8_t* head;
+  uint8_t* persistent;
+  uint8_t* tail;
+  allocator_.GetArenaBounds(&head, &persistent, &tail);
+  return sizeof(SavedStateHeader) + (tail - persistent) +
+         tensor_placement_stats_.placed_bytes;
+}
+
+TfLiteStatus MicroInterpreter::SaveState(uint8_t* buffer, size_t buffer_size,
+                                         uint64_t key) const {
+  const size_t total_bytes = SavedStateSize();
+  if (total_bytes == 0) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "SaveState() called before AllocateTensors()\n");
+    return kTfLiteError;
+  }
+  if (buffer_size < total_bytes) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Saved state needs %d bytes, only %d available",
+                         total_bytes, buffer_size);
+    return kTfLiteError;
+  }
+
+  uint8_t* head;
+  uint8_t* persistent;
+  uint8_t* tail;
+  allocator_.GetArenaBounds(&head, &persistent, &tail);
+  SavedStateHeader header = {};
+  header.magic = kSavedStateMagic;
+  header.version = kSavedStateVersion;
+  header.total_bytes = total_bytes;
+  header.key = key;
+  header.interpreter = this;
+  header.model = model_;
+  header.op_resolver = &op_resolver_;
+  header.arena_head = head;
+  header.arena_tail = tail;
+  header.placement_policy = tensor_placement_policy_;
+  header.placement_buffer = tensor_placement_buffer_;
+  header.placement_buffer_size = tensor_placement_buffer_size_;
+  header.interpreter_bytes = sizeof(*this);
+  header.batch_size = batch_size_;
+  header.persistent_bytes = tail - persistent;
+  header.placement_bytes = tensor_placement_stats_.placed_bytes;
+  header.allocations = graph_.GetAllocations();
+  header.scratch_buffer_handles = scratch_buffer_handles_;
+  header.input_tensors = input_tensors_;
+  header.output_tensors = output_tensors_;
+  size_t frozen_node_count;
+  int frozen_subgraph_index;
+  graph_.GetFrozenSubgraph(&header.frozen_nodes, &frozen_node_count,
+                           &frozen_subgraph_index);
+  header.frozen_node_count = frozen_node_count;
+  header.frozen_subgraph_index = frozen_subgraph_index;
+  header.placement_stats = tensor_placement_stats_;
+
+  uint8_t* next = buffer;
+  std::memcpy(next, &header, sizeof(header));
+  next += sizeof(header);
+  std::memcpy(next, persistent, header.persistent_bytes);
+  next += header.persistent_bytes;
+  std::memcpy(next, tensor_placement_buffer_, header.placement_bytes);
+
+  header.checksum = SavedStateChecksum(buffer, total_bytes);
+  std::memcpy(buffer + offsetof(SavedStateHeader, checksum), &header.checksum,
+              sizeof(header.checksum));
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::RestoreState(const uint8_t* buffer,
+                                            size_t buffer_size, uint64_t key) {
+  if (tensors_allocated_ || initialization_status_ != kTfLiteOk) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "RestoreState() called after AllocateTensors()\n");
+    return kTfLiteError;
+  }
+  SavedStateHeader header;
+  if (buffer_size < sizeof(header)) {
+    return kTfLiteError;
+  }
+  std::memcpy(&header, buffer, sizeof(header));
+  if (header.magic != kSavedStateMagic ||
+      header.version != kSavedStateVersion ||
+      header.total_bytes > buffer_size ||
+      header.total_bytes != sizeof(header) + header.persistent_bytes +
+                                static_cast<size_t>(header.placement_bytes) ||
+      header.checksum != SavedStateChecksum(buffer, header.total_bytes)) {
+    return kTfLiteError;
+  }
+
+  // Only the allocators have been allocated from the tail so far, at the
+  // same place as when the state was saved.
+  uint8_t* head;
+  uint8_t* persistent;
+  uint8_t* tail;
+  allocator_.GetArenaBounds(&head, &persistent, &tail);
+  if (header.key != key || header.interpreter != this ||
+      header.model != model_ || header.op_resolver != &op_resolver_ ||
+      header.arena_head != head || header.arena_tail != tail ||
+      header.placement_policy != tensor_placement_policy_ ||
+      header.placement_buffer != tensor_placement_buffer_ ||
+      header.placement_buffer_size != tensor_placement_buffer_size_ ||
+      header.interpreter_bytes != sizeof(*this) ||
+      header.batch_size != batch_size_ ||
+      header.persistent_bytes < static_cast<size_t>(tail - persistent) ||
+      header.persistent_bytes > static_cast<size_t>(tail - head) ||
+      header.placement_bytes > tensor_placement_buffer_size_) {
+    return kTfLiteError;
+  }
+
+  const uint8_t* next = buffer + sizeof(header);
+  std::memcpy(tail - header.persistent_bytes, next, header.persistent_bytes);
+  next += header.persistent_bytes;
+  std::memcpy(tensor_placement_buffer_, next, header.placement_bytes);
+
+  graph_.SetSubgraphAllocations(header.allocations);
+  graph_.SetFrozenSubgraph(header.frozen_nodes, header.frozen_node_count,
+                           header.frozen_subgraph_index);
+  scratch_buffer_handles_ = header.scratch_buffer_handles;
+  input_tensors_ = header.input_tensors;
+  output_tensors_ = header.output_tensors;
+  tensor_placement_stats_ = header.placement_stats;
+
+  // As AllocateTensors() leaves the context, ready for Invoke().
+  context_.AllocatePersistentBuffer = nullptr;
+  context_.RequestScratchBufferInArena = nullptr;
+  context_.GetScratchBuffer = GetScratchBuffer;
+  context_.GetExecutionPlan = GetGraph;
+  tensors_allocated_ = true;
+  return kTfLiteOk;
+}
+
 TfLiteTensor* MicroInterpreter::input(size_t index) {
   const size_t length = inputs_size();
   if (index >= length) {
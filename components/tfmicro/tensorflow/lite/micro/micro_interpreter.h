@@ -26,6 +26,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_graph.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/tensor_placement.h"
 #include "tensorflow/lite/portable_type_to_tflitetype.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
@@ -64,11 +65,60 @@ class MicroInterpreter {
   // intermediate tensors.
   TfLiteStatus AllocateTensors();
 
+  // Runs batch_size inputs per Invoke(), stacked along the first dimension
+  // of the input and output tensors, instead of the model's batch of 1. The
+  // weights are then read once per batch. Must be called before
+  // AllocateTensors(), see MicroAllocator::ResizeBatch() for the models that
+  // can be resized. The activations take batch_size times their arena.
+  TfLiteStatus SetBatchSize(int batch_size);
+  int batch_size() const { return batch_size_; }
+
+  // Copies the weights and biases the policy selects from the model into
+  // buffer at AllocateTensors(), so that the kernels read them from there:
+  // a region of faster memory than the one holding the model. The buffer is
+  // used from its first 16 bytes aligned address, and must live as long as
+  // the interpreter. Must be called before AllocateTensors().
+  TfLiteStatus SetTensorPlacement(const TensorPlacementPolicy* policy,
+                                  uint8_t* buffer, size_t buffer_size);
+  // Where the constant tensors are, once allocated.
+  const TensorPlacementStats& tensor_placement_stats() const {
+    return tensor_placement_stats_;
+  }
+
   // In order to support partial graph runs for strided models, this can return
   // values other than kTfLiteOk and kTfLiteError.
   // TODO(b/149795762): Add this to the TfLiteStatus enum.
   TfLiteStatus Invoke();
 
+  // Switches Invoke() to a dispatch table of the operators built from the
+  // allocated model, see MicroGraph::FreezeSubgraph(). It costs a pointer to
+  // a function and one to a node per operator in the arena. Interpreters
+  // with a profiler keep the regular path, which times each operator.
+  TfLiteStatus FreezeGraph();
+
+  // Bytes SaveState() writes, once the tensors are allocated.
+  size_t SavedStateSize() const;
+
+  // Saves what AllocateTensors(), and FreezeGraph(), leave behind into
+  // buffer: the persistent section of the arena, the placed constant
+  // tensors and the interpreter's pointers into them. Neither the model nor
+  // the tensor data are saved, and the state holds pointers to the arena,
+  // the model, the op resolver and the kernels. key must identify the
+  // contents of the model and the build of the application, the interpreter
+  // only records the addresses.
+  TfLiteStatus SaveState(uint8_t* buffer, size_t buffer_size,
+                         uint64_t key) const;
+
+  // Restores the state SaveState() saved instead of calling
+  // AllocateTensors(), without parsing the model, planning the arena or
+  // preparing the kernels. Must be called by an interpreter at the same
+  // address, over the same model and arena, with the same op resolver,
+  // batch size and tensor placement as the one that saved it. Fails, and
+  // leaves the interpreter as it was, otherwise or if the state is
+  // corrupted.
+  TfLiteStatus RestoreState(const uint8_t* buffer, size_t buffer_size,
+                            uint64_t key);
+
   TfLiteTensor* input(size_t index);
   size_t inputs_size() const {
     return model_->subgraphs()->Get(0)->inputs()->size();
@@ -114,6 +164,13 @@ class MicroInterpreter {
     return model_->subgraphs()->Get(0)->operators()->size();
   }
 
+  // Number of operators an invoke runs, and times when it has a profiler:
+  // operators_size() less the ones fused into the operator before them.
+  // Only known once the tensors are allocated.
+  size_t invoked_operators_size() const {
+    return graph_.NumInvokedNodes(0);
+  }
+
   // Populates node and registration pointers representing the inference graph
   // of the model from values inside the flatbuffer (loaded from the TfLiteModel
   // instance). Persistent data (e.g. operator data) is allocated from the
@@ -162,6 +219,11 @@ class MicroInterpreter {
   MicroAllocator& allocator_;
   MicroGraph graph_;
   bool tensors_allocated_;
+  int batch_size_ = 1;
+  const TensorPlacementPolicy* tensor_placement_policy_ = nullptr;
+  uint8_t* tensor_placement_buffer_ = nullptr;
+  size_t tensor_placement_buffer_size_ = 0;
+  TensorPlacementStats tensor_placement_stats_ = {};
 
   TfLiteStatus initialization_status_;
 
@@ -27,13 +27,42 @@ limitations under the License.
 
 #include "tensorflow/lite/micro/micro_time.h"
 
-#if defined(TF_LITE_USE_CTIME)
+#if defined(ESP)
+#include "esp_timer.h"
+#elif defined(TF_LITE_USE_CLOCK_GETTIME)
+#include <time.h>
+#elif defined(TF_LITE_USE_CTIME)
 #include <ctime>
 #endif
 
 namespace tflite {
 
-#if !defined(TF_LITE_USE_CTIME)
+#if defined(ESP)
+
+// The ESP-IDF high resolution timer counts microseconds since boot. The tick
+// count wraps every 71 minutes, so durations must be computed as the
+// unsigned difference of two ticks.
+int32_t ticks_per_second() { return 1000000; }
+
+int32_t GetCurrentTimeTicks() {
+  return static_cast<int32_t>(esp_timer_get_time());
+}
+
+#elif defined(TF_LITE_USE_CLOCK_GETTIME)
+
+// POSIX hosts use the monotonic clock, in microseconds like on the ESP32.
+// clock() would measure the CPU time of the whole process instead, which
+// counts other threads and misses the time spent waiting.
+int32_t ticks_per_second() { return 1000000; }
+
+int32_t GetCurrentTimeTicks() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<int32_t>(static_cast<int64_t>(now.tv_sec) * 1000000 +
+                              now.tv_nsec / 1000);
+}
+
+#elif !defined(TF_LITE_USE_CTIME)
 
 // Reference implementation of the ticks_per_second() function that's required
 // for a platform to support Tensorflow Lite for Microcontrollers profiling.
@@ -79,6 +79,9 @@ class SimpleMemoryAllocator {
   // Returns the size of all allocations in the tail section in bytes.
   size_t GetTailUsedBytes() const;
 
+  // Returns the end of the buffer, which the tail section grows down from.
+  uint8_t* GetBufferTail() const;
+
   // Returns the number of bytes available with a given alignment. This number
   // takes in account any temporary allocations.
   size_t GetAvailableMemory(size_t alignment) const;
@@ -0,0 +1,75 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_TENSOR_PLACEMENT_H_
+#define TENSORFLOW_LITE_MICRO_TENSOR_PLACEMENT_H_
+
+#include <cstddef>
+
+#include "tensorflow/lite/micro/compatibility.h"
+
+namespace tflite {
+
+// Chooses the constant tensors of a model, its weights and biases, that are
+// copied out of the model's buffers into a faster memory region when the
+// tensors are allocated. See MicroInterpreter::SetTensorPlacement().
+class TensorPlacementPolicy {
+ public:
+  TensorPlacementPolicy() = default;
+  virtual ~TensorPlacementPolicy() = default;
+
+  // Returns whether the constant tensor tensor_index of the subgraph, of
+  // bytes bytes, should be copied while free_bytes of the region are left.
+  // The tensors are offered in the order of the subgraph, each buffer once.
+  virtual bool ShouldPlace(int subgraph_index, int tensor_index, size_t bytes,
+                           size_t free_bytes) const = 0;
+
+ private:
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+// Places every constant tensor of at most max_tensor_bytes, as long as the
+// region has room for it: the filters of small convolutions and the biases,
+// read over and over by each invoke, while the large weight matrices read
+// once per invoke stay where they are.
+class SmallTensorPlacementPolicy : public TensorPlacementPolicy {
+ public:
+  explicit SmallTensorPlacementPolicy(size_t max_tensor_bytes)
+      : max_tensor_bytes_(max_tensor_bytes) {}
+
+  bool ShouldPlace(int subgraph_index, int tensor_index, size_t bytes,
+                   size_t free_bytes) const override {
+    return bytes <= max_tensor_bytes_ && bytes <= free_bytes;
+  }
+
+ private:
+  const size_t max_tensor_bytes_;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+// Where the constant tensors of a model ended up.
+struct TensorPlacementStats {
+  // Copied to the faster region, including the alignment padding.
+  size_t placed_count;
+  size_t placed_bytes;
+  // Left in the model's buffers.
+  size_t model_count;
+  size_t model_bytes;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_TENSOR_PLACEMENT_H_
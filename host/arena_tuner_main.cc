@@ -0,0 +1,170 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/micro_graph.h"
+
+#include "arena_tuner.h"
+
+// Measures the minimal tensor arena of .tflite models and writes them as the
+// model_arena.h header the app sizes its arena with:
+//
+//   arena_tuner -o include/model_arena.h quant=TF_models/model_quant.tflite ...
+//
+// Batches of images per invoke are tuned up to -b images, 4 by default, the
+// most the app can be configured with.
+//
+// The arena holds pointers, so the sizes are only exact for targets with the
+// pointer size of the machine running the tuner. They are defined for that
+// pointer size only.
+namespace {
+  constexpr size_t kDefaultArenaSize = 1024 * 1024;
+  constexpr int kDefaultMaxBatchSize = 4;
+
+  void usage(const char* program)
+  {
+    fprintf(stderr, "usage: %s [-o HEADER] [-a MAX_ARENA_BYTES] [-b MAX_BATCH] NAME=MODEL.tflite...\n", program);
+  }
+
+  // The flatbuffer must be aligned like the arrays the app links.
+  uint8_t* read_model(const char* path)
+  {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+      return nullptr;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    size_t allocated = (static_cast<size_t>(size) + ARENA_TUNER_ALIGNMENT - 1) / ARENA_TUNER_ALIGNMENT * ARENA_TUNER_ALIGNMENT;
+    uint8_t* data = static_cast<uint8_t*>(aligned_alloc(ARENA_TUNER_ALIGNMENT, allocated));
+    if (data != nullptr && fread(data, 1, size, file) != static_cast<size_t>(size))
+    {
+      free(data);
+      data = nullptr;
+    }
+    fclose(file);
+    return data;
+  }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const char* header_path = nullptr;
+  size_t arena_size = kDefaultArenaSize;
+  int max_batch_size = kDefaultMaxBatchSize;
+  int first_model = 1;
+  for (; first_model < argc && argv[first_model][0] == '-'; first_model += 2)
+  {
+    if (first_model + 1 >= argc)
+    {
+      usage(argv[0]);
+      return 1;
+    }
+    if (strcmp(argv[first_model], "-o") == 0)
+    {
+      header_path = argv[first_model + 1];
+    } else if (strcmp(argv[first_model], "-a") == 0) {
+      arena_size = strtoul(argv[first_model + 1], nullptr, 0);
+    } else if (strcmp(argv[first_model], "-b") == 0) {
+      max_batch_size = atoi(argv[first_model + 1]);
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (first_model >= argc || max_batch_size < 1)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  FILE* header = (header_path != nullptr) ? fopen(header_path, "w") : stdout;
+  if (header == nullptr)
+  {
+    fprintf(stderr, "Cannot write %s\n", header_path);
+    return 1;
+  }
+  uint8_t* arena = static_cast<uint8_t*>(aligned_alloc(ARENA_TUNER_ALIGNMENT, arena_size));
+  static tflite::AllOpsResolver op_resolver;
+  // The app's resolver has the fused kernels of its models, so that the
+  // arena is sized for the graph as the app runs it.
+  static TfLiteRegistration conv_max_pool = tflite::Register_CONV_2D_MAX_POOL_2D();
+  op_resolver.AddCustom(tflite::kConv2DMaxPool2DOpName, &conv_max_pool);
+
+  fprintf(header,
+          "// Generated by host/arena_tuner, do not edit. Minimal tensor arena of each\n"
+          "// model, to be regenerated whenever a model or the TFLM kernels change:\n"
+          "//   arena_tuner -o include/model_arena.h");
+  if (max_batch_size != kDefaultMaxBatchSize)
+  {
+    fprintf(header, " -b %d", max_batch_size);
+  }
+  for (int i = first_model; i < argc; i++)
+  {
+    fprintf(header, " %s", argv[i]);
+  }
+  fprintf(header,
+          "\n#ifndef _MODEL_ARENA_H_\n"
+          "#define _MODEL_ARENA_H_\n\n"
+          "// The arena must start on this boundary for the sizes to hold.\n"
+          "#define MODEL_ARENA_ALIGNMENT %d\n\n"
+          "// Largest batch of images per invoke the sizes hold for.\n"
+          "#define MODEL_ARENA_MAX_BATCH %d\n\n"
+          "// Persistent structs hold pointers, the sizes only apply to the pointer\n"
+          "// size they were measured with.\n"
+          "#if __SIZEOF_POINTER__ == %d\n",
+          ARENA_TUNER_ALIGNMENT, max_batch_size, static_cast<int>(sizeof(void*)));
+
+  int status = 0;
+  for (int i = first_model; i < argc; i++)
+  {
+    char name[32];
+    const char* separator = strchr(argv[i], '=');
+    if (separator == nullptr || static_cast<size_t>(separator - argv[i]) >= sizeof(name))
+    {
+      usage(argv[0]);
+      status = 1;
+      break;
+    }
+    memcpy(name, argv[i], separator - argv[i]);
+    name[separator - argv[i]] = '\0';
+    const char* path = separator + 1;
+
+    uint8_t* data = read_model(path);
+    if (data == nullptr)
+    {
+      fprintf(stderr, "Cannot read %s\n", path);
+      status = 1;
+      break;
+    }
+    arena_tuning_t tuning;
+    if (TuneArena(tflite::GetModel(data), op_resolver, max_batch_size, arena, arena_size, &tuning) != kTfLiteOk)
+    {
+      fprintf(stderr, "%s does not run in a %u bytes arena, up to a batch of %d\n", path, (unsigned) arena_size,
+              max_batch_size);
+      free(data);
+      status = 1;
+      break;
+    }
+    fprintf(stderr, "%-10s %8u bytes, %8u more per image of a batch\n", name, (unsigned) tuning.minimal_size,
+            (unsigned) tuning.batch_image_bytes);
+    fprintf(header, "\n");
+    PrintArenaTuning(header, name, path, &tuning);
+    free(data);
+  }
+
+  fprintf(header, "\n#endif // __SIZEOF_POINTER__\n\n#endif // _MODEL_ARENA_H_\n");
+  if (header != stdout)
+  {
+    fclose(header);
+    if (status != 0)
+    {
+      remove(header_path);
+    }
+  }
+  free(arena);
+  return status;
+}
@@ -0,0 +1,121 @@
+from argparse import ArgumentParser
+from json import dumps as json_encode
+from json import loads as json_decode
+import subprocess
+import sys
+
+if sys.version_info >= (3, 0):
+    from http.client import HTTPConnection
+else:
+    from httplib import HTTPConnection
+
+MODELS = ["quant", "no_quant", "q_aware"]
+BENCHMARK_PREFIX = '{"benchmark"'
+PROFILE_PREFIX = '{"profile"'
+
+
+def run_benchmark(binary, model, instances, batch):
+    """Runs the benchmark binary on one model with that many interpreters, of
+    batch images per invoke, and returns its JSON results, with the
+    per-operator timings under "profile" when they were printed"""
+
+    output = subprocess.check_output([binary, model, str(instances), str(batch)], universal_newlines = True)
+    result = None
+    profile = None
+    for line in output.splitlines():
+        if line.startswith(BENCHMARK_PREFIX):
+            result = json_decode(line)
+        elif line.startswith(PROFILE_PREFIX):
+            profile = json_decode(line)
+    if result is None:
+        raise RuntimeError("%s %s printed no benchmark results" % (binary, model))
+    if profile is not None:
+        result["profile"] = profile
+    return result
+
+
+def get_accuracy(host, port, count):
+    """Asks the images server for the accuracy of the last predictions"""
+
+    connection = HTTPConnection(host, port)
+    try:
+        connection.request("GET", "/accuracy?count=%d" % count)
+        response = connection.getresponse()
+        body = response.read()
+        if response.status != 200:
+            return None
+        return json_decode(body.decode("utf-8"))["accuracy"]
+    finally:
+        connection.close()
+
+
+def top_op(result):
+    """Operator type taking the most time, with its share of the invokes"""
+
+    profile = result.get("profile")
+    if not profile or not profile["op_types"]:
+        return "-"
+    op = profile["op_types"][0]
+    return "%s %d%%" % (op["op"], round(op["share"] * 100))
+
+
+def report(results):
+    print(u"%-10s %9s %5s %9s %9s %10s %10s %10s %8s %9s %12s  %s" % ("model", "instances", "batch", "flash KB",
+          "arena KB", "p50 us", "p99 us", "images/s", "scaling", "accuracy", "acc. per ms", "top op"))
+    # Throughput relative to the first run of the same model. The latencies
+    # are per image, a batch shares its invoke time between its images.
+    baseline = {}
+    for result in results:
+        interpreter = result["invoke_breakdown"]["interpreter"]
+        accuracy = result.get("accuracy")
+        baseline.setdefault(result["model"], result)
+        first = baseline[result["model"]]
+        scaling = result["images_per_s"] / first["images_per_s"] if first["images_per_s"] > 0 else 0.0
+        print(u"%-10s %9d %5d %9.1f %9.1f %10d %10d %10.1f %7.2fx %9s %12s  %s" % (result["model"],
+              result["instances"], result["batch"], result["model_size_bytes"] / 1024.0,
+              result["instances"] * result["arena_used_bytes"] / 1024.0,
+              interpreter["p50_us"], interpreter["p99_us"], result["images_per_s"], scaling,
+              "-" if accuracy is None else "%.4f" % accuracy,
+              "-" if accuracy is None else "%.3f" % (accuracy * 1000.0 / max(interpreter["mean_us"], 1)),
+              top_op(result)))
+
+
+# Define and parse the command line arguments
+cli = ArgumentParser(description='Benchmarks the models side by side on the host')
+cli.add_argument(
+    "-b", "--binary", type=str, metavar="BINARY", dest="binary",
+    default="build_host/inference_benchmark")
+cli.add_argument(
+    "-m", "--models", type=str, metavar="MODEL", dest="models", nargs="+",
+    default=MODELS)
+cli.add_argument(
+    "-j", "--instances", type=int, metavar="INSTANCES", dest="instances", nargs="+",
+    default=[1], help="Numbers of interpreters to run each model with, to measure the scaling")
+cli.add_argument(
+    "-B", "--batch", type=int, metavar="BATCH", dest="batch", nargs="+",
+    default=[1], help="Numbers of images per invoke to run each model with")
+cli.add_argument(
+    "-p", "--port", type=int, metavar="PORT", dest="port", default=8000)
+cli.add_argument(
+    "--host", type=str, metavar="HOST", dest="host", default="localhost")
+cli.add_argument(
+    "--json", action="store_true", dest="json",
+    help="Print the results as JSON instead of a table")
+arguments = cli.parse_args()
+
+if __name__ == '__main__':
+    results = []
+    for model in arguments.models:
+        for instances in arguments.instances:
+            for batch in arguments.batch:
+                result = run_benchmark(arguments.binary, model, instances, batch)
+                # Synthetic images have no labels, the accuracy needs the
+                # images server to serve the labelled train.csv
+                if result["input"] == "server":
+                    result["accuracy"] = get_accuracy(arguments.host, arguments.port, result["images"])
+                results.append(result)
+
+    if arguments.json:
+        print(json_encode(results))
+    else:
+        report(results)
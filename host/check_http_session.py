@@ -0,0 +1,122 @@
+from argparse import ArgumentParser
+from threading import Thread
+import os
+import re
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+# Runs a host executable against its own images server and checks that the
+# keep-alive session of src/app_httpClient.c carries every image download and
+# result upload over a single TCP connection:
+#
+#   cmake -S host -B build_host -DBENCHMARK_SYNTHETIC_INPUT=OFF -DSERVER_HTTP_PORT=8765
+#   python3 host/check_http_session.py -b build_host/inference_benchmark -p 8765 --csv train.csv
+#
+# The server logs a [CONNECTION] line per accepted connection, before its
+# requests: from the first GET /images to the POST /export, none may appear.
+# The app's connectivity check before the pipeline starts is a connection of
+# its own, closed before the session opens.
+
+SERVER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Images_server", "images_server.py")
+SERVER_START_TIMEOUT_S = 120
+MIN_REQUESTS = 2
+
+CONNECTION_LINE = re.compile(r"^\[CONNECTION\]: #\d+")
+IMAGES_LINE = re.compile(r"^\[START\]: Received GET for /images ")
+RESULTS_LINE = re.compile(r"^\[START\]: Received POST for /results$")
+EXPORT_LINE = re.compile(r"^\[START\]: Received POST for /export$")
+SESSION_LINE = re.compile(r"Session connected \((\d+) connections so far\)")
+
+
+def start_server(port, csv, directory):
+    """Starts the images server in directory, where it exports the results,
+    and returns it with the list its output lines are appended to, once it
+    answers"""
+
+    server = subprocess.Popen([sys.executable, "-u", SERVER, "-p", str(port), "--csv", os.path.abspath(csv)],
+                              cwd = directory, stdout = subprocess.PIPE, stderr = subprocess.STDOUT,
+                              universal_newlines = True)
+    lines = []
+    reader = Thread(target = lambda: lines.extend(server.stdout))
+    reader.daemon = True
+    reader.start()
+
+    # The socket listens before the images are loaded, a request is only
+    # answered once they are.
+    deadline = time.time() + SERVER_START_TIMEOUT_S
+    while time.time() < deadline and server.poll() is None:
+        try:
+            with socket.create_connection(("localhost", port), timeout = SERVER_START_TIMEOUT_S) as probe:
+                probe.sendall(b"GET / HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n")
+                if probe.recv(1):
+                    return server, reader, lines
+        except OSError:
+            time.sleep(0.2)
+    server.kill()
+    raise RuntimeError("The images server did not start on port %d" % port)
+
+
+def check_session(lines, client_output):
+    """Returns the errors found in the server log and the client output, and
+    the number of requests of the session"""
+
+    errors = []
+    first = next((i for i, line in enumerate(lines) if IMAGES_LINE.match(line)), None)
+    last = next((i for i, line in enumerate(lines) if EXPORT_LINE.match(line)), None)
+    if first is None or last is None or last < first:
+        return ["The server got no GET /images followed by a POST /export"], 0, 0
+
+    session = lines[first:last + 1]
+    connections = sum(1 for line in session if CONNECTION_LINE.match(line))
+    images = sum(1 for line in session if IMAGES_LINE.match(line))
+    results = sum(1 for line in session if RESULTS_LINE.match(line))
+    if connections != 0:
+        errors.append("%d new connections after the first GET /images" % connections)
+    if images < MIN_REQUESTS or results < MIN_REQUESTS:
+        errors.append("Too few requests to check the connection is kept: %d GET /images, %d POST /results"
+                      % (images, results))
+
+    sessions = [int(count) for count in SESSION_LINE.findall(client_output)]
+    if sessions != [1]:
+        errors.append("The client session connected %s times" % (sessions[-1] if sessions else "no"))
+    return errors, images, results
+
+
+# Define and parse the command line arguments
+cli = ArgumentParser(description='Checks the HTTP session of the app keeps a single connection')
+cli.add_argument(
+    "-b", "--binary", type=str, metavar="BINARY", dest="binary",
+    default="build_host/inference_benchmark",
+    help="Host executable built with -DBENCHMARK_SYNTHETIC_INPUT=OFF and the server port")
+cli.add_argument(
+    "-m", "--model", type=str, metavar="MODEL", dest="model", default="quant")
+cli.add_argument(
+    "-p", "--port", type=int, metavar="PORT", dest="port", default=8000,
+    help="SERVER_HTTP_PORT of the executable, the server is started on it")
+cli.add_argument(
+    "--csv", type=str, metavar="CSV", dest="csv", default="test.csv")
+arguments = cli.parse_args()
+
+if __name__ == '__main__':
+    directory = tempfile.mkdtemp()
+    server, reader, lines = start_server(arguments.port, arguments.csv, directory)
+    try:
+        client = subprocess.run([arguments.binary, arguments.model], stdout = subprocess.PIPE,
+                                stderr = subprocess.STDOUT, universal_newlines = True)
+    finally:
+        server.terminate()
+        server.wait()
+        reader.join()
+        shutil.rmtree(directory)
+
+    if client.returncode != 0:
+        sys.stdout.write(client.stdout)
+        sys.exit("%s exited with %d" % (arguments.binary, client.returncode))
+    errors, images, results = check_session([line.rstrip("\n") for line in lines], client.stdout)
+    if errors:
+        sys.exit("\n".join(errors))
+    print(u"One connection for %d GET /images and %d POST /results" % (images, results))
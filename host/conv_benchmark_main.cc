@@ -0,0 +1,186 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+
+// Micro-benchmark of the int8 convolutions: times
+// reference_integer_ops::ConvPerChannel(), the im2col
+// optimized_integer_ops::ConvPerChannel() and, when the shape has one, the
+// kernel of SelectFixedConvPerChannel(), on the same inputs:
+//
+//   conv_benchmark [-r ROUNDS]
+//
+// The shapes are the convolution of the quant model and a deeper one. The
+// kernels run in turns of a batch of calls, and the fastest turn of each is
+// kept, the one least disturbed by the rest of the machine.
+namespace {
+  constexpr int kDefaultRounds = 200;
+  constexpr int kBatchCalls = 20;
+
+  typedef struct
+  {
+      const char* name;
+      int height;
+      int width;
+      int depth;
+      int filter_size;
+      int output_depth;
+  } conv_shape_t;
+
+  // SAME padding, stride 1.
+  constexpr conv_shape_t kShapes[] = {
+      {"quant model 28x28x1 3x3", 28, 28, 1, 3, 12},
+      {"14x14x16 3x3", 14, 14, 16, 3, 32},
+  };
+
+  struct Conv
+  {
+      tflite::ConvParams params;
+      tflite::RuntimeShape input_shape;
+      tflite::RuntimeShape filter_shape;
+      tflite::RuntimeShape bias_shape;
+      tflite::RuntimeShape output_shape;
+      std::vector<int8_t> input;
+      std::vector<int8_t> filter;
+      std::vector<int32_t> bias;
+      std::vector<int32_t> folded_bias;
+      std::vector<int32_t> multiplier;
+      std::vector<int32_t> shift;
+      std::vector<int8_t> im2col;
+      std::vector<int8_t> output;
+      tflite::optimized_integer_ops::ConvPerChannelKernel fixed_kernel;
+  };
+
+  typedef void (*conv_call_t)(Conv* conv);
+
+  void usage(const char* program)
+  {
+    fprintf(stderr, "usage: %s [-r ROUNDS]\n", program);
+  }
+
+  void init_conv(const conv_shape_t& shape, Conv* conv)
+  {
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int> int8_values(-127, 127);
+    conv->params = tflite::ConvParams();
+    conv->params.input_offset = 128;
+    conv->params.output_offset = -128;
+    conv->params.stride_height = conv->params.stride_width = 1;
+    conv->params.dilation_height_factor = conv->params.dilation_width_factor = 1;
+    conv->params.padding_values.height = conv->params.padding_values.width = (shape.filter_size - 1) / 2;
+    conv->params.quantized_activation_min = -128;
+    conv->params.quantized_activation_max = 127;
+    conv->input_shape.BuildFrom({1, shape.height, shape.width, shape.depth});
+    conv->filter_shape.BuildFrom({shape.output_depth, shape.filter_size, shape.filter_size, shape.depth});
+    conv->bias_shape.BuildFrom({shape.output_depth});
+    conv->output_shape.BuildFrom({1, shape.height, shape.width, shape.output_depth});
+    conv->input.resize(conv->input_shape.FlatSize());
+    conv->filter.resize(conv->filter_shape.FlatSize());
+    for (int8_t& value : conv->input)
+    {
+      value = static_cast<int8_t>(int8_values(random));
+    }
+    for (int8_t& value : conv->filter)
+    {
+      value = static_cast<int8_t>(int8_values(random));
+    }
+    conv->bias.assign(shape.output_depth, 100);
+    conv->multiplier.assign(shape.output_depth, 1 << 30);
+    conv->shift.assign(shape.output_depth, -8);
+    conv->folded_bias.resize(shape.output_depth);
+    tflite::optimized_integer_ops::FoldConvInputOffset(conv->params.input_offset, conv->filter_shape,
+                                                       conv->filter.data(), conv->bias.data(),
+                                                       conv->folded_bias.data());
+    conv->im2col.resize(tflite::optimized_integer_ops::ConvIm2colBufferSize(conv->params, conv->filter_shape,
+                                                                            conv->output_shape));
+    conv->output.resize(conv->output_shape.FlatSize());
+    conv->fixed_kernel = tflite::optimized_integer_ops::SelectFixedConvPerChannel(conv->params, conv->filter_shape);
+  }
+
+  void reference_conv(Conv* conv)
+  {
+    tflite::reference_integer_ops::ConvPerChannel(conv->params, conv->multiplier.data(), conv->shift.data(),
+                                                  conv->input_shape, conv->input.data(), conv->filter_shape,
+                                                  conv->filter.data(), conv->bias_shape, conv->bias.data(),
+                                                  conv->output_shape, conv->output.data());
+  }
+
+  void im2col_conv(Conv* conv)
+  {
+    tflite::optimized_integer_ops::ConvPerChannel(conv->params, conv->multiplier.data(), conv->shift.data(),
+                                                  conv->folded_bias.data(), conv->input_shape, conv->input.data(),
+                                                  conv->filter_shape, conv->filter.data(), conv->output_shape,
+                                                  conv->output.data(), conv->im2col.data());
+  }
+
+  void fixed_conv(Conv* conv)
+  {
+    conv->fixed_kernel(conv->params, conv->multiplier.data(), conv->shift.data(), conv->folded_bias.data(),
+                       conv->input_shape, conv->input.data(), conv->filter_shape, conv->filter.data(),
+                       conv->output_shape, conv->output.data(), nullptr);
+  }
+
+  // Fastest mean duration of one call over the rounds, in us.
+  double time_calls(conv_call_t call, Conv* conv, int rounds)
+  {
+    double fastest_us = 0.0;
+    for (int round = 0; round < rounds; round++)
+    {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (int i = 0; i < kBatchCalls; i++)
+      {
+        call(conv);
+      }
+      double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count()
+                  / kBatchCalls;
+      if (round == 0 || us < fastest_us)
+      {
+        fastest_us = us;
+      }
+    }
+    return fastest_us;
+  }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  int rounds = kDefaultRounds;
+  if (argc == 3 && strcmp(argv[1], "-r") == 0)
+  {
+    rounds = atoi(argv[2]);
+  }
+  else if (argc != 1)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+  if (rounds <= 0)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  printf("%-28s %12s %12s %12s\n", "convolution", "reference us", "im2col us", "fixed us");
+  for (const conv_shape_t& shape : kShapes)
+  {
+    Conv conv;
+    init_conv(shape, &conv);
+    const double reference_us = time_calls(reference_conv, &conv, rounds);
+    const double im2col_us = time_calls(im2col_conv, &conv, rounds);
+    if (conv.fixed_kernel != nullptr)
+    {
+      printf("%-28s %12.2f %12.2f %12.2f\n", shape.name, reference_us, im2col_us,
+             time_calls(fixed_conv, &conv, rounds));
+    }
+    else
+    {
+      printf("%-28s %12.2f %12.2f %12s\n", shape.name, reference_us, im2col_us, "-");
+    }
+  }
+  return 0;
+}
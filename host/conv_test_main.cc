@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+
+// Randomized test of the int8 convolutions of
+// tensorflow/lite/kernels/internal/optimized/integer_ops/conv.h: the im2col
+// ConvPerChannel() and the FixedConvPerChannel() SelectFixedConvPerChannel()
+// returns must compute the outputs of reference_integer_ops::ConvPerChannel()
+// bit for bit:
+//
+//   conv_test [-n CASES] [-s SEED]
+//
+// The cases draw the batches, sizes, depths, filters, strides, dilations,
+// SAME or VALID padding, offsets, activation range, per-channel multipliers
+// and shifts, left ones included, and whether there is a bias. Half of them
+// take the filter, depth and stride of a fixed-shape kernel.
+namespace {
+  constexpr int kDefaultCases = 3000;
+  constexpr unsigned kDefaultSeed = 1;
+  // Mismatches printed before the count.
+  constexpr int kMaxPrintedMismatches = 5;
+
+  typedef struct
+  {
+      int batches;
+      int height;
+      int width;
+      int depth;
+      int filter_height;
+      int filter_width;
+      int output_depth;
+      int stride_height;
+      int stride_width;
+      int dilation_height;
+      int dilation_width;
+      bool same_padding;
+      bool has_bias;
+  } conv_case_t;
+
+  void usage(const char* program)
+  {
+    fprintf(stderr, "usage: %s [-n CASES] [-s SEED]\n", program);
+  }
+
+  int uniform(std::mt19937& random, int min, int max)
+  {
+    return std::uniform_int_distribution<int>(min, max)(random);
+  }
+
+  conv_case_t draw_case(std::mt19937& random)
+  {
+    conv_case_t c;
+    c.batches = uniform(random, 1, 3);
+    c.height = uniform(random, 1, 12);
+    c.width = uniform(random, 1, 12);
+    c.depth = uniform(random, 1, 5);
+    c.filter_height = uniform(random, 1, 4);
+    c.filter_width = uniform(random, 1, 4);
+    c.output_depth = uniform(random, 1, 20);
+    c.stride_height = uniform(random, 1, 3);
+    c.stride_width = uniform(random, 1, 3);
+    c.dilation_height = uniform(random, 1, 2);
+    c.dilation_width = uniform(random, 1, 2);
+    if (uniform(random, 0, 1))
+    {
+      c.filter_height = c.filter_width = uniform(random, 0, 1) ? 3 : 5;
+      c.depth = uniform(random, 0, 1) ? 1 : 3;
+      c.stride_height = c.stride_width = uniform(random, 1, 2);
+      c.dilation_height = c.dilation_width = 1;
+      c.height += 4;
+      c.width += 4;
+    }
+    c.same_padding = uniform(random, 0, 1);
+    c.has_bias = uniform(random, 0, 3) != 0;
+    return c;
+  }
+
+  // Output size and padding along one axis, as ComputePaddingHeightWidth().
+  int output_size(int size, int filter_size, int stride, int dilation, bool same_padding, int* padding)
+  {
+    const int effective_filter_size = (filter_size - 1) * dilation + 1;
+    if (!same_padding)
+    {
+      *padding = 0;
+      return (size - effective_filter_size + stride) / stride;
+    }
+    const int output = (size + stride - 1) / stride;
+    *padding = std::max(0, ((output - 1) * stride + effective_filter_size - size) / 2);
+    return output;
+  }
+
+  // Returns whether the case has an output, and whether every kernel
+  // matched the reference in *matched. Counts the cases a fixed-shape
+  // kernel ran in *fixed_cases.
+  bool run_case(std::mt19937& random, const conv_case_t& c, bool* matched, int* fixed_cases)
+  {
+    int padding_height;
+    int padding_width;
+    const int output_height = output_size(c.height, c.filter_height, c.stride_height, c.dilation_height,
+                                          c.same_padding, &padding_height);
+    const int output_width = output_size(c.width, c.filter_width, c.stride_width, c.dilation_width,
+                                         c.same_padding, &padding_width);
+    if (output_height <= 0 || output_width <= 0)
+    {
+      return false;
+    }
+    tflite::ConvParams params = {};
+    params.padding_values.height = static_cast<int16_t>(padding_height);
+    params.padding_values.width = static_cast<int16_t>(padding_width);
+    params.input_offset = -uniform(random, -128, 127);
+    params.output_offset = uniform(random, -128, 127);
+    params.stride_height = c.stride_height;
+    params.stride_width = c.stride_width;
+    params.dilation_height_factor = c.dilation_height;
+    params.dilation_width_factor = c.dilation_width;
+    params.quantized_activation_min = uniform(random, -128, -109);
+    params.quantized_activation_max = uniform(random, 108, 127);
+
+    const tflite::RuntimeShape input_shape({c.batches, c.height, c.width, c.depth});
+    const tflite::RuntimeShape filter_shape({c.output_depth, c.filter_height, c.filter_width, c.depth});
+    const tflite::RuntimeShape bias_shape({c.output_depth});
+    const tflite::RuntimeShape output_shape({c.batches, output_height, output_width, c.output_depth});
+    std::vector<int8_t> input(input_shape.FlatSize());
+    std::vector<int8_t> filter(filter_shape.FlatSize());
+    for (int8_t& value : input)
+    {
+      value = static_cast<int8_t>(uniform(random, -128, 127));
+    }
+    for (int8_t& value : filter)
+    {
+      value = static_cast<int8_t>(uniform(random, -127, 127));
+    }
+    std::vector<int32_t> bias(c.output_depth);
+    std::vector<int32_t> multiplier(c.output_depth);
+    std::vector<int32_t> shift(c.output_depth);
+    std::vector<int32_t> folded_bias(c.output_depth);
+    for (int channel = 0; channel < c.output_depth; channel++)
+    {
+      bias[channel] = uniform(random, -10000, 10000);
+      multiplier[channel] = uniform(random, 1 << 30, 0x7FFFFFFF);
+      // The accumulators stay far enough from the int32 range for the left
+      // shifts of the small per-channel scales.
+      shift[channel] = uniform(random, -14, 2);
+    }
+    const int32_t* bias_data = c.has_bias ? bias.data() : nullptr;
+
+    std::vector<int8_t> expected(output_shape.FlatSize());
+    tflite::reference_integer_ops::ConvPerChannel(params, multiplier.data(), shift.data(), input_shape, input.data(),
+                                                  filter_shape, filter.data(), bias_shape, bias_data, output_shape,
+                                                  expected.data());
+
+    tflite::optimized_integer_ops::FoldConvInputOffset(params.input_offset, filter_shape, filter.data(), bias_data,
+                                                       folded_bias.data());
+    std::vector<int8_t> im2col(tflite::optimized_integer_ops::ConvIm2colBufferSize(params, filter_shape,
+                                                                                   output_shape));
+    std::vector<int8_t> output(output_shape.FlatSize());
+    tflite::optimized_integer_ops::ConvPerChannel(params, multiplier.data(), shift.data(), folded_bias.data(),
+                                                  input_shape, input.data(), filter_shape, filter.data(),
+                                                  output_shape, output.data(), im2col.data());
+    *matched = output == expected;
+
+    tflite::optimized_integer_ops::ConvPerChannelKernel fixed_kernel =
+        tflite::optimized_integer_ops::SelectFixedConvPerChannel(params, filter_shape);
+    if (fixed_kernel != nullptr)
+    {
+      std::fill(output.begin(), output.end(), 0);
+      fixed_kernel(params, multiplier.data(), shift.data(), folded_bias.data(), input_shape, input.data(),
+                   filter_shape, filter.data(), output_shape, output.data(), nullptr);
+      *matched = *matched && output == expected;
+      (*fixed_cases)++;
+    }
+    return true;
+  }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  int cases = kDefaultCases;
+  unsigned seed = kDefaultSeed;
+  for (int i = 1; i < argc; i += 2)
+  {
+    if (i + 1 >= argc)
+    {
+      usage(argv[0]);
+      return 1;
+    }
+    if (strcmp(argv[i], "-n") == 0)
+    {
+      cases = atoi(argv[i + 1]);
+    }
+    else if (strcmp(argv[i], "-s") == 0)
+    {
+      seed = static_cast<unsigned>(strtoul(argv[i + 1], nullptr, 0));
+    }
+    else
+    {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (cases <= 0)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  std::mt19937 random(seed);
+  int run_cases = 0;
+  int fixed_cases = 0;
+  int mismatches = 0;
+  for (int i = 0; i < cases; i++)
+  {
+    const conv_case_t c = draw_case(random);
+    bool matched = true;
+    if (!run_case(random, c, &matched, &fixed_cases))
+    {
+      continue;
+    }
+    run_cases++;
+    if (!matched && mismatches++ < kMaxPrintedMismatches)
+    {
+      printf("case %d: input %dx%dx%dx%d, filter %dx%dx%dx%d, stride %dx%d, dilation %dx%d, %s padding, %s bias\n",
+             i, c.batches, c.height, c.width, c.depth, c.output_depth, c.filter_height, c.filter_width, c.depth,
+             c.stride_height, c.stride_width, c.dilation_height, c.dilation_width,
+             c.same_padding ? "SAME" : "VALID", c.has_bias ? "with" : "no");
+    }
+  }
+  printf("%d cases, %d with a fixed-shape kernel, %d mismatches\n", run_cases, fixed_cases, mismatches);
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,652 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "esp_log.h"
+#include "esp_http_client.h"
+
+static const char *TAG = "HTTP_Client_Shim";
+
+#define HTTP_MAX_HEADERS        8
+#define HTTP_HEADER_KEY_LEN     32
+#define HTTP_HEADER_VALUE_LEN   64
+#define HTTP_HOST_LEN           64
+#define HTTP_PATH_LEN           256
+#define HTTP_LINE_LEN           512
+#define HTTP_RX_BUFFER_SIZE     4096
+#define HTTP_DEFAULT_TIMEOUT_MS 5000
+
+typedef struct
+{
+    char key[HTTP_HEADER_KEY_LEN];
+    char value[HTTP_HEADER_VALUE_LEN];
+} http_header_t;
+
+struct esp_http_client
+{
+    char host[HTTP_HOST_LEN];
+    int port;
+    // Path and query, as sent in the request line.
+    char path[HTTP_PATH_LEN];
+    esp_http_client_method_t method;
+    int timeout_ms;
+    http_event_handle_cb event_handler;
+    void* user_data;
+    const char* post_data;
+    int post_len;
+    http_header_t headers[HTTP_MAX_HEADERS];
+
+    int fd;
+    // Set once a request has been answered on the current connection, a
+    // failure on a reused connection is retried once on a new one.
+    bool reused;
+
+    // Response state
+    bool headers_fetched;
+    int status_code;
+    int content_length;
+    bool chunked;
+    bool close_after_response;
+    bool body_done;
+    int body_remaining;
+
+    uint8_t rx[HTTP_RX_BUFFER_SIZE];
+    int rx_pos;
+    int rx_len;
+};
+
+static const char* method_names[HTTP_METHOD_MAX] = {
+    "GET", "POST", "PUT", "PATCH", "DELETE", "HEAD",
+};
+
+static void dispatch_event(esp_http_client_handle_t client, esp_http_client_event_id_t event_id, 
+                            void* data, int data_len, char* header_key, char* header_value)
+{
+    if (client->event_handler == NULL)
+    {
+        return;
+    }
+    esp_http_client_event_t event = {
+        .event_id = event_id,
+        .client = client,
+        .data = data,
+        .data_len = data_len,
+        .user_data = client->user_data,
+        .header_key = header_key,
+        .header_value = header_value,
+    };
+    client->event_handler(&event);
+}
+
+static void set_path(esp_http_client_handle_t client, const char* path, const char* query)
+{
+    snprintf(client->path, sizeof(client->path), "%s%s%s", 
+                (path != NULL && path[0] != '\0') ? path : "/", query ? "?" : "", query ? query : "");
+}
+
+esp_err_t esp_http_client_set_url(esp_http_client_handle_t client, const char* url)
+{
+    const char* rest = url;
+    if (strncmp(url, "https://", 8) == 0)
+    {
+        ESP_LOGE(TAG, "HTTPS is not supported on the host.");
+        return ESP_ERR_HTTP_INVALID_TRANSPORT;
+    }
+    if (strncmp(url, "http://", 7) == 0)
+    {
+        rest = url + 7;
+        const char* path = strchr(rest, '/');
+        const char* host_end = path ? path : rest + strlen(rest);
+        const char* port = memchr(rest, ':', host_end - rest);
+        const char* name_end = port ? port : host_end;
+        if (name_end - rest >= HTTP_HOST_LEN)
+        {
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        char host[HTTP_HOST_LEN];
+        memcpy(host, rest, name_end - rest);
+        host[name_end - rest] = '\0';
+        int port_number = port ? atoi(port + 1) : 80;
+        // Changing server drops the connection to the previous one.
+        if (strcmp(host, client->host) != 0 || port_number != client->port)
+        {
+            esp_http_client_close(client);
+            strcpy(client->host, host);
+            client->port = port_number;
+        }
+        rest = path ? path : "/";
+    }
+    // A bare path is relative to the current server, as in ESP-IDF.
+    set_path(client, rest, NULL);
+    return ESP_OK;
+}
+
+esp_http_client_handle_t esp_http_client_init(const esp_http_client_config_t* config)
+{
+    esp_http_client_handle_t client = (esp_http_client_handle_t) calloc(1, sizeof(struct esp_http_client));
+    if (client == NULL)
+    {
+        return NULL;
+    }
+    client->fd = -1;
+    client->method = config->method;
+    client->timeout_ms = config->timeout_ms > 0 ? config->timeout_ms : HTTP_DEFAULT_TIMEOUT_MS;
+    client->event_handler = config->event_handler;
+    client->user_data = config->user_data;
+
+    if (config->url != NULL)
+    {
+        if (esp_http_client_set_url(client, config->url) != ESP_OK)
+        {
+            free(client);
+            return NULL;
+        }
+    } else {
+        snprintf(client->host, sizeof(client->host), "%s", config->host ? config->host : "localhost");
+        client->port = config->port > 0 ? config->port : 80;
+        set_path(client, config->path, config->query);
+    }
+    return client;
+}
+
+esp_err_t esp_http_client_set_method(esp_http_client_handle_t client, esp_http_client_method_t method)
+{
+    client->method = method;
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_set_post_field(esp_http_client_handle_t client, const char* data, int len)
+{
+    client->post_data = data;
+    client->post_len = data ? len : 0;
+    return ESP_OK;
+}
+
+static http_header_t* find_header(esp_http_client_handle_t client, const char* key)
+{
+    for (int i = 0; i < HTTP_MAX_HEADERS; i++)
+    {
+        if (client->headers[i].key[0] != '\0' && strcasecmp(client->headers[i].key, key) == 0)
+        {
+            return &client->headers[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t esp_http_client_set_header(esp_http_client_handle_t client, const char* key, const char* value)
+{
+    http_header_t* header = find_header(client, key);
+    for (int i = 0; header == NULL && i < HTTP_MAX_HEADERS; i++)
+    {
+        if (client->headers[i].key[0] == '\0')
+        {
+            header = &client->headers[i];
+        }
+    }
+    if (header == NULL || strlen(key) >= HTTP_HEADER_KEY_LEN || strlen(value) >= HTTP_HEADER_VALUE_LEN)
+    {
+        return ESP_ERR_NO_MEM;
+    }
+    strcpy(header->key, key);
+    strcpy(header->value, value);
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_get_header(esp_http_client_handle_t client, const char* key, char** value)
+{
+    http_header_t* header = find_header(client, key);
+    *value = header ? header->value : NULL;
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_delete_header(esp_http_client_handle_t client, const char* key)
+{
+    http_header_t* header = find_header(client, key);
+    if (header != NULL)
+    {
+        header->key[0] = '\0';
+    }
+    return ESP_OK;
+}
+
+static esp_err_t http_connect(esp_http_client_handle_t client)
+{
+    if (client->fd >= 0)
+    {
+        return ESP_OK;
+    }
+
+    char port[8];
+    snprintf(port, sizeof(port), "%d", client->port);
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM };
+    struct addrinfo* addresses = NULL;
+    int err = getaddrinfo(client->host, port, &hints, &addresses);
+    if (err != 0)
+    {
+        ESP_LOGE(TAG, "Cannot resolve %s: %s", client->host, gai_strerror(err));
+        return ESP_ERR_HTTP_CONNECT;
+    }
+
+    for (struct addrinfo* address = addresses; address != NULL && client->fd < 0; address = address->ai_next)
+    {
+        int fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd < 0)
+        {
+            continue;
+        }
+        struct timeval timeout = { client->timeout_ms / 1000, (client->timeout_ms % 1000) * 1000 };
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        int no_delay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+        if (connect(fd, address->ai_addr, address->ai_addrlen) == 0)
+        {
+            client->fd = fd;
+        } else {
+            close(fd);
+        }
+    }
+    freeaddrinfo(addresses);
+
+    if (client->fd < 0)
+    {
+        ESP_LOGE(TAG, "Cannot connect to %s:%d: %s", client->host, client->port, strerror(errno));
+        return ESP_ERR_HTTP_CONNECT;
+    }
+    client->reused = false;
+    client->rx_pos = client->rx_len = 0;
+    dispatch_event(client, HTTP_EVENT_ON_CONNECTED, NULL, 0, NULL, NULL);
+    return ESP_OK;
+}
+
+static bool send_all(esp_http_client_handle_t client, const char* data, int len)
+{
+    while (len > 0)
+    {
+        ssize_t sent = send(client->fd, data, len, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (sent <= 0)
+        {
+            return false;
+        }
+        data += sent;
+        len -= sent;
+    }
+    return true;
+}
+
+static esp_err_t send_request(esp_http_client_handle_t client, int write_len)
+{
+    esp_err_t err = http_connect(client);
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+
+    char request[HTTP_LINE_LEN + HTTP_MAX_HEADERS * (HTTP_HEADER_KEY_LEN + HTTP_HEADER_VALUE_LEN + 4)];
+    int len = snprintf(request, sizeof(request), "%s %s HTTP/1.1\r\nHost: %s:%d\r\nUser-Agent: ESP32 HTTP Client/1.0\r\n", 
+                        method_names[client->method], client->path, client->host, client->port);
+    if (write_len > 0 || client->method == HTTP_METHOD_POST || client->method == HTTP_METHOD_PUT)
+    {
+        len += snprintf(request + len, sizeof(request) - len, "Content-Length: %d\r\n", write_len);
+    }
+    for (int i = 0; i < HTTP_MAX_HEADERS; i++)
+    {
+        if (client->headers[i].key[0] != '\0')
+        {
+            len += snprintf(request + len, sizeof(request) - len, "%s: %s\r\n", 
+                            client->headers[i].key, client->headers[i].value);
+        }
+    }
+    len += snprintf(request + len, sizeof(request) - len, "\r\n");
+
+    client->headers_fetched = false;
+    if (!send_all(client, request, len))
+    {
+        return ESP_ERR_HTTP_WRITE_DATA;
+    }
+    dispatch_event(client, HTTP_EVENT_HEADERS_SENT, NULL, 0, NULL, NULL);
+    return ESP_OK;
+}
+
+// Returns the number of buffered bytes, 0 once the server has closed the
+// connection and -1 on errors.
+static int fill_rx(esp_http_client_handle_t client)
+{
+    if (client->rx_pos < client->rx_len)
+    {
+        return client->rx_len - client->rx_pos;
+    }
+    ssize_t received;
+    do {
+        received = recv(client->fd, client->rx, sizeof(client->rx), 0);
+    } while (received < 0 && errno == EINTR);
+    if (received < 0)
+    {
+        return -1;
+    }
+    client->rx_pos = 0;
+    client->rx_len = (int) received;
+    return client->rx_len;
+}
+
+static bool read_line(esp_http_client_handle_t client, char* line, int size)
+{
+    int len = 0;
+    while (true)
+    {
+        if (fill_rx(client) <= 0)
+        {
+            return false;
+        }
+        char c = (char) client->rx[client->rx_pos++];
+        if (c == '\n')
+        {
+            break;
+        }
+        if (c != '\r' && len < size - 1)
+        {
+            line[len++] = c;
+        }
+    }
+    line[len] = '\0';
+    return true;
+}
+
+static bool read_headers(esp_http_client_handle_t client)
+{
+    if (client->headers_fetched)
+    {
+        return true;
+    }
+
+    char line[HTTP_LINE_LEN];
+    int minor_version = 1;
+    if (!read_line(client, line, sizeof(line)) 
+        || sscanf(line, "HTTP/1.%d %d", &minor_version, &client->status_code) != 2)
+    {
+        return false;
+    }
+    client->content_length = -1;
+    client->chunked = false;
+    client->close_after_response = (minor_version == 0);
+
+    while (true)
+    {
+        if (!read_line(client, line, sizeof(line)))
+        {
+            return false;
+        }
+        if (line[0] == '\0')
+        {
+            break;
+        }
+        char* value = strchr(line, ':');
+        if (value == NULL)
+        {
+            continue;
+        }
+        *value++ = '\0';
+        while (*value == ' ')
+        {
+            value++;
+        }
+        if (strcasecmp(line, "Content-Length") == 0)
+        {
+            client->content_length = atoi(value);
+        } else if (strcasecmp(line, "Transfer-Encoding") == 0 && strcasecmp(value, "chunked") == 0) {
+            client->chunked = true;
+        } else if (strcasecmp(line, "Connection") == 0) {
+            client->close_after_response = (strcasecmp(value, "close") == 0);
+        }
+        dispatch_event(client, HTTP_EVENT_ON_HEADER, NULL, 0, line, value);
+    }
+
+    bool no_body = client->method == HTTP_METHOD_HEAD || client->status_code == 204 
+                    || client->status_code == 304 || (client->status_code >= 100 && client->status_code < 200);
+    client->body_done = no_body || client->content_length == 0;
+    client->body_remaining = client->chunked ? 0 : client->content_length;
+    client->headers_fetched = true;
+    return true;
+}
+
+int esp_http_client_fetch_headers(esp_http_client_handle_t client)
+{
+    return read_headers(client) ? client->content_length : ESP_FAIL;
+}
+
+// Reads up to len bytes of de-chunked body, returns 0 at the end of the
+// body and -1 on errors.
+static int read_body(esp_http_client_handle_t client, uint8_t* buffer, int len)
+{
+    if (client->body_done)
+    {
+        return 0;
+    }
+
+    if (client->chunked && client->body_remaining == 0)
+    {
+        char line[HTTP_LINE_LEN];
+        if (!read_line(client, line, sizeof(line)))
+        {
+            return -1;
+        }
+        client->body_remaining = (int) strtol(line, NULL, 16);
+        if (client->body_remaining == 0)
+        {
+            // Skip the trailers up to the final empty line.
+            while (read_line(client, line, sizeof(line)) && line[0] != '\0')
+            {
+            }
+            client->body_done = true;
+            return 0;
+        }
+    }
+
+    int available = fill_rx(client);
+    if (available <= 0)
+    {
+        // Without a length, the body ends when the server closes.
+        if (available == 0 && client->content_length < 0 && !client->chunked)
+        {
+            client->body_done = true;
+            client->close_after_response = true;
+            return 0;
+        }
+        return -1;
+    }
+
+    bool sized = client->chunked || client->content_length >= 0;
+    int copy_len = available < len ? available : len;
+    if (sized && copy_len > client->body_remaining)
+    {
+        copy_len = client->body_remaining;
+    }
+    memcpy(buffer, client->rx + client->rx_pos, copy_len);
+    client->rx_pos += copy_len;
+
+    if (sized)
+    {
+        client->body_remaining -= copy_len;
+        if (client->chunked && client->body_remaining == 0)
+        {
+            char crlf[4];
+            read_line(client, crlf, sizeof(crlf));
+        } else if (client->body_remaining == 0) {
+            client->body_done = true;
+        }
+    }
+    return copy_len;
+}
+
+static void finish_response(esp_http_client_handle_t client)
+{
+    dispatch_event(client, HTTP_EVENT_ON_FINISH, NULL, 0, NULL, NULL);
+    client->reused = true;
+    if (client->close_after_response)
+    {
+        esp_http_client_close(client);
+    }
+}
+
+static esp_err_t perform_once(esp_http_client_handle_t client)
+{
+    esp_err_t err = send_request(client, client->post_len);
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+    if (client->post_len > 0 && !send_all(client, client->post_data, client->post_len))
+    {
+        return ESP_ERR_HTTP_WRITE_DATA;
+    }
+    if (!read_headers(client))
+    {
+        return ESP_ERR_HTTP_FETCH_HEADER;
+    }
+
+    uint8_t data[HTTP_RX_BUFFER_SIZE];
+    int len;
+    while ((len = read_body(client, data, sizeof(data))) > 0)
+    {
+        dispatch_event(client, HTTP_EVENT_ON_DATA, data, len, NULL, NULL);
+    }
+    if (len < 0)
+    {
+        ESP_LOGE(TAG, "Connection lost while reading the response.");
+        return ESP_FAIL;
+    }
+    finish_response(client);
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_perform(esp_http_client_handle_t client)
+{
+    bool reused = (client->fd >= 0 && client->reused);
+    esp_err_t err = perform_once(client);
+    // The server may have closed an idle keep-alive connection, which only
+    // shows once the request is written or its answer awaited.
+    if (err != ESP_OK && reused && !client->headers_fetched)
+    {
+        esp_http_client_close(client);
+        err = perform_once(client);
+    }
+    if (err != ESP_OK)
+    {
+        dispatch_event(client, HTTP_EVENT_ERROR, NULL, 0, NULL, NULL);
+        esp_http_client_close(client);
+    }
+    return err;
+}
+
+esp_err_t esp_http_client_open(esp_http_client_handle_t client, int write_len)
+{
+    esp_err_t err = send_request(client, write_len);
+    if (err != ESP_OK && client->reused)
+    {
+        esp_http_client_close(client);
+        err = send_request(client, write_len);
+    }
+    return err;
+}
+
+int esp_http_client_write(esp_http_client_handle_t client, const char* buffer, int len)
+{
+    return send_all(client, buffer, len) ? len : -1;
+}
+
+int esp_http_client_read_response(esp_http_client_handle_t client, char* buffer, int len)
+{
+    if (!read_headers(client))
+    {
+        return -1;
+    }
+
+    int total = 0;
+    while (total < len)
+    {
+        int read_len = read_body(client, (uint8_t*) buffer + total, len - total);
+        if (read_len < 0)
+        {
+            return -1;
+        }
+        if (read_len == 0)
+        {
+            break;
+        }
+        dispatch_event(client, HTTP_EVENT_ON_DATA, buffer + total, read_len, NULL, NULL);
+        total += read_len;
+    }
+    if (client->body_done)
+    {
+        finish_response(client);
+    }
+    return total;
+}
+
+int esp_http_client_get_status_code(esp_http_client_handle_t client)
+{
+    return client->status_code;
+}
+
+int esp_http_client_get_content_length(esp_http_client_handle_t client)
+{
+    return client->content_length;
+}
+
+bool esp_http_client_is_chunked_response(esp_http_client_handle_t client)
+{
+    return client->chunked;
+}
+
+esp_err_t esp_http_client_close(esp_http_client_handle_t client)
+{
+    if (client->fd >= 0)
+    {
+        close(client->fd);
+        client->fd = -1;
+        client->rx_pos = client->rx_len = 0;
+        dispatch_event(client, HTTP_EVENT_DISCONNECTED, NULL, 0, NULL, NULL);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_http_client_cleanup(esp_http_client_handle_t client)
+{
+    if (client == NULL)
+    {
+        return ESP_FAIL;
+    }
+    esp_http_client_close(client);
+    free(client);
+    return ESP_OK;
+}
+
+esp_err_t esp_tls_get_and_clear_last_error(esp_tls_error_handle_t h, int* esp_tls_code, int* esp_tls_flags)
+{
+    (void) h;
+    if (esp_tls_code != NULL)
+    {
+        *esp_tls_code = 0;
+    }
+    if (esp_tls_flags != NULL)
+    {
+        *esp_tls_flags = 0;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,87 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+typedef struct
+{
+    esp_err_t code;
+    const char* name;
+} esp_err_name_t;
+
+#define ERR_NAME(code) { code, #code }
+
+static const esp_err_name_t err_names[] = {
+    ERR_NAME(ESP_OK),
+    ERR_NAME(ESP_FAIL),
+    ERR_NAME(ESP_ERR_NO_MEM),
+    ERR_NAME(ESP_ERR_INVALID_ARG),
+    ERR_NAME(ESP_ERR_INVALID_STATE),
+    ERR_NAME(ESP_ERR_INVALID_SIZE),
+    ERR_NAME(ESP_ERR_NOT_FOUND),
+    ERR_NAME(ESP_ERR_NOT_SUPPORTED),
+    ERR_NAME(ESP_ERR_TIMEOUT),
+    ERR_NAME(ESP_ERR_INVALID_RESPONSE),
+    ERR_NAME(ESP_ERR_HTTP_MAX_REDIRECT),
+    ERR_NAME(ESP_ERR_HTTP_CONNECT),
+    ERR_NAME(ESP_ERR_HTTP_WRITE_DATA),
+    ERR_NAME(ESP_ERR_HTTP_FETCH_HEADER),
+    ERR_NAME(ESP_ERR_HTTP_INVALID_TRANSPORT),
+    ERR_NAME(ESP_ERR_HTTP_CONNECTING),
+    ERR_NAME(ESP_ERR_HTTP_EAGAIN),
+};
+
+const char* esp_err_to_name(esp_err_t code)
+{
+    for (size_t i = 0; i < sizeof(err_names) / sizeof(err_names[0]); i++)
+    {
+        if (err_names[i].code == code)
+        {
+            return err_names[i].name;
+        }
+    }
+    return "UNKNOWN ERROR";
+}
+
+static int64_t monotonic_us(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static int64_t boot_time_us = -1;
+
+int64_t esp_timer_get_time(void)
+{
+    // The first call happens before any task is started, so the lazy
+    // initialization does not race.
+    if (boot_time_us < 0)
+    {
+        boot_time_us = monotonic_us();
+    }
+    return monotonic_us() - boot_time_us;
+}
+
+uint32_t esp_log_timestamp(void)
+{
+    return (uint32_t) (esp_timer_get_time() / 1000);
+}
+
+void esp_log_buffer_hex(const char* tag, const void* buffer, uint16_t buff_len)
+{
+    const uint8_t* bytes = (const uint8_t*) buffer;
+    for (uint16_t line = 0; line < buff_len; line += 16)
+    {
+        char hex[16 * 3 + 1];
+        int len = 0;
+        for (uint16_t i = line; i < buff_len && i < line + 16; i++)
+        {
+            len += snprintf(hex + len, sizeof(hex) - len, "%02x ", bytes[i]);
+        }
+        ESP_LOGI(tag, "%s", hex);
+    }
+}
@@ -0,0 +1,409 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+
+static const char *TAG = "FreeRTOS_Shim";
+
+struct shim_task
+{
+    pthread_t thread;
+    TaskFunction_t function;
+    void* parameters;
+    char name[16];
+    // Task notification value, used as a counting semaphore.
+    pthread_mutex_t lock;
+    pthread_cond_t notified;
+    uint32_t notification;
+};
+
+struct shim_queue
+{
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t count;
+    UBaseType_t head;
+    uint8_t* storage;
+};
+
+struct shim_event_group
+{
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    EventBits_t bits;
+};
+
+static __thread TaskHandle_t current_task = NULL;
+
+// Converts a tick timeout into an absolute deadline for the timed waits.
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    uint64_t ms = (uint64_t) ticks * portTICK_PERIOD_MS;
+    deadline.tv_sec += ms / 1000;
+    deadline.tv_nsec += (ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    return deadline;
+}
+
+// Waits on cond until ready() holds, for at most ticks. Must be called with
+// lock held, returns pdFALSE on timeout.
+static BaseType_t wait_until(pthread_cond_t* cond, pthread_mutex_t* lock, TickType_t ticks,
+                                BaseType_t (*ready)(void*), void* object)
+{
+    struct timespec deadline = deadline_after(ticks == portMAX_DELAY ? 0 : ticks);
+    while (!ready(object))
+    {
+        if (ticks == 0)
+        {
+            return pdFALSE;
+        }
+        if (ticks == portMAX_DELAY)
+        {
+            pthread_cond_wait(cond, lock);
+        } else if (pthread_cond_timedwait(cond, lock, &deadline) == ETIMEDOUT) {
+            return ready(object);
+        }
+    }
+    return pdTRUE;
+}
+
+static void* task_entry(void* argument)
+{
+    TaskHandle_t task = (TaskHandle_t) argument;
+    current_task = task;
+    task->function(task->parameters);
+    // FreeRTOS tasks must never return, but exit cleanly if one does.
+    ESP_LOGE(TAG, "Task %s returned without deleting itself.", task->name);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stack_depth, 
+                                    void* parameters, UBaseType_t priority, TaskHandle_t* created_task, 
+                                    BaseType_t core_id)
+{
+    // Threads have the default stack, priority and affinity of the host.
+    (void) stack_depth;
+    (void) priority;
+    (void) core_id;
+    TaskHandle_t handle = (TaskHandle_t) calloc(1, sizeof(struct shim_task));
+    if (handle == NULL)
+    {
+        return pdFAIL;
+    }
+    handle->function = task;
+    handle->parameters = parameters;
+    strncpy(handle->name, name, sizeof(handle->name) - 1);
+    pthread_mutex_init(&handle->lock, NULL);
+    pthread_cond_init(&handle->notified, NULL);
+
+    // The handle must be valid before the task runs, it may be notified
+    // straight away.
+    if (created_task != NULL)
+    {
+        *created_task = handle;
+    }
+
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+    int err = pthread_create(&handle->thread, &attributes, task_entry, handle);
+    pthread_attr_destroy(&attributes);
+    if (err != 0)
+    {
+        ESP_LOGE(TAG, "Failed to create task %s: %s", name, strerror(err));
+        if (created_task != NULL)
+        {
+            *created_task = NULL;
+        }
+        free(handle);
+        return pdFAIL;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t task, const char* name, uint32_t stack_depth, 
+                        void* parameters, UBaseType_t priority, TaskHandle_t* created_task)
+{
+    return xTaskCreatePinnedToCore(task, name, stack_depth, parameters, priority, created_task, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task != NULL && task != current_task)
+    {
+        ESP_LOGE(TAG, "Deleting another task is not supported on the host.");
+        abort();
+    }
+    // The handle is leaked on purpose, other tasks may still notify it.
+    pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    uint64_t ms = (uint64_t) ticks * portTICK_PERIOD_MS;
+    struct timespec delay = { (time_t) (ms / 1000), (long) (ms % 1000) * 1000000 };
+    while (nanosleep(&delay, &delay) != 0 && errno == EINTR)
+    {
+    }
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (TickType_t) ((now.tv_sec * 1000 + now.tv_nsec / 1000000) / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return current_task;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->lock);
+    task->notification++;
+    pthread_cond_signal(&task->notified);
+    pthread_mutex_unlock(&task->lock);
+    return pdPASS;
+}
+
+static BaseType_t task_is_notified(void* object)
+{
+    return ((TaskHandle_t) object)->notification != 0;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait)
+{
+    TaskHandle_t task = current_task;
+    if (task == NULL)
+    {
+        ESP_LOGE(TAG, "ulTaskNotifyTake() called outside of a task.");
+        abort();
+    }
+
+    pthread_mutex_lock(&task->lock);
+    wait_until(&task->notified, &task->lock, ticks_to_wait, task_is_notified, task);
+    uint32_t value = task->notification;
+    if (value != 0)
+    {
+        task->notification = clear_count_on_exit ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&task->lock);
+    return value;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    QueueHandle_t queue = (QueueHandle_t) calloc(1, sizeof(struct shim_queue));
+    if (queue == NULL)
+    {
+        return NULL;
+    }
+    queue->storage = (uint8_t*) malloc(item_size > 0 ? length * item_size : 1);
+    if (queue->storage == NULL)
+    {
+        free(queue);
+        return NULL;
+    }
+    queue->length = length;
+    queue->item_size = item_size;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->not_empty, NULL);
+    pthread_cond_init(&queue->not_full, NULL);
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    pthread_mutex_destroy(&queue->lock);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_cond_destroy(&queue->not_full);
+    free(queue->storage);
+    free(queue);
+}
+
+static BaseType_t queue_has_space(void* object)
+{
+    QueueHandle_t queue = (QueueHandle_t) object;
+    return queue->count < queue->length;
+}
+
+static BaseType_t queue_has_items(void* object)
+{
+    return ((QueueHandle_t) object)->count > 0;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait)
+{
+    pthread_mutex_lock(&queue->lock);
+    BaseType_t sent = wait_until(&queue->not_full, &queue->lock, ticks_to_wait, queue_has_space, queue);
+    if (sent)
+    {
+        UBaseType_t tail = (queue->head + queue->count) % queue->length;
+        if (queue->item_size > 0)
+        {
+            memcpy(queue->storage + tail * queue->item_size, item, queue->item_size);
+        }
+        queue->count++;
+        pthread_cond_signal(&queue->not_empty);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return sent;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait)
+{
+    pthread_mutex_lock(&queue->lock);
+    BaseType_t received = wait_until(&queue->not_empty, &queue->lock, ticks_to_wait, queue_has_items, queue);
+    if (received)
+    {
+        if (queue->item_size > 0)
+        {
+            memcpy(buffer, queue->storage + queue->head * queue->item_size, queue->item_size);
+        }
+        queue->head = (queue->head + 1) % queue->length;
+        queue->count--;
+        pthread_cond_signal(&queue->not_full);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return received;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    UBaseType_t count = queue->count;
+    pthread_mutex_unlock(&queue->lock);
+    return count;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return xQueueCreate(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t mutex = xSemaphoreCreateBinary();
+    if (mutex != NULL)
+    {
+        xSemaphoreGive(mutex);
+    }
+    return mutex;
+}
+
+// Semaphores are queues of empty items, only their count changes: they do
+// not go through xQueueSend() and xQueueReceive(), whose copies would be
+// given a null item.
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    pthread_mutex_lock(&semaphore->lock);
+    BaseType_t taken = wait_until(&semaphore->not_empty, &semaphore->lock, ticks_to_wait, queue_has_items, semaphore);
+    if (taken)
+    {
+        semaphore->count--;
+        pthread_cond_signal(&semaphore->not_full);
+    }
+    pthread_mutex_unlock(&semaphore->lock);
+    return taken;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    pthread_mutex_lock(&semaphore->lock);
+    BaseType_t given = queue_has_space(semaphore);
+    if (given)
+    {
+        semaphore->count++;
+        pthread_cond_signal(&semaphore->not_empty);
+    }
+    pthread_mutex_unlock(&semaphore->lock);
+    return given;
+}
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    EventGroupHandle_t group = (EventGroupHandle_t) calloc(1, sizeof(struct shim_event_group));
+    if (group != NULL)
+    {
+        pthread_mutex_init(&group->lock, NULL);
+        pthread_cond_init(&group->changed, NULL);
+    }
+    return group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->lock);
+    group->bits |= bits;
+    EventBits_t value = group->bits;
+    pthread_cond_broadcast(&group->changed);
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->lock);
+    EventBits_t value = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    pthread_mutex_lock(&group->lock);
+    EventBits_t value = group->bits;
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+typedef struct
+{
+    EventGroupHandle_t group;
+    EventBits_t bits;
+    BaseType_t wait_for_all_bits;
+} event_wait_t;
+
+static BaseType_t event_bits_are_set(void* object)
+{
+    event_wait_t* wait = (event_wait_t*) object;
+    EventBits_t set = wait->group->bits & wait->bits;
+    return wait->wait_for_all_bits ? set == wait->bits : set != 0;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit, 
+                                BaseType_t wait_for_all_bits, TickType_t ticks_to_wait)
+{
+    event_wait_t wait = { group, bits, wait_for_all_bits };
+
+    pthread_mutex_lock(&group->lock);
+    BaseType_t satisfied = wait_until(&group->changed, &group->lock, ticks_to_wait, event_bits_are_set, &wait);
+    EventBits_t value = group->bits;
+    if (satisfied && clear_on_exit)
+    {
+        group->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
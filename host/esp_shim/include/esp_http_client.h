@@ -0,0 +1,102 @@
+#ifndef _ESP_SHIM_ESP_HTTP_CLIENT_H_
+#define _ESP_SHIM_ESP_HTTP_CLIENT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Plain HTTP/1.1 client over POSIX sockets with the esp_http_client API
+// and event semantics: bodies are de-chunked before HTTP_EVENT_ON_DATA and
+// the connection is kept alive between esp_http_client_perform() calls
+// unless the server closes it.
+
+typedef struct esp_http_client* esp_http_client_handle_t;
+typedef struct esp_http_client_event esp_http_client_event_t;
+typedef esp_err_t (*http_event_handle_cb)(esp_http_client_event_t* event);
+
+typedef enum {
+    HTTP_EVENT_ERROR = 0,
+    HTTP_EVENT_ON_CONNECTED,
+    HTTP_EVENT_HEADERS_SENT,
+    HTTP_EVENT_HEADER_SENT = HTTP_EVENT_HEADERS_SENT,
+    HTTP_EVENT_ON_HEADER,
+    HTTP_EVENT_ON_DATA,
+    HTTP_EVENT_ON_FINISH,
+    HTTP_EVENT_DISCONNECTED,
+} esp_http_client_event_id_t;
+
+struct esp_http_client_event {
+    esp_http_client_event_id_t event_id;
+    esp_http_client_handle_t client;
+    void* data;
+    int data_len;
+    void* user_data;
+    char* header_key;
+    char* header_value;
+};
+
+typedef enum {
+    HTTP_METHOD_GET = 0,
+    HTTP_METHOD_POST,
+    HTTP_METHOD_PUT,
+    HTTP_METHOD_PATCH,
+    HTTP_METHOD_DELETE,
+    HTTP_METHOD_HEAD,
+    HTTP_METHOD_MAX,
+} esp_http_client_method_t;
+
+typedef enum {
+    HTTP_TRANSPORT_UNKNOWN = 0,
+    HTTP_TRANSPORT_OVER_TCP,
+    HTTP_TRANSPORT_OVER_SSL,
+} esp_http_client_transport_t;
+
+typedef struct {
+    const char* url;
+    const char* host;
+    int port;
+    const char* path;
+    const char* query;
+    esp_http_client_method_t method;
+    int timeout_ms;
+    bool disable_auto_redirect;
+    http_event_handle_cb event_handler;
+    esp_http_client_transport_t transport_type;
+    int buffer_size;
+    int buffer_size_tx;
+    void* user_data;
+    bool keep_alive_enable;
+} esp_http_client_config_t;
+
+esp_http_client_handle_t esp_http_client_init(const esp_http_client_config_t* config);
+esp_err_t esp_http_client_perform(esp_http_client_handle_t client);
+esp_err_t esp_http_client_set_url(esp_http_client_handle_t client, const char* url);
+esp_err_t esp_http_client_set_method(esp_http_client_handle_t client, esp_http_client_method_t method);
+esp_err_t esp_http_client_set_post_field(esp_http_client_handle_t client, const char* data, int len);
+esp_err_t esp_http_client_set_header(esp_http_client_handle_t client, const char* key, const char* value);
+esp_err_t esp_http_client_get_header(esp_http_client_handle_t client, const char* key, char** value);
+esp_err_t esp_http_client_delete_header(esp_http_client_handle_t client, const char* key);
+esp_err_t esp_http_client_open(esp_http_client_handle_t client, int write_len);
+int esp_http_client_write(esp_http_client_handle_t client, const char* buffer, int len);
+int esp_http_client_fetch_headers(esp_http_client_handle_t client);
+int esp_http_client_read_response(esp_http_client_handle_t client, char* buffer, int len);
+int esp_http_client_get_status_code(esp_http_client_handle_t client);
+int esp_http_client_get_content_length(esp_http_client_handle_t client);
+bool esp_http_client_is_chunked_response(esp_http_client_handle_t client);
+esp_err_t esp_http_client_close(esp_http_client_handle_t client);
+esp_err_t esp_http_client_cleanup(esp_http_client_handle_t client);
+
+// There is no TLS on the host, the last error is always ESP_OK.
+typedef void* esp_tls_error_handle_t;
+esp_err_t esp_tls_get_and_clear_last_error(esp_tls_error_handle_t h, int* esp_tls_code, int* esp_tls_flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ESP_SHIM_ESP_HTTP_CLIENT_H_
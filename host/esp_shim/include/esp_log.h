@@ -0,0 +1,33 @@
+#ifndef _ESP_SHIM_ESP_LOG_H_
+#define _ESP_SHIM_ESP_LOG_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Logs go to stdout with the same "L (time) TAG: message" layout as the
+// ESP-IDF console, so the same scripts can parse both.
+uint32_t esp_log_timestamp(void);
+void esp_log_buffer_hex(const char* tag, const void* buffer, uint16_t buff_len);
+
+#define ESP_SHIM_LOG(letter, tag, format, ...) \
+    printf(letter " (%u) %s: " format "\n", (unsigned) esp_log_timestamp(), tag, ##__VA_ARGS__)
+
+#define ESP_LOGE(tag, format, ...) ESP_SHIM_LOG("E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) ESP_SHIM_LOG("W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) ESP_SHIM_LOG("I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) do { } while (0)
+#define ESP_LOGV(tag, format, ...) do { } while (0)
+
+#define ESP_LOG_BUFFER_HEX(tag, buffer, buff_len) esp_log_buffer_hex(tag, buffer, buff_len)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ESP_SHIM_ESP_LOG_H_
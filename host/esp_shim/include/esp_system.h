@@ -0,0 +1,8 @@
+#ifndef _ESP_SHIM_ESP_SYSTEM_H_
+#define _ESP_SHIM_ESP_SYSTEM_H_
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#endif // _ESP_SHIM_ESP_SYSTEM_H_
@@ -0,0 +1,17 @@
+#ifndef _ESP_SHIM_ESP_TIMER_H_
+#define _ESP_SHIM_ESP_TIMER_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Microseconds since the process started, from the monotonic clock.
+int64_t esp_timer_get_time(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ESP_SHIM_ESP_TIMER_H_
@@ -0,0 +1,31 @@
+#ifndef _ESP_SHIM_FREERTOS_H_
+#define _ESP_SHIM_FREERTOS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// FreeRTOS subset used by the app, implemented over POSIX threads. A tick
+// is one millisecond on the host.
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE                 ((BaseType_t) 0)
+#define pdTRUE                  ((BaseType_t) 1)
+#define pdFAIL                  pdFALSE
+#define pdPASS                  pdTRUE
+
+#define portMAX_DELAY           ((TickType_t) 0xffffffffUL)
+#define portTICK_PERIOD_MS      ((TickType_t) 1)
+#define portTICK_RATE_MS        portTICK_PERIOD_MS
+#define pdMS_TO_TICKS(ms)       ((TickType_t) (ms) / portTICK_PERIOD_MS)
+
+#define configMAX_PRIORITIES    25
+#define configMAX_TASK_NAME_LEN 16
+// As on the ESP32, the cores only matter to the tasks pinned to them.
+#define portNUM_PROCESSORS      2
+#define tskIDLE_PRIORITY        ((UBaseType_t) 0)
+#define tskNO_AFFINITY          ((BaseType_t) 0x7fffffff)
+
+#endif // _ESP_SHIM_FREERTOS_H_
@@ -0,0 +1,25 @@
+#ifndef _ESP_SHIM_FREERTOS_QUEUE_H_
+#define _ESP_SHIM_FREERTOS_QUEUE_H_
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct shim_queue* QueueHandle_t;
+
+// Items are copied in and out by value, like FreeRTOS queues.
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+
+#define xQueueSendToBack(queue, item, ticks_to_wait) xQueueSend(queue, item, ticks_to_wait)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ESP_SHIM_FREERTOS_QUEUE_H_
@@ -0,0 +1,26 @@
+#ifndef _ESP_SHIM_FREERTOS_SEMPHR_H_
+#define _ESP_SHIM_FREERTOS_SEMPHR_H_
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Like FreeRTOS, semaphores are queues of zero sized items. A mutex is a
+// binary semaphore that starts out given, priority inheritance is left out.
+typedef QueueHandle_t SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+#define vSemaphoreDelete(semaphore) vQueueDelete(semaphore)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ESP_SHIM_FREERTOS_SEMPHR_H_
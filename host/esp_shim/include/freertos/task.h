@@ -0,0 +1,33 @@
+#ifndef _ESP_SHIM_FREERTOS_TASK_H_
+#define _ESP_SHIM_FREERTOS_TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct shim_task* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+// Tasks run as detached threads. Priorities, stack sizes and core
+// affinities are accepted but left to the host scheduler.
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stack_depth, 
+                                    void* parameters, UBaseType_t priority, TaskHandle_t* created_task, 
+                                    BaseType_t core_id);
+BaseType_t xTaskCreate(TaskFunction_t task, const char* name, uint32_t stack_depth, 
+                        void* parameters, UBaseType_t priority, TaskHandle_t* created_task);
+// Only a task deleting itself is supported.
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _ESP_SHIM_FREERTOS_TASK_H_
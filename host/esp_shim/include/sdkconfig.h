@@ -0,0 +1,7 @@
+#ifndef _ESP_SHIM_SDKCONFIG_H_
+#define _ESP_SHIM_SDKCONFIG_H_
+
+// The host build has no menuconfig, options are passed as compile
+// definitions by host/CMakeLists.txt instead.
+
+#endif // _ESP_SHIM_SDKCONFIG_H_
@@ -0,0 +1,194 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+#include "frame_pool.h"
+
+// Stress test of src/frame_pool.c, the lock-free ring of free frames the
+// pipeline leases its frames from:
+//
+//   frame_pool_stress [-n FRAMES]
+//
+// First on a single thread, the invalid releases must be refused: a frame
+// released twice, whether the ring is full or not, and a pointer outside of
+// the pool. Then an acquiring and a releasing pthread pass FRAMES frames
+// through a queue, as the pipeline stages do, while a third one polls
+// frame_pool_available(): a frame must never be leased twice at once, the
+// frames must arrive with the data written by the acquiring thread, and
+// every frame must be back in the pool at the end. Run it in the
+// -fsanitize=thread build to check the memory orders as well.
+
+#define DEFAULT_FRAMES          200000
+
+// Owners of each frame, the acquiring thread counting up and the releasing
+// one down: more than one means a frame leased twice.
+static atomic_int owners[FRAME_POOL_SIZE];
+static atomic_bool done;
+static atomic_int errors;
+static frame_t* first_frame;
+static QueueHandle_t leased_frames;
+
+static void fail(const char* message, uint32_t image_id)
+{
+    if (atomic_fetch_add(&errors, 1) < 5)
+    {
+        fprintf(stderr, "%s, image %u\n", message, (unsigned int) image_id);
+    }
+}
+
+static int frame_index(const frame_t* frame)
+{
+    // The frames of the pool are a single array, first_frame is one of them.
+    return (int) (frame - first_frame);
+}
+
+static int check_single_thread(void)
+{
+    frame_t* leased[FRAME_POOL_SIZE];
+    frame_t outside;
+    int failures = 0;
+
+    frame_pool_init();
+    for (int i = 0; i < FRAME_POOL_SIZE; i++)
+    {
+        leased[i] = frame_pool_acquire();
+        failures += leased[i] == NULL;
+    }
+    failures += frame_pool_acquire() != NULL;
+    failures += frame_pool_available() != 0;
+
+    // The ring is not full: the second release must be refused all the same.
+    failures += !frame_pool_release(leased[0]);
+    failures += frame_pool_release(leased[0]);
+    failures += frame_pool_available() != 1;
+    failures += frame_pool_release(&outside);
+    failures += frame_pool_release(NULL);
+    for (int i = 1; i < FRAME_POOL_SIZE; i++)
+    {
+        failures += !frame_pool_release(leased[i]);
+    }
+    // The ring is full.
+    failures += frame_pool_release(leased[FRAME_POOL_SIZE - 1]);
+    failures += frame_pool_available() != FRAME_POOL_SIZE;
+
+    // Leased again, the frame can be released again once.
+    frame_t* frame = frame_pool_acquire();
+    failures += frame == NULL || !frame_pool_release(frame) || frame_pool_release(frame);
+
+    first_frame = leased[0];
+    for (int i = 0; i < FRAME_POOL_SIZE; i++)
+    {
+        if (leased[i] < first_frame)
+        {
+            first_frame = leased[i];
+        }
+    }
+    return failures;
+}
+
+static void* acquire_task(void* arg)
+{
+    const uint32_t count = *(const uint32_t*) arg;
+    for (uint32_t image_id = 0; image_id < count; image_id++)
+    {
+        frame_t* frame;
+        while ((frame = frame_pool_acquire()) == NULL)
+        {
+            sched_yield();
+        }
+        if (atomic_fetch_add(&owners[frame_index(frame)], 1) != 0)
+        {
+            fail("Frame leased twice", image_id);
+        }
+        frame->image_id = image_id;
+        memset(frame->data.pixels, (int) (image_id & 0xFF), sizeof(frame->data.pixels));
+        xQueueSend(leased_frames, &frame, portMAX_DELAY);
+    }
+    return NULL;
+}
+
+static void* release_task(void* arg)
+{
+    const uint32_t count = *(const uint32_t*) arg;
+    for (uint32_t image_id = 0; image_id < count; image_id++)
+    {
+        frame_t* frame;
+        xQueueReceive(leased_frames, &frame, portMAX_DELAY);
+        if (frame->image_id != image_id)
+        {
+            fail("Frame out of order", frame->image_id);
+        }
+        if (frame->data.pixels[0] != (uint8_t) image_id
+            || frame->data.pixels[sizeof(frame->data.pixels) - 1] != (uint8_t) image_id)
+        {
+            fail("Frame data overwritten", image_id);
+        }
+        atomic_fetch_sub(&owners[frame_index(frame)], 1);
+        if (!frame_pool_release(frame))
+        {
+            fail("Leased frame refused", image_id);
+        }
+    }
+    atomic_store(&done, true);
+    return NULL;
+}
+
+static void* poll_task(void* arg)
+{
+    (void) arg;
+    while (!atomic_load(&done))
+    {
+        if (frame_pool_available() > FRAME_POOL_SIZE)
+        {
+            fail("More frames available than the pool has", 0);
+        }
+        sched_yield();
+    }
+    return NULL;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t count = DEFAULT_FRAMES;
+    if (argc == 3 && strcmp(argv[1], "-n") == 0)
+    {
+        count = (uint32_t) strtoul(argv[2], NULL, 0);
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s [-n FRAMES]\n", argv[0]);
+        return 1;
+    }
+
+    int failures = check_single_thread();
+    if (failures != 0)
+    {
+        fprintf(stderr, "%d single thread checks failed\n", failures);
+        return 1;
+    }
+
+    frame_pool_init();
+    leased_frames = xQueueCreate(FRAME_POOL_SIZE, sizeof(frame_t*));
+    pthread_t threads[3];
+    pthread_create(&threads[0], NULL, acquire_task, &count);
+    pthread_create(&threads[1], NULL, release_task, &count);
+    pthread_create(&threads[2], NULL, poll_task, NULL);
+    for (int i = 0; i < 3; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    vQueueDelete(leased_frames);
+
+    if (frame_pool_available() != FRAME_POOL_SIZE)
+    {
+        fail("Frames missing from the pool", count);
+    }
+    printf("%u frames passed through the pool, %d errors\n", (unsigned int) count, atomic_load(&errors));
+    return atomic_load(&errors) == 0 ? 0 : 1;
+}
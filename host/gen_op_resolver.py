@@ -0,0 +1,342 @@
+from argparse import ArgumentParser
+import os
+import re
+import struct
+import sys
+
+# Generates the list of operators the app resolves, include/model_ops.h, from
+# the .tflite models it links:
+#
+#   python3 host/gen_op_resolver.py -o include/model_ops.h quant=TF_models/model_quant.tflite ...
+#
+# Each operator comes with the registration and parse function
+# MicroMutableOpResolver adds for it, and is guarded by the models that use
+# it, so that the kernels of the models that are not linked are not either.
+
+PROJECT_ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+TFLM_MICRO_DIR = os.path.join(PROJECT_ROOT, "components", "tfmicro", "tensorflow", "lite", "micro")
+SCHEMA_PATH = os.path.join(PROJECT_ROOT, "components", "tfmicro", "tensorflow", "lite", "schema",
+                           "schema_generated.h")
+MUTABLE_OP_RESOLVER_PATH = os.path.join(TFLM_MICRO_DIR, "micro_mutable_op_resolver.h")
+
+BUILTIN_OPERATOR_RE = re.compile(r"^\s*BuiltinOperator_(\w+) = (-?\d+),", re.M)
+# return AddBuiltin(BuiltinOperator_OP, registration, parser); in an Add
+# function, whose registration may be a parameter with a default value
+ADD_BUILTIN_RE = re.compile(r"TfLiteStatus (Add\w+)\(([^)]*(?:\(\))?)\)\s*\{\s*"
+                            r"return AddBuiltin\(\s*BuiltinOperator_(\w+),\s*(.*?),\s*(\w+)\);", re.S)
+DEFAULT_ARGUMENT_RE = re.compile(r"(\w+)\s*=\s*(.+)$", re.S)
+
+# OperatorCode fields, in the order of the schema
+OPERATOR_CODE_DEPRECATED_BUILTIN_CODE = 0
+OPERATOR_CODE_CUSTOM_CODE = 1
+OPERATOR_CODE_VERSION = 2
+OPERATOR_CODE_BUILTIN_CODE = 3
+MODEL_OPERATOR_CODES = 1
+MODEL_SUBGRAPHS = 2
+MODEL_METADATA = 6
+METADATA_NAME = 0
+SUBGRAPH_OUTPUTS = 2
+SUBGRAPH_OPERATORS = 3
+OPERATOR_OPCODE_INDEX = 0
+OPERATOR_INPUTS = 1
+OPERATOR_OUTPUTS = 2
+# Models with this metadata keep their operators, see MicroAllocator
+OFFLINE_MEMORY_ALLOCATION_METADATA = "OfflineMemoryAllocation"
+# Opcodes above this one no longer fit the deprecated int8 builtin code
+PLACEHOLDER_FOR_GREATER_OP_CODES = 127
+
+# Kernels of chains of builtin operators, which MicroGraph::FuseSubgraphs()
+# runs in their place when the resolver has them: the operators of the chain
+# and the registration
+FUSED_KERNELS = {
+    "CONV_2D_MAX_POOL_2D": (("CONV_2D", "MAX_POOL_2D"), "tflite::Register_CONV_2D_MAX_POOL_2D()"),
+}
+
+
+class FlatbufferTable(object):
+    """Minimal reader of a flatbuffer table, only the scalar, string, vector
+    of ints and vector of tables fields the operators need"""
+
+    def __init__(self, data, position):
+        self.data = data
+        self.position = position
+        vtable = position - struct.unpack_from("<i", data, position)[0]
+        vtable_size = struct.unpack_from("<H", data, vtable)[0]
+        self.field_offsets = struct.unpack_from("<%dH" % ((vtable_size - 4) // 2), data, vtable + 4)
+
+    def field_position(self, field):
+        if field >= len(self.field_offsets) or self.field_offsets[field] == 0:
+            return None
+        return self.position + self.field_offsets[field]
+
+    def scalar(self, field, fmt, default):
+        position = self.field_position(field)
+        return default if position is None else struct.unpack_from(fmt, self.data, position)[0]
+
+    def indirect(self, field):
+        position = self.field_position(field)
+        if position is None:
+            return None
+        return position + struct.unpack_from("<I", self.data, position)[0]
+
+    def string(self, field):
+        position = self.indirect(field)
+        if position is None:
+            return None
+        length = struct.unpack_from("<I", self.data, position)[0]
+        return self.data[position + 4:position + 4 + length].decode("utf-8")
+
+    def ints(self, field):
+        vector = self.indirect(field)
+        if vector is None:
+            return []
+        count = struct.unpack_from("<I", self.data, vector)[0]
+        return list(struct.unpack_from("<%di" % count, self.data, vector + 4))
+
+    def tables(self, field):
+        vector = self.indirect(field)
+        if vector is None:
+            return []
+        count = struct.unpack_from("<I", self.data, vector)[0]
+        elements = []
+        for i in range(count):
+            element = vector + 4 + 4 * i
+            elements.append(FlatbufferTable(self.data, element + struct.unpack_from("<I", self.data, element)[0]))
+        return elements
+
+
+def read_model(path):
+    with open(path, "rb") as model_file:
+        data = model_file.read()
+    if data[4:8] != b"TFL3":
+        raise ValueError("%s is not a TFLite model" % path)
+    return FlatbufferTable(data, struct.unpack_from("<I", data, 0)[0])
+
+
+def read_builtin_codes(model, path):
+    """Builtin code of each operator code of a model"""
+
+    codes = []
+    for operator_code in model.tables(MODEL_OPERATOR_CODES):
+        if operator_code.indirect(OPERATOR_CODE_CUSTOM_CODE) is not None:
+            raise ValueError("%s uses a custom operator, which has to be added by hand" % path)
+        # Models written before the int32 builtin code only have the int8
+        # one, and newer ones have both unless the operator does not fit.
+        deprecated_code = operator_code.scalar(OPERATOR_CODE_DEPRECATED_BUILTIN_CODE, "<b", 0)
+        code = operator_code.scalar(OPERATOR_CODE_BUILTIN_CODE, "<i", 0)
+        if deprecated_code != PLACEHOLDER_FOR_GREATER_OP_CODES:
+            code = max(code, deprecated_code)
+        codes.append(code)
+    return codes
+
+
+def read_operator_codes(path):
+    """(builtin code, version) of the operator codes the operators of a
+    model use. The converter may leave others in the model, that no operator
+    refers to"""
+
+    model = read_model(path)
+    codes = list(zip(read_builtin_codes(model, path),
+                     [operator_code.scalar(OPERATOR_CODE_VERSION, "<i", 1)
+                      for operator_code in model.tables(MODEL_OPERATOR_CODES)]))
+
+    used = set()
+    for subgraph in model.tables(MODEL_SUBGRAPHS):
+        for operator in subgraph.tables(SUBGRAPH_OPERATORS):
+            used.add(operator.scalar(OPERATOR_OPCODE_INDEX, "<I", 0))
+    return [codes[index] for index in sorted(used)]
+
+
+def read_fusable_chains(path, builtin_operators):
+    """Chains of two operators of a model that MicroGraph::FuseSubgraphs()
+    can fuse, as CanFuse() tells them: adjacent, the second one reading the
+    single output of the first one, which nothing else reads. None in models
+    with an offline memory plan"""
+
+    model = read_model(path)
+    for metadata in model.tables(MODEL_METADATA):
+        name = metadata.string(METADATA_NAME)
+        if name is not None and name.startswith(OFFLINE_MEMORY_ALLOCATION_METADATA):
+            return set()
+
+    codes = read_builtin_codes(model, path)
+    chains = set()
+    for subgraph in model.tables(MODEL_SUBGRAPHS):
+        operators = subgraph.tables(SUBGRAPH_OPERATORS)
+        inputs = [operator.ints(OPERATOR_INPUTS) for operator in operators]
+        outputs = [operator.ints(OPERATOR_OUTPUTS) for operator in operators]
+        for i in range(len(operators) - 1):
+            if len(outputs[i]) != 1 or inputs[i + 1] != outputs[i]:
+                continue
+            intermediate = outputs[i][0]
+            if intermediate in subgraph.ints(SUBGRAPH_OUTPUTS):
+                continue
+            if any(intermediate in inputs[k] for k in range(len(operators)) if k != i + 1):
+                continue
+            chains.add(tuple(builtin_operators.get(codes[operator.scalar(OPERATOR_OPCODE_INDEX, "<I", 0)])
+                             for operator in operators[i:i + 2]))
+    return chains
+
+
+def read_builtin_operators():
+    """Names of the BuiltinOperator values of the schema TFLM is built with"""
+
+    with open(SCHEMA_PATH) as schema_file:
+        schema = schema_file.read()
+    return {int(value): name for name, value in BUILTIN_OPERATOR_RE.findall(schema)
+            if name not in ("MIN", "MAX")}
+
+
+def read_kernels():
+    """(registration, parse function) of every builtin operator TFLM has a
+    kernel for, as MicroMutableOpResolver adds them"""
+
+    with open(MUTABLE_OP_RESOLVER_PATH) as resolver_file:
+        resolver = resolver_file.read()
+    kernels = {}
+    for _, parameters, op, registration, parser in ADD_BUILTIN_RE.findall(resolver):
+        registration = " ".join(registration.split())
+        default = DEFAULT_ARGUMENT_RE.search(parameters)
+        if default is not None and default.group(1) == registration:
+            registration = " ".join(default.group(2).split())
+        if not registration.startswith("tflite::"):
+            registration = "tflite::" + registration
+        kernels[op] = (registration, "tflite::" + parser)
+    return kernels
+
+
+def group_by_users(users, names):
+    """One list of operators per set of models using them, in the order of
+    the models then of the operators"""
+
+    groups = []
+    for op in sorted(users, key = lambda op: (names.index(users[op][0]), op)):
+        for group_users, ops in groups:
+            if group_users == users[op]:
+                ops.append(op)
+                break
+        else:
+            groups.append((users[op], [op]))
+    return groups
+
+
+def list_macros(macro, groups, entry):
+    """One macro per group, listing its operators when one of its models is
+    linked"""
+
+    lines = []
+    for index, (group_users, ops) in enumerate(groups):
+        lines.append("#if " + " || ".join("defined(MODEL_REGISTRY_HAS_%s)" % name.upper()
+                                          for name in group_users))
+        lines.append("#define %s_%d(OP) \\" % (macro, index))
+        for op in ops:
+            lines.append("    %s \\" % entry(op))
+        lines[-1] = lines[-1][:-2]
+        lines.append("#else")
+        lines.append("#define %s_%d(OP)" % (macro, index))
+        lines.append("#endif")
+        lines.append("")
+    return lines
+
+
+def generate(models, command):
+    """The header defining MODEL_OPS(OP), one OP(operator, registration,
+    parser) per operator of the linked models, and MODEL_FUSED_OPS(OP), one
+    OP(operator, registration) per fused kernel they may use"""
+
+    builtin_operators = read_builtin_operators()
+    kernels = read_kernels()
+
+    # Models, and highest version, of each operator
+    users = {}
+    versions = {}
+    for name, path in models:
+        for code, version in read_operator_codes(path):
+            op = builtin_operators.get(code)
+            if op is None or op not in kernels:
+                raise ValueError("%s uses operator %s, which TFLM has no kernel for" % (path, op or code))
+            users.setdefault(op, [])
+            if name not in users[op]:
+                users[op].append(name)
+            versions[op] = max(versions.get(op, 0), version)
+
+    # The fused kernels of the chains a model has, that the graph fuses when
+    # the model is allocated.
+    chains = {name: read_fusable_chains(path, builtin_operators) for name, path in models}
+    fused_users = {}
+    for fused, (chain, _) in FUSED_KERNELS.items():
+        chain_users = [name for name, _ in models if chain in chains[name]]
+        if chain_users:
+            fused_users[fused] = chain_users
+
+    names = [name for name, _ in models]
+
+    lines = ["// Generated by host/gen_op_resolver.py, do not edit. Operators of each",
+             "// model, to be regenerated whenever a model changes:",
+             "//   %s" % command,
+             "#ifndef _MODEL_OPS_H_",
+             "#define _MODEL_OPS_H_",
+             "",
+             "#include \"tensorflow/lite/micro/kernels/micro_ops.h\"",
+             "#include \"tensorflow/lite/micro/micro_mutable_op_resolver.h\"",
+             "",
+             "#include \"model_registry.h\"",
+             "",
+             "// Highest version of each operator, the TFLM kernels run every version:"]
+    for op in sorted(users):
+        lines.append("//   %-24s v%d  %s" % (op, versions[op], " ".join(users[op])))
+    lines.append("")
+
+    groups = group_by_users(users, names)
+    lines.extend(list_macros("MODEL_OPS", groups, lambda op: "OP(%s, %s, %s)" % ((op,) + kernels[op])))
+    lines.append("// OP(operator, registration, parser) of every operator of the linked models.")
+    lines.append("#define MODEL_OPS(OP) " + " ".join("MODEL_OPS_%d(OP)" % i for i in range(len(groups))))
+    lines.append("")
+
+    lines.append("// Fused kernels of chains of these operators, see MicroGraph::FuseSubgraphs():")
+    for fused in sorted(fused_users):
+        lines.append("//   %-24s %s  %s" % (fused, " ".join(FUSED_KERNELS[fused][0]), " ".join(fused_users[fused])))
+    lines.append("")
+    fused_groups = group_by_users(fused_users, names)
+    lines.extend(list_macros("MODEL_FUSED_OPS", fused_groups,
+                             lambda fused: "OP(%s, %s)" % (fused, FUSED_KERNELS[fused][1])))
+    lines.append("// OP(operator, registration) of every fused kernel of the linked models.")
+    lines.append("#define MODEL_FUSED_OPS(OP)" + "".join(" MODEL_FUSED_OPS_%d(OP)" % i
+                                                        for i in range(len(fused_groups))))
+    lines.append("")
+    lines.append("#endif // _MODEL_OPS_H_")
+    return "\n".join(lines) + "\n"
+
+
+def parse_model(argument):
+    name, separator, path = argument.partition("=")
+    if not separator or not name or not path:
+        raise ValueError("expected NAME=MODEL.tflite, got %s" % argument)
+    return name, path
+
+
+# Define and parse the command line arguments
+cli = ArgumentParser(description = "Generates the operator list of the app's op resolver")
+cli.add_argument(
+    "-o", "--output", type = str, metavar = "HEADER", dest = "output", default = None,
+    help = "Header to write, include/model_ops.h, instead of the standard output")
+cli.add_argument(
+    "models", type = str, metavar = "NAME=MODEL.tflite", nargs = "+",
+    help = "Model registry name and flatbuffer of every model the app can link")
+
+if __name__ == '__main__':
+    arguments = cli.parse_args()
+    try:
+        models = [parse_model(argument) for argument in arguments.models]
+        command = "gen_op_resolver.py%s %s" % (" -o " + arguments.output if arguments.output else "",
+                                               " ".join(arguments.models))
+        header = generate(models, command)
+    except (IOError, ValueError, struct.error) as err:
+        print(err, file = sys.stderr)
+        sys.exit(1)
+
+    if arguments.output:
+        with open(arguments.output, "w") as header_file:
+            header_file.write(header)
+    else:
+        sys.stdout.write(header)
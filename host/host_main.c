@@ -0,0 +1,80 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+
+#include "app_tflite.h"
+#include "app_httpClient.h"
+#include "app_pipeline.h"
+#include "model_registry.h"
+#include "model_source.h"
+
+static const char *TAG = "Host_Main";
+
+// Largest model downloaded whole into RAM, files are mapped whatever their
+// size.
+#define HOST_MODEL_MAX_SIZE     (4 * 1024 * 1024)
+
+// Same start-up as app_main(), minus the WiFi, and the process exits once
+// the pipeline has exported the results. The model to run can be given by
+// name as the first argument, or as a model source URI, a .tflite file path
+// or an http:// URL, the number of interpreters running it side by
+// side as the second one and the images per invoke as the third one, 1 by
+// default.
+int main(int argc, char** argv)
+{
+    ESP_LOGI(TAG, "Starting main application");
+
+    const model_entry_t* model = model_registry_default();
+    static model_source_t source;
+    if (argc > 1 && (model = model_registry_find(argv[1])) == NULL
+        && model_source_open(argv[1], HOST_MODEL_MAX_SIZE, &source) == ESP_OK)
+    {
+        model = &source.entry;
+    }
+    if (model == NULL)
+    {
+        ESP_LOGE(TAG, "Unknown model %s, the linked models are:", argv[1]);
+        for (size_t i = 0; i < model_registry_count(); i++)
+        {
+            ESP_LOGE(TAG, "  %s", model_registry_get(i)->name);
+        }
+        return 1;
+    }
+    int instance_count = (argc > 2) ? atoi(argv[2]) : 1;
+    if (instance_count < 1 || instance_count > TF_MAX_INSTANCES)
+    {
+        ESP_LOGE(TAG, "From 1 to %d interpreters can run the model.", TF_MAX_INSTANCES);
+        return 1;
+    }
+    int batch_size = (argc > 3) ? atoi(argv[3]) : 1;
+    if (batch_size < 1 || batch_size > TF_MAX_BATCH)
+    {
+        ESP_LOGE(TAG, "From 1 to %d images can run per invoke.", TF_MAX_BATCH);
+        return 1;
+    }
+
+#ifndef CONFIG_BENCHMARK_SYNTHETIC_INPUT
+    app_httpClient_main();
+#endif
+    TF_init_status = app_tflite_init_model(model, instance_count, batch_size);
+    if (TF_init_status != ESP_OK)
+    {
+        ESP_LOGE(TAG, "TfLite was not initialized");
+        return 1;
+    }
+
+    if (app_pipeline_start() != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Inference pipeline was not started");
+        return 1;
+    }
+    app_pipeline_wait();
+
+    ESP_LOGI(TAG, "Main application execution completed.");
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_timer.h"
+
+#include "app_httpClient.h"
+#include "model_settings.h"
+
+// Times the image downloads of src/app_httpClient.c against
+// Images_server/images_server.py on SERVER_IP:SERVER_HTTP_PORT: IMAGES
+// images fetched one per httpClient_getImage() call, as PGM, then the same
+// images fetched BATCH per httpClient_getImages() call, as raw frames, for
+// each BATCH given:
+//
+//   http_fetch_benchmark [-n IMAGES] [-b BATCH]...
+//
+// Both go over the keep-alive session of the app, the single-image path
+// logs every image as it does on the device. The batched frames must match
+// the single images.
+
+#define DEFAULT_IMAGES          1000
+// MAX_BATCH_SIZE of the images server.
+#define MAX_BATCH_SIZE          256
+#define MAX_BATCH_RUNS          8
+
+static const uint32_t default_batch_sizes[] = { 4, 16, 64, 256 };
+
+static void usage(const char* program)
+{
+    fprintf(stderr, "usage: %s [-n IMAGES] [-b BATCH]...\n", program);
+}
+
+static void report(const char* name, uint32_t count, int64_t elapsed_us)
+{
+    double elapsed_s = elapsed_us / 1e6;
+    printf("%-24s %6u images in %7.2f s: %8.1f images/s\n", name, (unsigned) count, elapsed_s,
+           count / elapsed_s);
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t count = DEFAULT_IMAGES;
+    uint32_t batch_sizes[MAX_BATCH_RUNS];
+    int batch_runs = 0;
+    for (int i = 1; i < argc; i += 2)
+    {
+        if (i + 1 >= argc)
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        if (strcmp(argv[i], "-n") == 0)
+        {
+            count = (uint32_t) strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-b") == 0 && batch_runs < MAX_BATCH_RUNS)
+        {
+            batch_sizes[batch_runs++] = (uint32_t) strtoul(argv[i + 1], NULL, 0);
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (batch_runs == 0)
+    {
+        batch_runs = sizeof(default_batch_sizes) / sizeof(default_batch_sizes[0]);
+        memcpy(batch_sizes, default_batch_sizes, sizeof(default_batch_sizes));
+    }
+    for (int run = 0; run < batch_runs; run++)
+    {
+        if (batch_sizes[run] < 1 || batch_sizes[run] > MAX_BATCH_SIZE)
+        {
+            fprintf(stderr, "Batches are of 1 to %d images.\n", MAX_BATCH_SIZE);
+            return 1;
+        }
+    }
+    if (count < 1 || count > kTestImageCount)
+    {
+        fprintf(stderr, "From 1 to %d images can be fetched.\n", kTestImageCount);
+        return 1;
+    }
+
+    // Every image of the single-image pass is kept to check the batches.
+    uint8_t* images = malloc((size_t) count * kMaxImageSize);
+    uint8_t* frames[MAX_BATCH_SIZE];
+    uint8_t* frame_data = malloc((size_t) MAX_BATCH_SIZE * kMaxImageSize);
+    if (images == NULL || frame_data == NULL)
+    {
+        fprintf(stderr, "Out of memory for %u images.\n", (unsigned) count);
+        return 1;
+    }
+    for (int i = 0; i < MAX_BATCH_SIZE; i++)
+    {
+        frames[i] = frame_data + (size_t) i * kMaxImageSize;
+    }
+
+    app_httpClient_main();
+
+    int64_t start_time = esp_timer_get_time();
+    for (uint32_t image_id = 0; image_id < count; image_id++)
+    {
+        if (httpClient_getImage(image_id, images + (size_t) image_id * kMaxImageSize) != ESP_OK)
+        {
+            fprintf(stderr, "Image %u could not be fetched.\n", (unsigned) image_id);
+            return 1;
+        }
+    }
+    int64_t single_time = esp_timer_get_time() - start_time;
+
+    int64_t batch_times[MAX_BATCH_RUNS];
+    uint32_t mismatches = 0;
+    for (int run = 0; run < batch_runs; run++)
+    {
+        start_time = esp_timer_get_time();
+        for (uint32_t start_id = 0; start_id < count; start_id += batch_sizes[run])
+        {
+            uint32_t batch = (count - start_id < batch_sizes[run]) ? count - start_id : batch_sizes[run];
+            if (httpClient_getImages(start_id, batch, frames) != ESP_OK)
+            {
+                fprintf(stderr, "Images %u to %u could not be fetched.\n", (unsigned) start_id,
+                        (unsigned) (start_id + batch - 1));
+                return 1;
+            }
+            for (uint32_t i = 0; i < batch; i++)
+            {
+                mismatches += memcmp(frames[i], images + (size_t) (start_id + i) * kMaxImageSize,
+                                     kMaxImageSize) != 0;
+            }
+        }
+        batch_times[run] = esp_timer_get_time() - start_time;
+    }
+
+    report("single (pgm)", count, single_time);
+    for (int run = 0; run < batch_runs; run++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "batched (raw) x%u", (unsigned) batch_sizes[run]);
+        report(name, count, batch_times[run]);
+    }
+    free(frame_data);
+    free(images);
+    if (mismatches != 0)
+    {
+        fprintf(stderr, "%u batched images differ from the single ones.\n", (unsigned) mismatches);
+        return 1;
+    }
+    return 0;
+}
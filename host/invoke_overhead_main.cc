@@ -0,0 +1,250 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+
+// Micro-benchmark of the interpreter overhead: times Invoke() on .tflite
+// models with the regular graph walk and with the frozen dispatch table of
+// MicroInterpreter::FreezeGraph(), on the same inputs:
+//
+//   invoke_overhead TF_models/*.tflite
+//
+// The kernels take nearly all of an invoke, so the overhead is measured
+// apart, with kernels whose invoke does nothing: what is left is the
+// interpreter. Both interpreters run in turns of a batch of invokes, and the
+// fastest turn of each is kept, the one least disturbed by the rest of the
+// machine.
+namespace {
+  constexpr size_t kArenaSize = 256 * 1024;
+  constexpr size_t kArenaAlignment = 16;
+  constexpr int kDefaultRounds = 100;
+  constexpr int kModelBatchInvokes = 20;
+  constexpr int kOverheadBatchInvokes = 1000;
+  // Operator types of a model.
+  constexpr int kMaxRegistrations = 32;
+
+  tflite::MicroErrorReporter micro_error_reporter;
+
+  // Resolves the operators to the kernels of another resolver, with an
+  // invoke that does nothing.
+  class EmptyKernelOpResolver : public tflite::MicroOpResolver {
+   public:
+    explicit EmptyKernelOpResolver(const tflite::MicroOpResolver& op_resolver) : op_resolver_(op_resolver) {}
+
+    const TfLiteRegistration* FindOp(tflite::BuiltinOperator op) const override
+    {
+      return empty_kernel(op_resolver_.FindOp(op));
+    }
+
+    const TfLiteRegistration* FindOp(const char* op) const override
+    {
+      return empty_kernel(op_resolver_.FindOp(op));
+    }
+
+    BuiltinParseFunction GetOpDataParser(tflite::BuiltinOperator op) const override
+    {
+      return op_resolver_.GetOpDataParser(op);
+    }
+
+   private:
+    static TfLiteStatus empty_invoke(TfLiteContext* context, TfLiteNode* node)
+    {
+      return kTfLiteOk;
+    }
+
+    const TfLiteRegistration* empty_kernel(const TfLiteRegistration* kernel) const
+    {
+      if (kernel == nullptr)
+      {
+        return nullptr;
+      }
+      for (int i = 0; i < count_; i++)
+      {
+        if (kernels_[i] == kernel)
+        {
+          return &registrations_[i];
+        }
+      }
+      if (count_ == kMaxRegistrations)
+      {
+        return nullptr;
+      }
+      kernels_[count_] = kernel;
+      registrations_[count_] = *kernel;
+      registrations_[count_].invoke = empty_invoke;
+      return &registrations_[count_++];
+    }
+
+    const tflite::MicroOpResolver& op_resolver_;
+    mutable const TfLiteRegistration* kernels_[kMaxRegistrations];
+    mutable TfLiteRegistration registrations_[kMaxRegistrations];
+    mutable int count_ = 0;
+
+    TF_LITE_REMOVE_VIRTUAL_DELETE
+  };
+
+  // Fastest mean duration of one invoke, in us, of the regular and the
+  // frozen interpreter.
+  typedef struct
+  {
+      double regular_us;
+      double frozen_us;
+  } invoke_times_t;
+
+  void usage(const char* program)
+  {
+    fprintf(stderr, "usage: %s [-r ROUNDS] MODEL.tflite...\n", program);
+  }
+
+  // The flatbuffer must be aligned like the arrays the app links.
+  uint8_t* read_model(const char* path)
+  {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+      return nullptr;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    size_t allocated = (static_cast<size_t>(size) + kArenaAlignment - 1) / kArenaAlignment * kArenaAlignment;
+    uint8_t* data = static_cast<uint8_t*>(aligned_alloc(kArenaAlignment, allocated));
+    if (data != nullptr && fread(data, 1, size, file) != static_cast<size_t>(size))
+    {
+      free(data);
+      data = nullptr;
+    }
+    fclose(file);
+    return data;
+  }
+
+  void fill_input(tflite::MicroInterpreter* interpreter)
+  {
+    uint32_t state = 0x2545F491;
+    TfLiteTensor* input = interpreter->input(0);
+    for (size_t b = 0; b < input->bytes; b++)
+    {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      // Also valid floats, between 2^-128 and 2^2.
+      input->data.uint8[b] = static_cast<uint8_t>(state >> 24) & ((b % 4 == 3) ? 0x3F : 0xFF);
+    }
+  }
+
+  // Mean duration of one invoke over a batch, in us, or a negative value if
+  // one fails.
+  double time_batch(tflite::MicroInterpreter* interpreter, int invokes)
+  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < invokes; i++)
+    {
+      if (interpreter->Invoke() != kTfLiteOk)
+      {
+        return -1.0;
+      }
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / invokes;
+  }
+
+  // Returns whether the outputs of both interpreters are the same.
+  bool time_invokes(const tflite::Model* model, const tflite::MicroOpResolver& op_resolver, int rounds,
+                    int batch_invokes, uint8_t* arenas[2], invoke_times_t* times)
+  {
+    tflite::MicroInterpreter regular(model, op_resolver, arenas[0], kArenaSize, &micro_error_reporter);
+    tflite::MicroInterpreter frozen(model, op_resolver, arenas[1], kArenaSize, &micro_error_reporter);
+    if (regular.AllocateTensors() != kTfLiteOk || frozen.AllocateTensors() != kTfLiteOk
+        || frozen.FreezeGraph() != kTfLiteOk)
+    {
+      return false;
+    }
+    fill_input(&regular);
+    fill_input(&frozen);
+    for (int round = 0; round < rounds; round++)
+    {
+      double regular_us = time_batch(&regular, batch_invokes);
+      double frozen_us = time_batch(&frozen, batch_invokes);
+      if (regular_us < 0.0 || frozen_us < 0.0)
+      {
+        return false;
+      }
+      if (round == 0 || regular_us < times->regular_us)
+      {
+        times->regular_us = regular_us;
+      }
+      if (round == 0 || frozen_us < times->frozen_us)
+      {
+        times->frozen_us = frozen_us;
+      }
+    }
+    return memcmp(regular.output(0)->data.raw, frozen.output(0)->data.raw, regular.output(0)->bytes) == 0;
+  }
+
+  int benchmark_model(const char* path, int rounds, uint8_t* arenas[2])
+  {
+    static tflite::AllOpsResolver op_resolver;
+    static EmptyKernelOpResolver empty_op_resolver(op_resolver);
+    uint8_t* data = read_model(path);
+    if (data == nullptr)
+    {
+      fprintf(stderr, "Cannot read %s\n", path);
+      return 1;
+    }
+    const tflite::Model* model = tflite::GetModel(data);
+    invoke_times_t model_times;
+    invoke_times_t overhead_times;
+    if (!time_invokes(model, op_resolver, rounds, kModelBatchInvokes, arenas, &model_times)
+        || !time_invokes(model, empty_op_resolver, rounds, kOverheadBatchInvokes, arenas, &overhead_times))
+    {
+      fprintf(stderr, "%s failed to run, or its frozen graph computed other outputs\n", path);
+      free(data);
+      return 1;
+    }
+
+    const char* name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    const size_t operators = model->subgraphs()->Get(0)->operators()->size();
+    const double saved_us = overhead_times.regular_us - overhead_times.frozen_us;
+    printf("%-24s %9u %13.2f %12.2f %16.3f %15.3f %9.3f %8.3f%%\n", name, (unsigned) operators,
+           model_times.regular_us, model_times.frozen_us, overhead_times.regular_us, overhead_times.frozen_us,
+           saved_us, 100.0 * saved_us / model_times.regular_us);
+    free(data);
+    return 0;
+  }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  int rounds = kDefaultRounds;
+  int first_model = 1;
+  for (; first_model < argc && argv[first_model][0] == '-'; first_model += 2)
+  {
+    if (first_model + 1 >= argc || strcmp(argv[first_model], "-r") != 0)
+    {
+      usage(argv[0]);
+      return 1;
+    }
+    rounds = atoi(argv[first_model + 1]);
+  }
+  if (first_model >= argc || rounds <= 0)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  uint8_t* arenas[2] = {static_cast<uint8_t*>(aligned_alloc(kArenaAlignment, kArenaSize)),
+                        static_cast<uint8_t*>(aligned_alloc(kArenaAlignment, kArenaSize))};
+  printf("%-24s %9s %13s %12s %16s %15s %9s %9s\n", "model", "operators", "invoke us", "frozen us",
+         "overhead us", "frozen overhead", "saved us", "of invoke");
+  int status = 0;
+  for (int i = first_model; i < argc && status == 0; i++)
+  {
+    status = benchmark_model(argv[i], rounds, arenas);
+  }
+  free(arenas[0]);
+  free(arenas[1]);
+  return status;
+}
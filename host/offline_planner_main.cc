@@ -0,0 +1,560 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flatbuffers/flatbuffers.h"
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/recording_micro_interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// Plans the tensor arena of .tflite models offline, with a search that is
+// exact within its time limit, and writes the offsets into the models'
+// OfflineMemoryAllocation metadata, which MicroAllocator uses instead of
+// running its GreedyMemoryPlanner:
+//
+//   offline_planner -o planned TF_models/*.tflite
+//
+// Prints, for each model, the arena head (planned tensors and scratch
+// buffers) TFLM needs with the greedy plan and with the offline one, both
+// measured by allocating the model, and the lower bound no plan can beat:
+// the most bytes live at once. The planned model is checked to run with
+// exactly the planned offsets and the same outputs.
+namespace {
+  constexpr size_t kArenaSize = 1024 * 1024;
+  // As in MicroAllocator, which rounds up the planned sizes to it.
+  constexpr size_t kBufferAlignment = 16;
+  constexpr char kOfflineMemAllocMetadata[] = "OfflineMemoryAllocation";
+  constexpr int32_t kOnlinePlannedBuffer = -1;
+  constexpr double kDefaultTimeLimit = 10.0;
+  // Nodes of the search between two looks at the clock.
+  constexpr unsigned kClockPeriod = 4096;
+
+  tflite::MicroErrorReporter micro_error_reporter;
+
+  // Tensor data the planner places, with the lifetime MicroAllocator gives it.
+  typedef struct
+  {
+      int tensor;
+      size_t size;
+      int first_created;
+      int last_used;
+      size_t offset;
+  } planned_buffer_t;
+
+  // Exposes what the planner needs of an allocated interpreter: the tensor
+  // data and how much of the arena head it takes.
+  class PlanningInterpreter : public tflite::RecordingMicroInterpreter {
+   public:
+    PlanningInterpreter(const tflite::Model* model, const tflite::MicroOpResolver& op_resolver,
+                        uint8_t* arena, size_t arena_size)
+        : tflite::RecordingMicroInterpreter(model, op_resolver, arena, arena_size, &micro_error_reporter) {}
+
+    TfLiteEvalTensor* eval_tensor(int index) const
+    {
+      return context().GetEvalTensor(&context(), index);
+    }
+
+    size_t head_bytes() const
+    {
+      return GetMicroAllocator().GetSimpleMemoryAllocator()->GetHeadUsedBytes();
+    }
+  };
+
+  void usage(const char* program)
+  {
+    fprintf(stderr, "usage: %s [-o OUTPUT_DIR] [-t SECONDS] MODEL.tflite...\n", program);
+  }
+
+  // The flatbuffer must be aligned like the arrays the app links.
+  uint8_t* copy_aligned(const uint8_t* data, size_t size)
+  {
+    size_t allocated = (size + kBufferAlignment - 1) / kBufferAlignment * kBufferAlignment;
+    uint8_t* copy = static_cast<uint8_t*>(aligned_alloc(kBufferAlignment, allocated));
+    if (copy != nullptr)
+    {
+      memcpy(copy, data, size);
+    }
+    return copy;
+  }
+
+  bool read_file(const char* path, std::vector<uint8_t>* data)
+  {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+      return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data->resize(size);
+    bool read = fread(data->data(), 1, size, file) == static_cast<size_t>(size);
+    fclose(file);
+    return read;
+  }
+
+  bool overlap_in_time(const planned_buffer_t& a, const planned_buffer_t& b)
+  {
+    return a.first_created <= b.last_used && b.first_created <= a.last_used;
+  }
+
+  size_t plan_peak(const std::vector<planned_buffer_t>& buffers)
+  {
+    size_t peak = 0;
+    for (const planned_buffer_t& buffer : buffers)
+    {
+      if (buffer.offset + buffer.size > peak)
+      {
+        peak = buffer.offset + buffer.size;
+      }
+    }
+    return peak;
+  }
+
+  // Most bytes live during one operator: no plan fits in less.
+  size_t live_bytes_bound(const std::vector<planned_buffer_t>& buffers, int operator_count)
+  {
+    size_t bound = 0;
+    for (int op = 0; op < operator_count; op++)
+    {
+      size_t live = 0;
+      for (const planned_buffer_t& buffer : buffers)
+      {
+        if (buffer.first_created <= op && op <= buffer.last_used)
+        {
+          live += buffer.size;
+        }
+      }
+      if (live > bound)
+      {
+        bound = live;
+      }
+    }
+    return bound;
+  }
+
+  // Computes the lifetimes of the buffers as AllocationInfoBuilder::AddTensors
+  // does, including outputs no operator consumes.
+  void set_lifetimes(const tflite::SubGraph* subgraph, std::vector<planned_buffer_t>* buffers)
+  {
+    const int operator_count = subgraph->operators()->size();
+    std::vector<int> first_created(subgraph->tensors()->size(), -1);
+    std::vector<int> last_used(subgraph->tensors()->size(), -1);
+    for (size_t i = 0; i < subgraph->inputs()->size(); i++)
+    {
+      first_created[subgraph->inputs()->Get(i)] = 0;
+    }
+    for (size_t i = 0; i < subgraph->outputs()->size(); i++)
+    {
+      last_used[subgraph->outputs()->Get(i)] = operator_count - 1;
+    }
+    for (int op = operator_count - 1; op >= 0; op--)
+    {
+      const tflite::Operator* node = subgraph->operators()->Get(op);
+      for (size_t n = 0; n < node->inputs()->size(); n++)
+      {
+        const int tensor = node->inputs()->Get(n);
+        if (tensor >= 0 && last_used[tensor] < op)
+        {
+          last_used[tensor] = op;
+        }
+      }
+      for (size_t n = 0; n < node->outputs()->size(); n++)
+      {
+        const int tensor = node->outputs()->Get(n);
+        if (first_created[tensor] == -1 || first_created[tensor] > op)
+        {
+          first_created[tensor] = op;
+        }
+        if (last_used[tensor] < first_created[tensor])
+        {
+          last_used[tensor] = first_created[tensor];
+        }
+      }
+    }
+    for (planned_buffer_t& buffer : *buffers)
+    {
+      buffer.first_created = first_created[buffer.tensor];
+      buffer.last_used = last_used[buffer.tensor];
+    }
+  }
+
+  // Branch and bound over the plans where each buffer lies at offset 0 or
+  // right above a buffer living at the same time as it. Every plan can be
+  // compacted into one of them without growing, so the search is exact when
+  // it completes. The buffers are placed by increasing offset, the ties by
+  // index, so that each plan is only reached once.
+  class OffsetSearch {
+   public:
+    OffsetSearch(const std::vector<planned_buffer_t>& buffers, int operator_count, double time_limit)
+        : buffers_(buffers),
+          operator_count_(operator_count),
+          placed_(buffers.size(), false),
+          deadline_(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double>(time_limit))) {}
+
+    // Starts from the best plan known, and returns whether the result is
+    // proven optimal.
+    bool Run(std::vector<planned_buffer_t>* best)
+    {
+      best_ = *best;
+      best_peak_ = plan_peak(best_);
+      bound_ = live_bytes_bound(buffers_, operator_count_);
+      if (best_peak_ > bound_)
+      {
+        Place(0, 0, -1);
+      }
+      *best = best_;
+      return !timed_out_;
+    }
+
+    size_t lower_bound() const { return bound_; }
+    unsigned long long nodes() const { return nodes_; }
+
+   private:
+    bool Fits(size_t index, size_t offset) const
+    {
+      const planned_buffer_t& buffer = buffers_[index];
+      for (size_t i = 0; i < buffers_.size(); i++)
+      {
+        const planned_buffer_t& other = buffers_[i];
+        if (placed_[i] && overlap_in_time(buffer, other)
+            && offset < other.offset + other.size && other.offset < offset + buffer.size)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // The buffers still to place all lie above floor, those living during
+    // the same operator on top of each other.
+    bool Bounded(size_t floor) const
+    {
+      for (int op = 0; op < operator_count_; op++)
+      {
+        size_t live = floor;
+        for (size_t i = 0; i < buffers_.size(); i++)
+        {
+          if (!placed_[i] && buffers_[i].first_created <= op && op <= buffers_[i].last_used)
+          {
+            live += buffers_[i].size;
+          }
+        }
+        if (live >= best_peak_)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void Place(size_t placed_count, size_t floor, int last_index)
+    {
+      if (timed_out_ || best_peak_ == bound_)
+      {
+        return;
+      }
+      if (++nodes_ % kClockPeriod == 0 && std::chrono::steady_clock::now() > deadline_)
+      {
+        timed_out_ = true;
+        return;
+      }
+      if (placed_count == buffers_.size())
+      {
+        size_t peak = plan_peak(buffers_);
+        if (peak < best_peak_)
+        {
+          best_peak_ = peak;
+          best_ = buffers_;
+        }
+        return;
+      }
+      if (Bounded(floor))
+      {
+        return;
+      }
+      for (size_t i = 0; i < buffers_.size(); i++)
+      {
+        if (placed_[i])
+        {
+          continue;
+        }
+        // Offset 0 then the top of every placed buffer living at the same time.
+        for (size_t k = 0; k <= buffers_.size(); k++)
+        {
+          size_t offset = 0;
+          if (k < buffers_.size())
+          {
+            if (!placed_[k] || !overlap_in_time(buffers_[i], buffers_[k]))
+            {
+              continue;
+            }
+            offset = buffers_[k].offset + buffers_[k].size;
+          }
+          if (offset < floor || (offset == floor && static_cast<int>(i) < last_index)
+              || offset + buffers_[i].size >= best_peak_ || !Fits(i, offset))
+          {
+            continue;
+          }
+          buffers_[i].offset = offset;
+          placed_[i] = true;
+          Place(placed_count + 1, offset, i);
+          placed_[i] = false;
+        }
+      }
+    }
+
+    std::vector<planned_buffer_t> buffers_;
+    const int operator_count_;
+    std::vector<bool> placed_;
+    const std::chrono::steady_clock::time_point deadline_;
+    std::vector<planned_buffer_t> best_;
+    size_t best_peak_ = 0;
+    size_t bound_ = 0;
+    unsigned long long nodes_ = 0;
+    bool timed_out_ = false;
+  };
+
+  // Same pseudo-random inputs for the original and the planned model.
+  void fill_inputs(PlanningInterpreter* interpreter)
+  {
+    uint32_t state = 0x2545F491;
+    for (size_t i = 0; i < interpreter->inputs_size(); i++)
+    {
+      TfLiteTensor* input = interpreter->input(i);
+      for (size_t b = 0; b < input->bytes; b++)
+      {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        if (input->type == kTfLiteFloat32 && b % sizeof(float) == 0)
+        {
+          input->data.f[b / sizeof(float)] = (state >> 8) / 16777216.0f;
+          b += sizeof(float) - 1;
+        } else {
+          input->data.uint8[b] = static_cast<uint8_t>(state >> 24);
+        }
+      }
+    }
+  }
+
+  std::vector<uint8_t> invoke_outputs(PlanningInterpreter* interpreter)
+  {
+    std::vector<uint8_t> outputs;
+    fill_inputs(interpreter);
+    if (interpreter->Invoke() != kTfLiteOk)
+    {
+      return outputs;
+    }
+    for (size_t i = 0; i < interpreter->outputs_size(); i++)
+    {
+      const TfLiteTensor* output = interpreter->output(i);
+      outputs.insert(outputs.end(), output->data.uint8, output->data.uint8 + output->bytes);
+    }
+    return outputs;
+  }
+
+  // Returns the model with the offsets of the plan in its
+  // OfflineMemoryAllocation metadata, replacing any previous one:
+  // [version 1, subgraph 0, tensor count, the offset of each tensor], -1
+  // leaving a tensor to the online planner.
+  std::vector<uint8_t> write_plan(const uint8_t* data, size_t tensor_count,
+                                  const std::vector<planned_buffer_t>& buffers)
+  {
+    std::vector<int32_t> offsets(3 + tensor_count, kOnlinePlannedBuffer);
+    offsets[0] = 1;
+    offsets[1] = 0;
+    offsets[2] = static_cast<int32_t>(tensor_count);
+    for (const planned_buffer_t& buffer : buffers)
+    {
+      offsets[3 + buffer.tensor] = static_cast<int32_t>(buffer.offset);
+    }
+
+    std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(data);
+    tflite::MetadataT* metadata = nullptr;
+    for (std::unique_ptr<tflite::MetadataT>& entry : model->metadata)
+    {
+      if (entry->name == kOfflineMemAllocMetadata)
+      {
+        metadata = entry.get();
+      }
+    }
+    if (metadata == nullptr)
+    {
+      model->metadata.emplace_back(new tflite::MetadataT());
+      metadata = model->metadata.back().get();
+      metadata->name = kOfflineMemAllocMetadata;
+      metadata->buffer = model->buffers.size();
+      model->buffers.emplace_back(new tflite::BufferT());
+    }
+    std::vector<uint8_t>& bytes = model->buffers[metadata->buffer]->data;
+    bytes.resize(offsets.size() * sizeof(int32_t));
+    memcpy(bytes.data(), offsets.data(), bytes.size());
+
+    flatbuffers::FlatBufferBuilder builder;
+    tflite::FinishModelBuffer(builder, tflite::Model::Pack(builder, model.get()));
+    return std::vector<uint8_t>(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+  }
+
+  bool write_file(const char* path, const std::vector<uint8_t>& data)
+  {
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr)
+    {
+      return false;
+    }
+    bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+    return (fclose(file) == 0) && written;
+  }
+
+  int plan_model(const char* path, const char* output_dir, double time_limit, uint8_t* arena)
+  {
+    static tflite::AllOpsResolver op_resolver;
+    std::vector<uint8_t> file;
+    if (!read_file(path, &file))
+    {
+      fprintf(stderr, "Cannot read %s\n", path);
+      return 1;
+    }
+    uint8_t* data = copy_aligned(file.data(), file.size());
+    const tflite::Model* model = tflite::GetModel(data);
+    if (model->subgraphs()->size() != 1)
+    {
+      fprintf(stderr, "%s: only models with one subgraph can be planned\n", path);
+      free(data);
+      return 1;
+    }
+    const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+    const size_t tensor_count = subgraph->tensors()->size();
+
+    // The greedy plan, as the app runs it. Its tensors in the arena head are
+    // the ones to plan, with the sizes the kernels gave them at Prepare().
+    std::vector<planned_buffer_t> buffers;
+    size_t greedy_head;
+    std::vector<uint8_t> greedy_outputs;
+    {
+      PlanningInterpreter interpreter(model, op_resolver, arena, kArenaSize);
+      if (interpreter.AllocateTensors() != kTfLiteOk)
+      {
+        fprintf(stderr, "%s does not run in a %u bytes arena\n", path, (unsigned) kArenaSize);
+        free(data);
+        return 1;
+      }
+      greedy_head = interpreter.head_bytes();
+      for (size_t i = 0; i < tensor_count; i++)
+      {
+        const TfLiteEvalTensor* tensor = interpreter.eval_tensor(i);
+        const uint8_t* tensor_data = static_cast<const uint8_t*>(tensor->data.data);
+        if (tensor_data == nullptr || tensor_data < arena || tensor_data >= arena + greedy_head)
+        {
+          continue;
+        }
+        size_t bytes = 0;
+        tflite::TfLiteEvalTensorByteLength(tensor, &bytes);
+        planned_buffer_t buffer;
+        buffer.tensor = i;
+        buffer.size = tflite::AlignSizeUp(bytes, kBufferAlignment);
+        buffer.offset = tensor_data - arena;
+        buffers.push_back(buffer);
+      }
+      greedy_outputs = invoke_outputs(&interpreter);
+    }
+    set_lifetimes(subgraph, &buffers);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    OffsetSearch search(buffers, subgraph->operators()->size(), time_limit);
+    std::vector<planned_buffer_t> plan = buffers;
+    bool optimal = search.Run(&plan);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // The planned model must get exactly the planned offsets, and compute
+    // the same outputs.
+    std::vector<uint8_t> planned = write_plan(data, tensor_count, plan);
+    uint8_t* planned_data = copy_aligned(planned.data(), planned.size());
+    size_t offline_head = 0;
+    bool verified = false;
+    {
+      PlanningInterpreter interpreter(tflite::GetModel(planned_data), op_resolver, arena, kArenaSize);
+      if (interpreter.AllocateTensors() == kTfLiteOk)
+      {
+        offline_head = interpreter.head_bytes();
+        verified = true;
+        for (const planned_buffer_t& buffer : plan)
+        {
+          verified = verified && interpreter.eval_tensor(buffer.tensor)->data.raw == reinterpret_cast<char*>(arena + buffer.offset);
+        }
+        verified = verified && !greedy_outputs.empty() && invoke_outputs(&interpreter) == greedy_outputs;
+      }
+    }
+    free(planned_data);
+    free(data);
+
+    const char* name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    printf("%-24s %7u %7u %11u %12u %7d  %s, %.2f s, %llu nodes%s\n", name, (unsigned) plan.size(),
+           (unsigned) search.lower_bound(), (unsigned) greedy_head, (unsigned) offline_head,
+           static_cast<int>(greedy_head) - static_cast<int>(offline_head),
+           optimal ? "optimal" : "time limit", seconds, search.nodes(), verified ? "" : ", NOT VERIFIED");
+    if (!verified)
+    {
+      return 1;
+    }
+
+    if (output_dir != nullptr)
+    {
+      std::string output_path = std::string(output_dir) + "/" + name;
+      if (!write_file(output_path.c_str(), planned))
+      {
+        fprintf(stderr, "Cannot write %s\n", output_path.c_str());
+        return 1;
+      }
+    }
+    return 0;
+  }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const char* output_dir = nullptr;
+  double time_limit = kDefaultTimeLimit;
+  int first_model = 1;
+  for (; first_model < argc && argv[first_model][0] == '-'; first_model += 2)
+  {
+    if (first_model + 1 >= argc)
+    {
+      usage(argv[0]);
+      return 1;
+    }
+    if (strcmp(argv[first_model], "-o") == 0)
+    {
+      output_dir = argv[first_model + 1];
+    } else if (strcmp(argv[first_model], "-t") == 0) {
+      time_limit = strtod(argv[first_model + 1], nullptr);
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (first_model >= argc)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  uint8_t* arena = static_cast<uint8_t*>(aligned_alloc(kBufferAlignment, kArenaSize));
+  printf("%-24s %7s %7s %11s %12s %7s  %s\n", "model", "tensors", "bound", "greedy head",
+         "offline head", "saved", "search");
+  int status = 0;
+  for (int i = first_model; i < argc && status == 0; i++)
+  {
+    status = plan_model(argv[i], output_dir, time_limit, arena);
+  }
+  free(arena);
+  return status;
+}
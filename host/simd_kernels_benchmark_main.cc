@@ -0,0 +1,285 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/add.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/mul.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/pooling.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/mul.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/pooling.h"
+
+// Micro-benchmark of the int8 kernels of tensorflow/lite/micro/kernels/simd:
+// times the depthwise convolution, max and average pooling, addition and
+// multiplication of tensorflow/lite/kernels/internal/optimized/integer_ops
+// and their reference_integer_ops counterparts on the same inputs:
+//
+//   simd_kernels_benchmark_<instructions> [-r ROUNDS]
+//
+// Built once per instruction set of simd.h, like simd_kernels_test. The
+// pooling has the shape of the models' MAX_POOL_2D. The kernels run in turns
+// of a batch of calls, and the fastest turn of each is kept, the one least
+// disturbed by the rest of the machine.
+namespace {
+  constexpr int kDefaultRounds = 200;
+  constexpr int kBatchCalls = 20;
+  constexpr int kHeight = 26;
+  constexpr int kWidth = 26;
+  constexpr int kPoolDepth = 12;
+  constexpr int kDepthwiseDepth = 32;
+  constexpr int kElements = 4096;
+
+  // The inputs and parameters of every kernel.
+  struct Kernels
+  {
+      tflite::DepthwiseParams depthwise_params;
+      tflite::RuntimeShape depthwise_input_shape;
+      tflite::RuntimeShape depthwise_filter_shape;
+      tflite::RuntimeShape depthwise_bias_shape;
+      tflite::RuntimeShape depthwise_output_shape;
+      std::vector<int8_t> depthwise_input;
+      std::vector<int8_t> depthwise_filter;
+      std::vector<int32_t> depthwise_bias;
+      std::vector<int32_t> depthwise_multiplier;
+      std::vector<int32_t> depthwise_shift;
+      tflite::PoolParams pool_params;
+      tflite::RuntimeShape pool_input_shape;
+      tflite::RuntimeShape pool_output_shape;
+      std::vector<int8_t> pool_input;
+      tflite::ArithmeticParams arithmetic_params;
+      tflite::RuntimeShape arithmetic_shape;
+      std::vector<int8_t> input1;
+      std::vector<int8_t> input2;
+      std::vector<int8_t> output;
+  };
+
+  typedef void (*kernel_call_t)(Kernels* kernels);
+
+  typedef struct
+  {
+      const char* name;
+      kernel_call_t reference;
+      kernel_call_t optimized;
+  } kernel_pair_t;
+
+  void usage(const char* program)
+  {
+    fprintf(stderr, "usage: %s [-r ROUNDS]\n", program);
+  }
+
+  // Name of the instruction set simd.h is compiled for, and whether the CPU
+  // runs it.
+  const char* simd_instructions(bool* supported)
+  {
+#if defined(TFLITE_SIMD_AVX2)
+    *supported = __builtin_cpu_supports("avx2");
+    return "avx2";
+#elif defined(TFLITE_SIMD_SSE4_1)
+    *supported = __builtin_cpu_supports("sse4.1");
+    return "sse4.1";
+#else
+    *supported = true;
+    return "none";
+#endif
+  }
+
+  void fill(std::mt19937& random, std::vector<int8_t>* values, size_t size)
+  {
+    std::uniform_int_distribution<int> int8_values(-127, 127);
+    values->resize(size);
+    for (int8_t& value : *values)
+    {
+      value = static_cast<int8_t>(int8_values(random));
+    }
+  }
+
+  void init_kernels(Kernels* kernels)
+  {
+    std::mt19937 random(1);
+
+    // 3x3, SAME padding, stride 1.
+    kernels->depthwise_params = tflite::DepthwiseParams();
+    kernels->depthwise_params.stride_height = kernels->depthwise_params.stride_width = 1;
+    kernels->depthwise_params.dilation_height_factor = kernels->depthwise_params.dilation_width_factor = 1;
+    kernels->depthwise_params.padding_values.height = kernels->depthwise_params.padding_values.width = 1;
+    kernels->depthwise_params.depth_multiplier = 1;
+    kernels->depthwise_params.input_offset = 128;
+    kernels->depthwise_params.output_offset = -128;
+    kernels->depthwise_params.quantized_activation_min = -128;
+    kernels->depthwise_params.quantized_activation_max = 127;
+    kernels->depthwise_input_shape.BuildFrom({1, kHeight, kWidth, kDepthwiseDepth});
+    kernels->depthwise_filter_shape.BuildFrom({1, 3, 3, kDepthwiseDepth});
+    kernels->depthwise_bias_shape.BuildFrom({kDepthwiseDepth});
+    kernels->depthwise_output_shape.BuildFrom({1, kHeight, kWidth, kDepthwiseDepth});
+    fill(random, &kernels->depthwise_input, kernels->depthwise_input_shape.FlatSize());
+    fill(random, &kernels->depthwise_filter, kernels->depthwise_filter_shape.FlatSize());
+    kernels->depthwise_bias.assign(kDepthwiseDepth, 100);
+    kernels->depthwise_multiplier.assign(kDepthwiseDepth, 1 << 30);
+    kernels->depthwise_shift.assign(kDepthwiseDepth, -8);
+
+    // 2x2, stride 2, VALID padding.
+    kernels->pool_params = tflite::PoolParams();
+    kernels->pool_params.filter_height = kernels->pool_params.filter_width = 2;
+    kernels->pool_params.stride_height = kernels->pool_params.stride_width = 2;
+    kernels->pool_params.quantized_activation_min = -128;
+    kernels->pool_params.quantized_activation_max = 127;
+    kernels->pool_input_shape.BuildFrom({1, kHeight, kWidth, kPoolDepth});
+    kernels->pool_output_shape.BuildFrom({1, kHeight / 2, kWidth / 2, kPoolDepth});
+    fill(random, &kernels->pool_input, kernels->pool_input_shape.FlatSize());
+
+    // Inputs of the same scale, an output of twice their scale.
+    kernels->arithmetic_params = tflite::ArithmeticParams();
+    kernels->arithmetic_params.input1_offset = kernels->arithmetic_params.input2_offset = 3;
+    kernels->arithmetic_params.output_offset = -5;
+    kernels->arithmetic_params.quantized_activation_min = -128;
+    kernels->arithmetic_params.quantized_activation_max = 127;
+    kernels->arithmetic_params.left_shift = 20;
+    kernels->arithmetic_params.input1_multiplier = kernels->arithmetic_params.input2_multiplier = 1 << 30;
+    kernels->arithmetic_params.input1_shift = kernels->arithmetic_params.input2_shift = 0;
+    kernels->arithmetic_params.output_multiplier = 1 << 30;
+    kernels->arithmetic_params.output_shift = -20;
+    kernels->arithmetic_shape.BuildFrom({1, 1, 1, kElements});
+    fill(random, &kernels->input1, kElements);
+    fill(random, &kernels->input2, kElements);
+
+    // The largest output of all.
+    kernels->output.resize(kernels->depthwise_output_shape.FlatSize());
+  }
+
+  void reference_depthwise_conv(Kernels* k)
+  {
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        k->depthwise_params, k->depthwise_multiplier.data(), k->depthwise_shift.data(), k->depthwise_input_shape,
+        k->depthwise_input.data(), k->depthwise_filter_shape, k->depthwise_filter.data(), k->depthwise_bias_shape,
+        k->depthwise_bias.data(), k->depthwise_output_shape, k->output.data());
+  }
+
+  void optimized_depthwise_conv(Kernels* k)
+  {
+    tflite::optimized_integer_ops::DepthwiseConvPerChannel(
+        k->depthwise_params, k->depthwise_multiplier.data(), k->depthwise_shift.data(), k->depthwise_input_shape,
+        k->depthwise_input.data(), k->depthwise_filter_shape, k->depthwise_filter.data(), k->depthwise_bias.data(),
+        k->depthwise_output_shape, k->output.data());
+  }
+
+  void reference_max_pool(Kernels* k)
+  {
+    tflite::reference_integer_ops::MaxPool(k->pool_params, k->pool_input_shape, k->pool_input.data(),
+                                           k->pool_output_shape, k->output.data());
+  }
+
+  void optimized_max_pool(Kernels* k)
+  {
+    tflite::optimized_integer_ops::MaxPool(k->pool_params, k->pool_input_shape, k->pool_input.data(),
+                                           k->pool_output_shape, k->output.data());
+  }
+
+  void reference_average_pool(Kernels* k)
+  {
+    tflite::reference_integer_ops::AveragePool(k->pool_params, k->pool_input_shape, k->pool_input.data(),
+                                               k->pool_output_shape, k->output.data());
+  }
+
+  void optimized_average_pool(Kernels* k)
+  {
+    tflite::optimized_integer_ops::AveragePool(k->pool_params, k->pool_input_shape, k->pool_input.data(),
+                                               k->pool_output_shape, k->output.data());
+  }
+
+  void reference_add(Kernels* k)
+  {
+    tflite::reference_integer_ops::Add(k->arithmetic_params, k->arithmetic_shape, k->input1.data(),
+                                       k->arithmetic_shape, k->input2.data(), k->arithmetic_shape, k->output.data());
+  }
+
+  void optimized_add(Kernels* k)
+  {
+    tflite::optimized_integer_ops::Add(k->arithmetic_params, k->arithmetic_shape, k->input1.data(),
+                                       k->arithmetic_shape, k->input2.data(), k->arithmetic_shape, k->output.data());
+  }
+
+  void reference_mul(Kernels* k)
+  {
+    tflite::reference_integer_ops::Mul(k->arithmetic_params, k->arithmetic_shape, k->input1.data(),
+                                       k->arithmetic_shape, k->input2.data(), k->arithmetic_shape, k->output.data());
+  }
+
+  void optimized_mul(Kernels* k)
+  {
+    tflite::optimized_integer_ops::Mul(k->arithmetic_params, k->arithmetic_shape, k->input1.data(),
+                                       k->arithmetic_shape, k->input2.data(), k->arithmetic_shape, k->output.data());
+  }
+
+  const kernel_pair_t kKernelPairs[] = {
+      {"depthwise_conv 26x26x32 3x3", reference_depthwise_conv, optimized_depthwise_conv},
+      {"max_pool 26x26x12 2x2", reference_max_pool, optimized_max_pool},
+      {"average_pool 26x26x12 2x2", reference_average_pool, optimized_average_pool},
+      {"add 4096", reference_add, optimized_add},
+      {"mul 4096", reference_mul, optimized_mul},
+  };
+
+  // Fastest mean duration of one call over the rounds, in us.
+  double time_calls(kernel_call_t call, Kernels* kernels, int rounds)
+  {
+    double fastest_us = 0.0;
+    for (int round = 0; round < rounds; round++)
+    {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (int i = 0; i < kBatchCalls; i++)
+      {
+        call(kernels);
+      }
+      double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count()
+                  / kBatchCalls;
+      if (round == 0 || us < fastest_us)
+      {
+        fastest_us = us;
+      }
+    }
+    return fastest_us;
+  }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  int rounds = kDefaultRounds;
+  if (argc == 3 && strcmp(argv[1], "-r") == 0)
+  {
+    rounds = atoi(argv[2]);
+  }
+  else if (argc != 1)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+  if (rounds <= 0)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  bool supported;
+  const char* instructions = simd_instructions(&supported);
+  if (!supported)
+  {
+    fprintf(stderr, "The CPU does not run %s\n", instructions);
+    return 1;
+  }
+
+  Kernels kernels;
+  init_kernels(&kernels);
+  printf("%s, %d lanes\n", instructions, tflite::optimized_integer_ops::kSimdLanes);
+  printf("%-28s %12s %12s %8s\n", "kernel", "reference us", "simd us", "speedup");
+  for (const kernel_pair_t& pair : kKernelPairs)
+  {
+    const double reference_us = time_calls(pair.reference, &kernels, rounds);
+    const double optimized_us = time_calls(pair.optimized, &kernels, rounds);
+    printf("%-28s %12.2f %12.2f %7.2fx\n", pair.name, reference_us, optimized_us, reference_us / optimized_us);
+  }
+  return 0;
+}
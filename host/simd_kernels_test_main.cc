@@ -0,0 +1,371 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/add.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/mul.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/pooling.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/mul.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/pooling.h"
+
+// Randomized test of the int8 kernels of tensorflow/lite/micro/kernels/simd
+// and of the fully connected layer: the depthwise convolution, max and
+// average pooling, addition, multiplication and fully connected layer of
+// tensorflow/lite/kernels/internal/optimized/integer_ops must compute the
+// outputs of their reference_integer_ops counterparts bit for bit:
+//
+//   simd_kernels_test_<instructions> [-n CASES] [-s SEED]
+//
+// The build compiles it once per instruction set of simd.h, whatever the one
+// of the library, so that the vectors of every flavor are checked. The
+// cases draw the batches, sizes, depths, filters, strides, dilations,
+// paddings, offsets, activation ranges, and the multipliers and shifts as
+// the kernels compute them from random scales. The fully connected layers
+// have any number of rows, for every tail of the blocks of rows, and depths
+// that leave a tail to the dot products of the vectors. A CPU without the
+// instructions skips the test.
+namespace {
+  constexpr int kDefaultCases = 3000;
+  constexpr unsigned kDefaultSeed = 1;
+  // Exit status of a skipped test, the SKIP_RETURN_CODE of its ctest.
+  constexpr int kSkipped = 77;
+
+  enum
+  {
+      KERNEL_DEPTHWISE_CONV,
+      KERNEL_MAX_POOL,
+      KERNEL_AVERAGE_POOL,
+      KERNEL_ADD,
+      KERNEL_MUL,
+      KERNEL_FULLY_CONNECTED,
+      KERNEL_COUNT
+  };
+
+  const char* const kKernelNames[KERNEL_COUNT] = {"depthwise_conv", "max_pool", "average_pool", "add", "mul",
+                                                  "fully_connected"};
+
+  typedef struct
+  {
+      int cases;
+      int mismatches;
+  } kernel_results_t;
+
+  void usage(const char* program)
+  {
+    fprintf(stderr, "usage: %s [-n CASES] [-s SEED]\n", program);
+  }
+
+  // Name of the instruction set simd.h is compiled for, and whether the CPU
+  // runs it.
+  const char* simd_instructions(bool* supported)
+  {
+#if defined(TFLITE_SIMD_AVX2)
+    *supported = __builtin_cpu_supports("avx2");
+    return "avx2";
+#elif defined(TFLITE_SIMD_SSE4_1)
+    *supported = __builtin_cpu_supports("sse4.1");
+    return "sse4.1";
+#else
+    *supported = true;
+    return "none";
+#endif
+  }
+
+  int uniform(std::mt19937& random, int min, int max)
+  {
+    return std::uniform_int_distribution<int>(min, max)(random);
+  }
+
+  double uniform_real(std::mt19937& random, double min, double max)
+  {
+    return std::uniform_real_distribution<double>(min, max)(random);
+  }
+
+  void fill(std::mt19937& random, std::vector<int8_t>* values)
+  {
+    for (int8_t& value : *values)
+    {
+      value = static_cast<int8_t>(uniform(random, -128, 127));
+    }
+  }
+
+  void record(kernel_results_t* results, bool matched)
+  {
+    results->cases++;
+    if (!matched)
+    {
+      results->mismatches++;
+    }
+  }
+
+  void test_depthwise_conv(std::mt19937& random, kernel_results_t* results)
+  {
+    const int batches = uniform(random, 1, 2);
+    const int height = uniform(random, 1, 10);
+    const int width = uniform(random, 1, 10);
+    // Across several vectors and a partial one, for every flavor.
+    const int depth = uniform(random, 1, 37);
+    const int filter_height = uniform(random, 1, 4);
+    const int filter_width = uniform(random, 1, 4);
+    tflite::DepthwiseParams params = {};
+    params.stride_height = uniform(random, 1, 3);
+    params.stride_width = uniform(random, 1, 3);
+    params.dilation_height_factor = uniform(random, 1, 2);
+    params.dilation_width_factor = uniform(random, 1, 2);
+    params.padding_values.height = static_cast<int16_t>(uniform(random, 0, filter_height - 1));
+    params.padding_values.width = static_cast<int16_t>(uniform(random, 0, filter_width - 1));
+    const int output_height = (height + 2 * params.padding_values.height
+                               - ((filter_height - 1) * params.dilation_height_factor + 1))
+                              / params.stride_height + 1;
+    const int output_width = (width + 2 * params.padding_values.width
+                              - ((filter_width - 1) * params.dilation_width_factor + 1))
+                             / params.stride_width + 1;
+    if (output_height < 1 || output_width < 1)
+    {
+      return;
+    }
+    params.depth_multiplier = 1;
+    params.input_offset = uniform(random, -127, 128);
+    params.output_offset = uniform(random, -128, 127);
+    params.quantized_activation_min = uniform(random, -128, 0);
+    params.quantized_activation_max = uniform(random, 0, 127);
+
+    const tflite::RuntimeShape input_shape({batches, height, width, depth});
+    const tflite::RuntimeShape filter_shape({1, filter_height, filter_width, depth});
+    const tflite::RuntimeShape bias_shape({depth});
+    const tflite::RuntimeShape output_shape({batches, output_height, output_width, depth});
+    std::vector<int8_t> input(input_shape.FlatSize());
+    std::vector<int8_t> filter(filter_shape.FlatSize());
+    fill(random, &input);
+    fill(random, &filter);
+    std::vector<int32_t> bias(depth);
+    std::vector<int32_t> multiplier(depth);
+    std::vector<int32_t> shift(depth);
+    for (int channel = 0; channel < depth; channel++)
+    {
+      // Down to the right shifts of small scales, up to a left shift.
+      const double scale = std::exp2(uniform_real(random, -16.0, 1.0));
+      tflite::QuantizeMultiplier(scale, &multiplier[channel], &shift[channel]);
+      bias[channel] = uniform(random, -100000, 100000);
+    }
+    const int32_t* bias_data = uniform(random, 0, 3) != 0 ? bias.data() : nullptr;
+
+    std::vector<int8_t> expected(output_shape.FlatSize());
+    std::vector<int8_t> output(output_shape.FlatSize());
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(params, multiplier.data(), shift.data(), input_shape,
+                                                           input.data(), filter_shape, filter.data(), bias_shape,
+                                                           bias_data, output_shape, expected.data());
+    tflite::optimized_integer_ops::DepthwiseConvPerChannel(params, multiplier.data(), shift.data(), input_shape,
+                                                           input.data(), filter_shape, filter.data(), bias_data,
+                                                           output_shape, output.data());
+    record(results, output == expected);
+  }
+
+  void test_pooling(std::mt19937& random, kernel_results_t* max_results, kernel_results_t* average_results)
+  {
+    const int batches = uniform(random, 1, 2);
+    const int height = uniform(random, 1, 10);
+    const int width = uniform(random, 1, 10);
+    const int depth = uniform(random, 1, 37);
+    tflite::PoolParams params = {};
+    params.filter_height = uniform(random, 1, 4);
+    params.filter_width = uniform(random, 1, 4);
+    params.stride_height = uniform(random, 1, 3);
+    params.stride_width = uniform(random, 1, 3);
+    params.padding_values.height = static_cast<int16_t>(uniform(random, 0, params.filter_height - 1));
+    params.padding_values.width = static_cast<int16_t>(uniform(random, 0, params.filter_width - 1));
+    const int output_height = (height + 2 * params.padding_values.height - params.filter_height)
+                              / params.stride_height + 1;
+    const int output_width = (width + 2 * params.padding_values.width - params.filter_width)
+                             / params.stride_width + 1;
+    if (output_height < 1 || output_width < 1)
+    {
+      return;
+    }
+    params.quantized_activation_min = uniform(random, -128, 0);
+    params.quantized_activation_max = uniform(random, 0, 127);
+
+    const tflite::RuntimeShape input_shape({batches, height, width, depth});
+    const tflite::RuntimeShape output_shape({batches, output_height, output_width, depth});
+    std::vector<int8_t> input(input_shape.FlatSize());
+    fill(random, &input);
+    std::vector<int8_t> expected(output_shape.FlatSize());
+    std::vector<int8_t> output(output_shape.FlatSize());
+    tflite::reference_integer_ops::MaxPool(params, input_shape, input.data(), output_shape, expected.data());
+    tflite::optimized_integer_ops::MaxPool(params, input_shape, input.data(), output_shape, output.data());
+    record(max_results, output == expected);
+
+    // A window with no pixel inside the input fails both.
+    const bool expected_status = tflite::reference_integer_ops::AveragePool(params, input_shape, input.data(),
+                                                                            output_shape, expected.data());
+    const bool status = tflite::optimized_integer_ops::AveragePool(params, input_shape, input.data(), output_shape,
+                                                                   output.data());
+    record(average_results, status == expected_status && (!status || output == expected));
+  }
+
+  // Addition and multiplication of random scales, quantized as add.cc and
+  // mul.cc do.
+  void test_arithmetic(std::mt19937& random, kernel_results_t* add_results, kernel_results_t* mul_results)
+  {
+    const int size = uniform(random, 1, 300);
+    const tflite::RuntimeShape shape({1, 1, 1, size});
+    std::vector<int8_t> input1(size);
+    std::vector<int8_t> input2(size);
+    fill(random, &input1);
+    fill(random, &input2);
+    const double input1_scale = uniform_real(random, 0.001, 0.1);
+    const double input2_scale = uniform_real(random, 0.001, 0.1);
+    const double output_scale = uniform_real(random, 0.001, 0.2);
+
+    tflite::ArithmeticParams params = {};
+    params.input1_offset = uniform(random, -127, 128);
+    params.input2_offset = uniform(random, -127, 128);
+    params.output_offset = uniform(random, -128, 127);
+    params.quantized_activation_min = uniform(random, -128, 0);
+    params.quantized_activation_max = uniform(random, 0, 127);
+    params.left_shift = 20;
+    const double twice_max_input_scale = 2 * std::max(input1_scale, input2_scale);
+    int shift;
+    tflite::QuantizeMultiplierSmallerThanOneExp(input1_scale / twice_max_input_scale, &params.input1_multiplier,
+                                                &shift);
+    params.input1_shift = shift;
+    tflite::QuantizeMultiplierSmallerThanOneExp(input2_scale / twice_max_input_scale, &params.input2_multiplier,
+                                                &shift);
+    params.input2_shift = shift;
+    tflite::QuantizeMultiplierSmallerThanOneExp(twice_max_input_scale / ((1 << params.left_shift) * output_scale),
+                                                &params.output_multiplier, &shift);
+    params.output_shift = shift;
+
+    std::vector<int8_t> expected(size);
+    std::vector<int8_t> output(size);
+    tflite::reference_integer_ops::Add(params, shape, input1.data(), shape, input2.data(), shape, expected.data());
+    tflite::optimized_integer_ops::Add(params, shape, input1.data(), shape, input2.data(), shape, output.data());
+    record(add_results, output == expected);
+
+    // Products up to a few hundred times the output scale.
+    tflite::QuantizeMultiplier(input1_scale * input2_scale / output_scale * uniform(random, 1, 300),
+                               &params.output_multiplier, &shift);
+    params.output_shift = shift;
+    tflite::reference_integer_ops::Mul(params, shape, input1.data(), shape, input2.data(), shape, expected.data());
+    tflite::optimized_integer_ops::Mul(params, shape, input1.data(), shape, input2.data(), shape, output.data());
+    record(mul_results, output == expected);
+  }
+
+  // Fully connected layer on symmetric weights, the input offset folded
+  // into the bias as fully_connected.cc does.
+  void test_fully_connected(std::mt19937& random, kernel_results_t* results)
+  {
+    const int batches = uniform(random, 1, 3);
+    const int output_depth = uniform(random, 1, 23);
+    const int accum_depth = uniform(random, 1, 300);
+    tflite::FullyConnectedParams params = {};
+    params.input_offset = uniform(random, -127, 128);
+    params.weights_offset = 0;
+    params.output_offset = uniform(random, -128, 127);
+    params.quantized_activation_min = uniform(random, -128, 0);
+    params.quantized_activation_max = uniform(random, 0, 127);
+    // Down to the right shifts of small scales, up to a left shift.
+    int shift;
+    tflite::QuantizeMultiplier(std::exp2(uniform_real(random, -20.0, 1.0)), &params.output_multiplier, &shift);
+    params.output_shift = shift;
+
+    const tflite::RuntimeShape input_shape({batches, accum_depth});
+    const tflite::RuntimeShape filter_shape({output_depth, accum_depth});
+    const tflite::RuntimeShape bias_shape({output_depth});
+    const tflite::RuntimeShape output_shape({batches, output_depth});
+    std::vector<int8_t> input(input_shape.FlatSize());
+    std::vector<int8_t> filter(filter_shape.FlatSize());
+    fill(random, &input);
+    for (int8_t& value : filter)
+    {
+      value = static_cast<int8_t>(uniform(random, -127, 127));
+    }
+    std::vector<int32_t> bias(output_depth);
+    std::vector<int32_t> folded_bias(output_depth);
+    for (int32_t& value : bias)
+    {
+      value = uniform(random, -100000, 100000);
+    }
+    const int32_t* bias_data = uniform(random, 0, 3) != 0 ? bias.data() : nullptr;
+
+    std::vector<int8_t> expected(output_shape.FlatSize());
+    std::vector<int8_t> output(output_shape.FlatSize());
+    tflite::reference_integer_ops::FullyConnected(params, input_shape, input.data(), filter_shape, filter.data(),
+                                                  bias_shape, bias_data, output_shape, expected.data());
+    tflite::optimized_integer_ops::FoldFullyConnectedInputOffset(params.input_offset, filter_shape, filter.data(),
+                                                                 bias_data, folded_bias.data());
+    tflite::optimized_integer_ops::FullyConnected(params, input_shape, input.data(), filter_shape, filter.data(),
+                                                  folded_bias.data(), output_shape, output.data());
+    record(results, output == expected);
+  }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  int cases = kDefaultCases;
+  unsigned seed = kDefaultSeed;
+  for (int i = 1; i < argc; i += 2)
+  {
+    if (i + 1 >= argc)
+    {
+      usage(argv[0]);
+      return 1;
+    }
+    if (strcmp(argv[i], "-n") == 0)
+    {
+      cases = atoi(argv[i + 1]);
+    }
+    else if (strcmp(argv[i], "-s") == 0)
+    {
+      seed = static_cast<unsigned>(strtoul(argv[i + 1], nullptr, 0));
+    }
+    else
+    {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (cases <= 0)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  bool supported;
+  const char* instructions = simd_instructions(&supported);
+  if (!supported)
+  {
+    printf("The CPU does not run %s, skipped\n", instructions);
+    return kSkipped;
+  }
+
+  std::mt19937 random(seed);
+  kernel_results_t results[KERNEL_COUNT] = {};
+  for (int i = 0; i < cases; i++)
+  {
+    test_depthwise_conv(random, &results[KERNEL_DEPTHWISE_CONV]);
+    test_pooling(random, &results[KERNEL_MAX_POOL], &results[KERNEL_AVERAGE_POOL]);
+    test_arithmetic(random, &results[KERNEL_ADD], &results[KERNEL_MUL]);
+    test_fully_connected(random, &results[KERNEL_FULLY_CONNECTED]);
+  }
+
+  int mismatches = 0;
+  printf("%s, %d lanes\n", instructions, tflite::optimized_integer_ops::kSimdLanes);
+  for (int kernel = 0; kernel < KERNEL_COUNT; kernel++)
+  {
+    printf("%-16s %5d cases, %d mismatches\n", kKernelNames[kernel], results[kernel].cases,
+           results[kernel].mismatches);
+    mismatches += results[kernel].mismatches;
+  }
+  return mismatches == 0 ? 0 : 1;
+}
@@ -1,18 +1,40 @@
 #ifndef _APP_HTTP_CLIENT_H_
 #define _APP_HTTP_CLIENT_H_
 
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
 
+#include "model_settings.h"
+
 static EventGroupHandle_t server_event_group;
 
 #define SERVER_CONNECTED_BIT     BIT0
 #define SERVER_DISCONNECTED_BIT  BIT1
 
+// Longest time a queued result waits for the next ones before it is
+// uploaded. With no new result, httpClient_flushResults() has to be called
+// after that time.
+#define RESULTS_FLUSH_PERIOD_MS  2000
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void httpClient_getImage(uint8_t*);
+// Downloads one image, decoding it into image as the response arrives.
+// image must hold kMaxImageSize bytes. Waits for the server to come back if
+// it cannot be reached.
+esp_err_t httpClient_getImage(uint32_t image_id, uint8_t* image);
+// Downloads images start_id .. start_id + count - 1 in a single request, the
+// i-th image is written to frames[i], which must hold kMaxImageSize bytes.
+esp_err_t httpClient_getImages(uint32_t start_id, uint32_t count, uint8_t** frames);
+// Queues a prediction, results are uploaded to /results in batches over the
+// same connection as the image downloads.
+esp_err_t httpClient_postResult(uint32_t image_id, const inference_result_t* result);
+// Uploads the queued predictions right away.
+esp_err_t httpClient_flushResults(void);
+// Uploads the queued predictions and asks the server to write them to disk.
+esp_err_t httpClient_exportResults(void);
 void app_httpClient_main(void);
 
 #ifdef __cplusplus
@@ -0,0 +1,49 @@
+#ifndef _APP_PIPELINE_H_
+#define _APP_PIPELINE_H_
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#include "frame_pool.h"
+
+// Can be lowered at build time for shorter benchmark runs.
+#ifndef PIPELINE_IMAGE_COUNT
+#ifdef CONFIG_BENCHMARK_MODE
+#define PIPELINE_IMAGE_COUNT    CONFIG_BENCHMARK_IMAGE_COUNT
+#else
+#define PIPELINE_IMAGE_COUNT    kTestImageCount
+#endif
+#endif
+
+// Maximum number of images downloaded per HTTP request. Half the frame
+// pool, so one batch can be downloaded while the previous one is processed.
+#define PIPELINE_FETCH_BATCH    (FRAME_POOL_SIZE / 2)
+
+// Network stages share the core running the WiFi stack, the compute stages
+// get the other one to themselves.
+#define PIPELINE_NETWORK_CORE   0
+#define PIPELINE_COMPUTE_CORE   1
+// The invoke stage runs one task per interpreter, the first one on the
+// compute core and the next ones on the other cores in turn.
+#define PIPELINE_CORE_COUNT     portNUM_PROCESSORS
+
+// Log the per-stage occupancy every this many reported images.
+#define PIPELINE_STATS_PERIOD   100
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Starts the fetch -> preprocess -> invoke -> report tasks. The interpreter
+// must have been initialized with app_tflite_init() beforehand.
+esp_err_t app_pipeline_start(void);
+// Blocks until every image has been reported and the results exported.
+void app_pipeline_wait(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _APP_PIPELINE_H_
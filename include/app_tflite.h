@@ -16,8 +16,29 @@ limitations under the License.
 #ifndef _APP_TFLITE_H_
 #define _APP_TFLITE_H_
 
+#include <stddef.h>
+
 #include "esp_log.h"
 
+#include "model_settings.h"
+#include "model_registry.h"
+
+// Interpreters the app can run side by side over the same model, each with
+// its own slice of the tensor arena. On the ESP32, one per core.
+#ifdef CONFIG_TF_INSTANCE_COUNT
+#define TF_MAX_INSTANCES    CONFIG_TF_INSTANCE_COUNT
+#else
+#define TF_MAX_INSTANCES    1
+#endif
+
+// Images each interpreter can run per invoke, stacked along the batch
+// dimension of the model, so that the weights are read once per batch.
+#ifdef CONFIG_TF_BATCH_SIZE
+#define TF_MAX_BATCH        CONFIG_TF_BATCH_SIZE
+#else
+#define TF_MAX_BATCH        1
+#endif
+
 extern esp_err_t TF_init_status;
 extern TaskHandle_t tf_xHandle;
 
@@ -25,9 +46,37 @@ extern TaskHandle_t tf_xHandle;
 extern "C" {
 #endif
 
+// Runs the model selected in menuconfig, on TF_MAX_INSTANCES interpreters
+// of TF_MAX_BATCH images per invoke.
 esp_err_t app_tflite_init(void);
+// Runs the given model instead, on instance_count interpreters, from 1 to
+// TF_MAX_INSTANCES, each taking batches of batch_size images, from 1 to
+// TF_MAX_BATCH. Only one model can be initialized.
+esp_err_t app_tflite_init_model(const model_entry_t* model, int instance_count, int batch_size);
 void tf_start_inference(void);
+// Number of interpreters running the model, once initialized.
+int tf_instance_count(void);
+// Most images per invoke of each interpreter, once initialized.
+int tf_batch_size(void);
+// Runs the model with one of the interpreters on count images, up to the
+// batch size, already converted by PreprocessImage() and reports the kTopK
+// most probable categories of each. The invoke time of a result is its share
+// of the batch. An interpreter must only be used by one task at a time,
+// different ones can run concurrently.
+esp_err_t tf_invoke(int instance, const void* const* images, int count, inference_result_t* const* results);
 void tf_stop_inference(void);
+// The model being run, NULL until initialized.
+const model_entry_t* tf_model(void);
+// Bytes of the tensor arena actually used by each interpreter, once
+// initialized.
+size_t tf_arena_used_bytes(void);
+// Bytes of weights and biases each interpreter reads from its copy in RAM,
+// and from the model itself, once initialized.
+size_t tf_ram_weights_bytes(void);
+size_t tf_model_weights_bytes(void);
+// Prints the per-operator timings as a JSON line starting with
+// {"profile":"ops", when the operator profiler is enabled in menuconfig.
+void tf_print_profile_json(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,54 @@
+#ifndef _ARENA_TUNER_H_
+#define _ARENA_TUNER_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/micro/recording_micro_allocator.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// Alignment of the arena start the sizes are measured for. No TFLM
+// allocation needs more, and with it the layout of the arena only depends on
+// its size.
+#define ARENA_TUNER_ALIGNMENT   16
+
+// Where the minimal arena of a model goes.
+typedef struct
+{
+    // Smallest arena AllocateTensors() and Invoke() succeed with.
+    size_t minimal_size;
+    // The breakdown is left at 0 when the arena could not also hold the
+    // recording allocator it is measured with.
+    // Head of the arena: the planned tensor data, shared by the tensors
+    // whose lifetimes do not overlap, and the kernels' scratch buffers.
+    size_t tensor_data_bytes;
+    // Tail of the arena, by RecordedAllocationType.
+    tflite::RecordedAllocation eval_tensors;
+    tflite::RecordedAllocation persistent_tensors;
+    tflite::RecordedAllocation quantization_data;
+    tflite::RecordedAllocation persistent_buffers;
+    tflite::RecordedAllocation variable_buffers;
+    tflite::RecordedAllocation node_and_registrations;
+    // The rest: the allocator itself and the alignment padding.
+    size_t other_bytes;
+    // Arena added by each image of a batch after the first, such that
+    // minimal_size + (batch - 1) * batch_image_bytes holds any batch up to
+    // the tuned one. Mostly the activations, which grow with the batch.
+    size_t batch_image_bytes;
+} arena_tuning_t;
+
+// Binary searches the smallest arena the model can run in, using arena
+// (aligned on ARENA_TUNER_ALIGNMENT) as scratch space, then the one of each
+// batch from 2 to max_batch_size images per invoke. Fails if the model does
+// not even fit in arena_size bytes.
+TfLiteStatus TuneArena(const tflite::Model* model, const tflite::MicroOpResolver& op_resolver,
+                       int max_batch_size, uint8_t* arena, size_t arena_size, arena_tuning_t* tuning);
+
+// Writes the C definitions of one model's tuning, MODEL_<NAME>_ARENA_SIZE
+// then its breakdown and MODEL_<NAME>_ARENA_BATCH_IMAGE, as included from
+// the generated model_arena.h.
+void PrintArenaTuning(FILE* file, const char* name, const char* source,
+                      const arena_tuning_t* tuning);
+
+#endif // _ARENA_TUNER_H_
@@ -0,0 +1,54 @@
+#ifndef _FRAME_POOL_H_
+#define _FRAME_POOL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "model_settings.h"
+
+// Number of frames in the pool, must be a power of two.
+#define FRAME_POOL_SIZE         8
+
+// Frames are aligned so that the pixel data can be read with word accesses.
+#define FRAME_ALIGNMENT         16
+
+typedef struct
+{
+    // The image is converted in place, so the raw pixels and the model input
+    // share the same storage. Which of quantized or normalised holds the
+    // input depends on the model's input type.
+    union
+    {
+        uint8_t pixels[kMaxImageSize];
+        int8_t quantized[kMaxImageSize];
+        float normalised[kMaxImageSize];
+    } data __attribute__((aligned(FRAME_ALIGNMENT)));
+    uint32_t image_id;
+    inference_result_t result;
+} frame_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Puts every frame back in the pool. Must be called before any lease, while
+// no other task uses the pool.
+void frame_pool_init(void);
+
+// Leases a free frame, or returns NULL if they are all in use. Only one task
+// may acquire frames from the pool.
+frame_t* frame_pool_acquire(void);
+
+// Returns a leased frame to the pool. Only one task may release frames to
+// the pool, it may be a different one than the acquiring task. Returns false
+// if the frame is not from the pool or is not leased, released twice.
+bool frame_pool_release(frame_t* frame);
+
+// Number of frames currently free.
+uint32_t frame_pool_available(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _FRAME_POOL_H_
@@ -18,6 +18,13 @@ limitations under the License.
 
 #include "esp_log.h"
 
+// Element type of the model's input tensor.
+typedef enum
+{
+  IMAGE_INPUT_INT8,
+  IMAGE_INPUT_FLOAT32,
+} image_input_type_t;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -37,7 +44,23 @@ extern "C"
 // The reference implementation can have no platform-specific dependencies, so
 // it just returns a static image. For real applications, you should
 // ensure there's a specialized implementation that accesses hardware APIs.
-esp_err_t GetImage(uint8_t image_width, uint8_t image_height, uint8_t channels, float* image_data);
+//
+// Here the images are downloaded from the images server: image_id selects
+// the test image, which is converted into image_data as soon as its last
+// pixel has been received.
+esp_err_t GetImage(uint32_t image_id, uint8_t image_width, uint8_t image_height, uint8_t channels, void* image_data);
+
+// Selects the conversion GetImage uses to write pixels directly into the
+// model's input tensor: normalised floats, or normalised values quantized
+// with the input tensor's scale and zero point, precomputed into a table.
+// Must be called once before the first call to GetImage().
+void InitImagePreprocessing(image_input_type_t input_type, float scale, int32_t zero_point);
+
+// Converts a raw kNumCols x kNumRows x kNumChannels 8-bit image that has
+// already been fetched into the model's input type. image and image_data may
+// point to the same buffer, as long as it is large enough for the converted
+// image.
+esp_err_t PreprocessImage(const uint8_t* image, void* image_data);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,42 @@
+#ifndef _LATENCY_STATS_H_
+#define _LATENCY_STATS_H_
+
+#include <stdint.h>
+
+// Log-linear latency histogram: values below 16 us are counted exactly, each
+// power of two above is split into 16 buckets, so percentiles are within
+// about 6% of the recorded values. Values above 2^26 us (67 s) land in the
+// last bucket.
+#define LATENCY_STATS_SUB_BUCKET_BITS   4
+#define LATENCY_STATS_SUB_BUCKETS       (1 << LATENCY_STATS_SUB_BUCKET_BITS)
+#define LATENCY_STATS_MAX_BITS          26
+#define LATENCY_STATS_BUCKETS           ((LATENCY_STATS_MAX_BITS - LATENCY_STATS_SUB_BUCKET_BITS + 1) * LATENCY_STATS_SUB_BUCKETS)
+
+typedef struct
+{
+    uint32_t buckets[LATENCY_STATS_BUCKETS];
+    uint32_t count;
+    uint32_t max_us;
+    uint64_t total_us;
+} latency_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void latency_stats_reset(latency_stats_t* stats);
+// Records count samples of value_us each. Not thread-safe, every histogram
+// must only be written by one task.
+void latency_stats_record(latency_stats_t* stats, uint32_t value_us, uint32_t count);
+// Returns the latency under which percentile (0 to 100) of the samples are,
+// or 0 if nothing has been recorded.
+uint32_t latency_stats_percentile(const latency_stats_t* stats, float percentile);
+uint32_t latency_stats_mean(const latency_stats_t* stats);
+// Adds the samples of stats to into, once both are no longer written.
+void latency_stats_merge(latency_stats_t* into, const latency_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _LATENCY_STATS_H_
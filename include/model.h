@@ -1,15 +1,25 @@
 #ifndef _MODEL_H_
 #define _MODEL_H_
 
-extern const unsigned char g_model[];
-extern const unsigned int g_model_len;
-
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Post-training quantized model, int8 input and output.
+extern const unsigned char g_model[];
+extern const unsigned int g_model_len;
+
+// Float model, without quantization.
+extern const unsigned char g_model_no_quant[];
+extern const unsigned int g_model_no_quant_len;
+
+// Quantization-aware trained model. Its input and output are float, the
+// activations are fake-quantized to uint8 in between the layers.
+extern const unsigned char g_model_q_aware[];
+extern const unsigned int g_model_q_aware_len;
+
 #ifdef __cplusplus
 }
 #endif
 
-#endif  // _MODEL_H_
\ No newline at end of file
+#endif  // _MODEL_H_
@@ -0,0 +1,55 @@
+// Generated by host/arena_tuner, do not edit. Minimal tensor arena of each
+// model, to be regenerated whenever a model or the TFLM kernels change:
+//   arena_tuner -o include/model_arena.h quant=TF_models/model_quant.tflite no_quant=TF_models/model_no_quant.tflite q_aware=TF_models/model_q_aware.tflite
+#ifndef _MODEL_ARENA_H_
+#define _MODEL_ARENA_H_
+
+// The arena must start on this boundary for the sizes to hold.
+#define MODEL_ARENA_ALIGNMENT 16
+
+// Largest batch of images per invoke the sizes hold for.
+#define MODEL_ARENA_MAX_BATCH 4
+
+// Persistent structs hold pointers, the sizes only apply to the pointer
+// size they were measured with.
+#if __SIZEOF_POINTER__ == 8
+
+// TF_models/model_quant.tflite
+#define MODEL_QUANT_ARENA_SIZE 5832
+#define MODEL_QUANT_ARENA_TENSOR_DATA 4064 // tensor data and scratch buffers, at the head
+#define MODEL_QUANT_ARENA_EVAL_TENSORS 264 // TfLiteEvalTensor structs, 11 allocations
+#define MODEL_QUANT_ARENA_PERSISTENT_TENSORS 128 // persistent TfLiteTensor structs, 2 allocations
+#define MODEL_QUANT_ARENA_QUANTIZATION_DATA 64 // their quantization parameters, 4 allocations
+#define MODEL_QUANT_ARENA_PERSISTENT_BUFFERS 692 // kernels' persistent buffers, 11 allocations
+#define MODEL_QUANT_ARENA_VARIABLE_BUFFERS 0 // variable tensors, 0 allocations
+#define MODEL_QUANT_ARENA_NODE_AND_REGISTRATIONS 280 // NodeAndRegistration structs, 5 allocations
+#define MODEL_QUANT_ARENA_OTHER 340 // allocator and alignment padding
+#define MODEL_QUANT_ARENA_BATCH_IMAGE 4160 // more per image of a batch, after the first
+
+// TF_models/model_no_quant.tflite
+#define MODEL_NO_QUANT_ARENA_SIZE 17832
+#define MODEL_NO_QUANT_ARENA_TENSOR_DATA 16224 // tensor data and scratch buffers, at the head
+#define MODEL_NO_QUANT_ARENA_EVAL_TENSORS 264 // TfLiteEvalTensor structs, 11 allocations
+#define MODEL_NO_QUANT_ARENA_PERSISTENT_TENSORS 128 // persistent TfLiteTensor structs, 2 allocations
+#define MODEL_NO_QUANT_ARENA_QUANTIZATION_DATA 0 // their quantization parameters, 0 allocations
+#define MODEL_NO_QUANT_ARENA_PERSISTENT_BUFFERS 596 // kernels' persistent buffers, 9 allocations
+#define MODEL_NO_QUANT_ARENA_VARIABLE_BUFFERS 0 // variable tensors, 0 allocations
+#define MODEL_NO_QUANT_ARENA_NODE_AND_REGISTRATIONS 280 // NodeAndRegistration structs, 5 allocations
+#define MODEL_NO_QUANT_ARENA_OTHER 340 // allocator and alignment padding
+#define MODEL_NO_QUANT_ARENA_BATCH_IMAGE 16320 // more per image of a batch, after the first
+
+// TF_models/model_q_aware.tflite
+#define MODEL_Q_AWARE_ARENA_SIZE 112328
+#define MODEL_Q_AWARE_ARENA_TENSOR_DATA 109520 // tensor data and scratch buffers, at the head
+#define MODEL_Q_AWARE_ARENA_EVAL_TENSORS 528 // TfLiteEvalTensor structs, 22 allocations
+#define MODEL_Q_AWARE_ARENA_PERSISTENT_TENSORS 128 // persistent TfLiteTensor structs, 2 allocations
+#define MODEL_Q_AWARE_ARENA_QUANTIZATION_DATA 0 // their quantization parameters, 0 allocations
+#define MODEL_Q_AWARE_ARENA_PERSISTENT_BUFFERS 748 // kernels' persistent buffers, 19 allocations
+#define MODEL_Q_AWARE_ARENA_VARIABLE_BUFFERS 0 // variable tensors, 0 allocations
+#define MODEL_Q_AWARE_ARENA_NODE_AND_REGISTRATIONS 896 // NodeAndRegistration structs, 16 allocations
+#define MODEL_Q_AWARE_ARENA_OTHER 508 // allocator and alignment padding
+#define MODEL_Q_AWARE_ARENA_BATCH_IMAGE 17656 // more per image of a batch, after the first
+
+#endif // __SIZEOF_POINTER__
+
+#endif // _MODEL_ARENA_H_
@@ -0,0 +1,88 @@
+#ifndef _MODEL_OP_RESOLVER_H_
+#define _MODEL_OP_RESOLVER_H_
+
+#include <string.h>
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include "model_ops.h"
+
+// Resolves exactly the operators of the linked models, as listed by the
+// generated model_ops.h, so that the kernels of no other operator are linked.
+// Unlike MicroMutableOpResolver, which searches the operators it was given
+// one by one, each lookup is a switch on the operator, a jump table, and the
+// list cannot get out of sync with the models.
+class ModelOpResolver : public tflite::MicroOpResolver {
+ public:
+  ModelOpResolver()
+  {
+#define MODEL_OP_RESOLVER_REGISTER(op, registration, parser) \
+    registrations_[k##op] = registration; \
+    registrations_[k##op].builtin_code = tflite::BuiltinOperator_##op;
+    MODEL_OPS(MODEL_OP_RESOLVER_REGISTER)
+#undef MODEL_OP_RESOLVER_REGISTER
+#define MODEL_OP_RESOLVER_REGISTER_FUSED(op, registration) \
+    registrations_[k##op] = registration; \
+    registrations_[k##op].builtin_code = tflite::BuiltinOperator_CUSTOM; \
+    registrations_[k##op].custom_name = #op;
+    MODEL_FUSED_OPS(MODEL_OP_RESOLVER_REGISTER_FUSED)
+#undef MODEL_OP_RESOLVER_REGISTER_FUSED
+  }
+
+  const TfLiteRegistration* FindOp(tflite::BuiltinOperator op) const override
+  {
+    switch (op)
+    {
+#define MODEL_OP_RESOLVER_FIND(op, registration, parser) \
+      case tflite::BuiltinOperator_##op: return &registrations_[k##op];
+      MODEL_OPS(MODEL_OP_RESOLVER_FIND)
+#undef MODEL_OP_RESOLVER_FIND
+      default: return nullptr;
+    }
+  }
+
+  // The models have no custom operators, only the fused kernels the
+  // interpreter looks up by name, when the linked models have any.
+  const TfLiteRegistration* FindOp(const char* op) const override
+  {
+    (void) op;
+#define MODEL_OP_RESOLVER_FIND_FUSED(fused_op, registration) \
+    if (strcmp(op, #fused_op) == 0) return &registrations_[k##fused_op];
+    MODEL_FUSED_OPS(MODEL_OP_RESOLVER_FIND_FUSED)
+#undef MODEL_OP_RESOLVER_FIND_FUSED
+    return nullptr;
+  }
+
+  BuiltinParseFunction GetOpDataParser(tflite::BuiltinOperator op) const override
+  {
+    switch (op)
+    {
+#define MODEL_OP_RESOLVER_PARSER(op, registration, parser) \
+      case tflite::BuiltinOperator_##op: return parser;
+      MODEL_OPS(MODEL_OP_RESOLVER_PARSER)
+#undef MODEL_OP_RESOLVER_PARSER
+      default: return nullptr;
+    }
+  }
+
+ private:
+  // Index of each operator in registrations_.
+  enum
+  {
+#define MODEL_OP_RESOLVER_INDEX(op, registration, parser) k##op,
+    MODEL_OPS(MODEL_OP_RESOLVER_INDEX)
+#undef MODEL_OP_RESOLVER_INDEX
+#define MODEL_OP_RESOLVER_INDEX_FUSED(op, registration) k##op,
+    MODEL_FUSED_OPS(MODEL_OP_RESOLVER_INDEX_FUSED)
+#undef MODEL_OP_RESOLVER_INDEX_FUSED
+    kOpCount
+  };
+
+  TfLiteRegistration registrations_[kOpCount];
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+#endif // _MODEL_OP_RESOLVER_H_
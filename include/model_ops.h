@@ -0,0 +1,56 @@
+// Generated by host/gen_op_resolver.py, do not edit. Operators of each
+// model, to be regenerated whenever a model changes:
+//   gen_op_resolver.py -o include/model_ops.h quant=TF_models/model_quant.tflite no_quant=TF_models/model_no_quant.tflite q_aware=TF_models/model_q_aware.tflite
+#ifndef _MODEL_OPS_H_
+#define _MODEL_OPS_H_
+
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+
+#include "model_registry.h"
+
+// Highest version of each operator, the TFLM kernels run every version:
+//   CONV_2D                  v5  quant no_quant q_aware
+//   DEQUANTIZE               v1  q_aware
+//   FULLY_CONNECTED          v9  quant no_quant q_aware
+//   MAX_POOL_2D              v2  quant no_quant q_aware
+//   QUANTIZE                 v1  q_aware
+//   RESHAPE                  v1  quant no_quant q_aware
+//   SOFTMAX                  v2  quant no_quant q_aware
+
+#if defined(MODEL_REGISTRY_HAS_QUANT) || defined(MODEL_REGISTRY_HAS_NO_QUANT) || defined(MODEL_REGISTRY_HAS_Q_AWARE)
+#define MODEL_OPS_0(OP) \
+    OP(CONV_2D, tflite::Register_CONV_2D(), tflite::ParseConv2D) \
+    OP(FULLY_CONNECTED, tflite::Register_FULLY_CONNECTED(), tflite::ParseFullyConnected) \
+    OP(MAX_POOL_2D, tflite::ops::micro::Register_MAX_POOL_2D(), tflite::ParsePool) \
+    OP(RESHAPE, tflite::ops::micro::Register_RESHAPE(), tflite::ParseReshape) \
+    OP(SOFTMAX, tflite::Register_SOFTMAX(), tflite::ParseSoftmax)
+#else
+#define MODEL_OPS_0(OP)
+#endif
+
+#if defined(MODEL_REGISTRY_HAS_Q_AWARE)
+#define MODEL_OPS_1(OP) \
+    OP(DEQUANTIZE, tflite::ops::micro::Register_DEQUANTIZE(), tflite::ParseDequantize) \
+    OP(QUANTIZE, tflite::Register_QUANTIZE(), tflite::ParseQuantize)
+#else
+#define MODEL_OPS_1(OP)
+#endif
+
+// OP(operator, registration, parser) of every operator of the linked models.
+#define MODEL_OPS(OP) MODEL_OPS_0(OP) MODEL_OPS_1(OP)
+
+// Fused kernels of chains of these operators, see MicroGraph::FuseSubgraphs():
+//   CONV_2D_MAX_POOL_2D      CONV_2D MAX_POOL_2D  quant no_quant
+
+#if defined(MODEL_REGISTRY_HAS_QUANT) || defined(MODEL_REGISTRY_HAS_NO_QUANT)
+#define MODEL_FUSED_OPS_0(OP) \
+    OP(CONV_2D_MAX_POOL_2D, tflite::Register_CONV_2D_MAX_POOL_2D())
+#else
+#define MODEL_FUSED_OPS_0(OP)
+#endif
+
+// OP(operator, registration) of every fused kernel of the linked models.
+#define MODEL_FUSED_OPS(OP) MODEL_FUSED_OPS_0(OP)
+
+#endif // _MODEL_OPS_H_
@@ -0,0 +1,101 @@
+#ifndef _MODEL_REGISTRY_H_
+#define _MODEL_REGISTRY_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sdkconfig.h"
+
+#include "model_arena.h"
+
+// Tensor arena needed by each model, generated by the arena tuner for the
+// pointer size it ran with. Otherwise, fall back to the sizes measured on a
+// 64-bit host, rounded up to the next KB: they are upper bounds for 32-bit
+// targets, whose persistent structs are smaller. The q_aware model also
+// holds its dense weights twice, fake-quantized to uint8 then dequantized.
+#ifndef MODEL_ARENA_ALIGNMENT
+#define MODEL_ARENA_ALIGNMENT       16
+#endif
+#ifndef MODEL_ARENA_MAX_BATCH
+#define MODEL_ARENA_MAX_BATCH       4
+#endif
+#ifndef MODEL_QUANT_ARENA_SIZE
+#define MODEL_QUANT_ARENA_SIZE      (6 * 1024)
+#define MODEL_QUANT_ARENA_BATCH_IMAGE       (5 * 1024)
+#endif
+#ifndef MODEL_NO_QUANT_ARENA_SIZE
+#define MODEL_NO_QUANT_ARENA_SIZE   (18 * 1024)
+#define MODEL_NO_QUANT_ARENA_BATCH_IMAGE    (16 * 1024)
+#endif
+#ifndef MODEL_Q_AWARE_ARENA_SIZE
+#define MODEL_Q_AWARE_ARENA_SIZE    (110 * 1024)
+#define MODEL_Q_AWARE_ARENA_BATCH_IMAGE     (18 * 1024)
+#endif
+
+// Arena of a model running batch images per invoke, up to
+// MODEL_ARENA_MAX_BATCH.
+#define MODEL_BATCH_ARENA_SIZE(prefix, batch) \
+    (prefix##_ARENA_SIZE + ((batch) - 1) * prefix##_ARENA_BATCH_IMAGE)
+
+// Only the model selected in menuconfig is linked, unless all of them are
+// requested to compare them at run-time. The quantized model is the default.
+#if defined(CONFIG_MODEL_ALL) || defined(CONFIG_MODEL_NO_QUANT)
+#define MODEL_REGISTRY_HAS_NO_QUANT 1
+#endif
+#if defined(CONFIG_MODEL_ALL) || defined(CONFIG_MODEL_Q_AWARE)
+#define MODEL_REGISTRY_HAS_Q_AWARE  1
+#endif
+#if defined(CONFIG_MODEL_ALL) || !(defined(CONFIG_MODEL_NO_QUANT) || defined(CONFIG_MODEL_Q_AWARE))
+#define MODEL_REGISTRY_HAS_QUANT    1
+#endif
+
+// Size of the tensor arena shared by the linked models, for a batch of
+// images per invoke. Which model needs the most depends on the batch, the
+// activations of the float models grow faster.
+#ifdef MODEL_REGISTRY_HAS_QUANT
+#define MODEL_REGISTRY_QUANT_ARENA_SIZE(batch)      MODEL_BATCH_ARENA_SIZE(MODEL_QUANT, batch)
+#else
+#define MODEL_REGISTRY_QUANT_ARENA_SIZE(batch)      0
+#endif
+#ifdef MODEL_REGISTRY_HAS_NO_QUANT
+#define MODEL_REGISTRY_NO_QUANT_ARENA_SIZE(batch)   MODEL_BATCH_ARENA_SIZE(MODEL_NO_QUANT, batch)
+#else
+#define MODEL_REGISTRY_NO_QUANT_ARENA_SIZE(batch)   0
+#endif
+#ifdef MODEL_REGISTRY_HAS_Q_AWARE
+#define MODEL_REGISTRY_Q_AWARE_ARENA_SIZE(batch)    MODEL_BATCH_ARENA_SIZE(MODEL_Q_AWARE, batch)
+#else
+#define MODEL_REGISTRY_Q_AWARE_ARENA_SIZE(batch)    0
+#endif
+#define MODEL_REGISTRY_MAX(a, b)    ((a) > (b) ? (a) : (b))
+#define MODEL_REGISTRY_BATCH_ARENA_SIZE(batch) \
+    MODEL_REGISTRY_MAX(MODEL_REGISTRY_MAX(MODEL_REGISTRY_QUANT_ARENA_SIZE(batch), \
+                                          MODEL_REGISTRY_NO_QUANT_ARENA_SIZE(batch)), \
+                       MODEL_REGISTRY_Q_AWARE_ARENA_SIZE(batch))
+#define MODEL_REGISTRY_ARENA_SIZE   MODEL_REGISTRY_BATCH_ARENA_SIZE(1)
+
+typedef struct
+{
+    const char* name;
+    const unsigned char* data;
+    // Flatbuffer size, which is what the model costs in flash.
+    unsigned int size;
+    size_t arena_size;
+} model_entry_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+size_t model_registry_count(void);
+const model_entry_t* model_registry_get(size_t index);
+// Returns NULL if no linked model has this name.
+const model_entry_t* model_registry_find(const char* name);
+// The model selected in menuconfig.
+const model_entry_t* model_registry_default(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _MODEL_REGISTRY_H_
@@ -16,6 +16,8 @@ limitations under the License.
 #ifndef _MODEL_SETTINGS_H_
 #define _MODEL_SETTINGS_H_
 
+#include <stdint.h>
+
 // Keeping these as constant expressions allow us to allocate fixed-sized arrays
 // on the stack for our working memory.
 
@@ -26,12 +28,26 @@ limitations under the License.
 #define kNumRows        28
 #define kNumChannels    1
 
-#define kMaxImageSize   kNumCols * kNumRows * kNumChannels
+#define kMaxImageSize   (kNumCols * kNumRows * kNumChannels)
 
 #define kCategoryCount  10
 
+// Number of images in the Kaggle test set served by images_server.py.
+#define kTestImageCount 28000
+
 extern const char* kCategoryLabels[kCategoryCount];
 
+// Number of most probable categories reported for each image.
+#define kTopK           3
+
+typedef struct
+{
+  // Most probable category first, labels[0] is the prediction.
+  uint8_t labels[kTopK];
+  int8_t scores[kTopK];
+  uint32_t invoke_time_us;
+} inference_result_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
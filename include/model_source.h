@@ -0,0 +1,60 @@
+#ifndef _MODEL_SOURCE_H_
+#define _MODEL_SOURCE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#include "model_registry.h"
+
+// Flatbuffers are mapped or loaded at this alignment, the one of the linked
+// model arrays.
+#define MODEL_SOURCE_ALIGNMENT      MODEL_ARENA_ALIGNMENT
+
+typedef enum
+{
+    MODEL_SOURCE_PARTITION,     // Flash data partition, memory-mapped
+    MODEL_SOURCE_FILE,          // File, memory-mapped on the host, read on target
+    MODEL_SOURCE_HTTP,          // HTTP download, streamed into a region
+} model_source_kind_t;
+
+// A model that is not linked in the application: its flatbuffer stays where
+// it is when it can be mapped, otherwise it is loaded into a region of its
+// own. The flatbuffer is verified once, when the source is opened, then the
+// entry is run like a linked model.
+typedef struct
+{
+    model_source_kind_t kind;
+    // Points into the source, arena_size is 0: the model was not tuned.
+    model_entry_t entry;
+    // Name of the entry, from the partition label or the file name.
+    char name[32];
+    // Mapping or region to release on close.
+    void* region;
+    size_t region_size;
+#ifdef ESP_PLATFORM
+    uint32_t mmap_handle;
+#endif
+} model_source_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opens a model from a URI:
+//   partition:LABEL     the data partition LABEL, the flatbuffer at its start
+//   http://HOST[:PORT]/PATH
+//   PATH                any other URI is a file path
+// Flatbuffers that cannot be mapped are loaded into a region of at most
+// max_size bytes. Fails if the flatbuffer is not a valid TFLite model.
+esp_err_t model_source_open(const char* uri, size_t max_size, model_source_t* source);
+
+// Unmaps or frees the model, which must no longer be run.
+void model_source_close(model_source_t* source);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _MODEL_SOURCE_H_
@@ -0,0 +1,62 @@
+#ifndef _OP_PROFILER_H_
+#define _OP_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tensorflow/lite/micro/micro_profiler.h"
+
+// Enough for every node of the linked models, later nodes are not profiled.
+#define OP_PROFILER_MAX_NODES           32
+// Power of two histogram: bucket i counts the durations below 2^i us, and
+// at least 2^(i-1) us. The last bucket also counts everything longer.
+#define OP_PROFILER_HISTOGRAM_BUCKETS   16
+
+typedef struct
+{
+    const char* tag;
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t histogram[OP_PROFILER_HISTOGRAM_BUCKETS];
+} op_profile_t;
+
+// Aggregates the duration of every operator across any number of invokes,
+// per node and, when printed, per operator type. Unlike the MicroProfiler it
+// replaces, nothing is lost after 50 events and durations are kept in 64 bits.
+// The interpreter runs its nodes in order, so the node of an event is its
+// rank within the invoke, among the nodes the interpreter runs: a fused node
+// counts once. Must only be used by the task invoking the interpreter.
+class OpProfiler : public tflite::MicroProfiler {
+ public:
+  OpProfiler() = default;
+
+  // Forgets every duration recorded so far, node_count is the number of
+  // nodes an invoke of the interpreter runs, its invoked_operators_size().
+  void Reset(size_t node_count);
+
+  uint32_t BeginEvent(const char* tag) override;
+  void EndEvent(uint32_t event_handle) override;
+
+  size_t node_count() const { return node_count_; }
+  uint32_t invoke_count() const;
+  const op_profile_t* node(size_t index) const;
+
+  // Prints one JSON line starting with {"profile":"ops", with the statistics
+  // of each operator type then of each node, sorted by their total time.
+  void PrintJson(const char* model_name) const;
+
+ private:
+  op_profile_t nodes_[OP_PROFILER_MAX_NODES];
+  // Nodes an invoke runs, and how many of them are profiled.
+  size_t model_node_count_ = 0;
+  size_t node_count_ = 0;
+  size_t next_node_ = 0;
+  int32_t start_ticks_ = 0;
+  int32_t ticks_per_second_ = 0;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+#endif // _OP_PROFILER_H_
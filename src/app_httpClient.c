@@ -15,10 +15,12 @@
 #include <stdio.h> 
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 
 #include "esp_system.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_http_client.h"
 #include "esp_timer.h"
 #include "esp_log.h"
@@ -26,20 +28,83 @@
 #include "sdkconfig.h"
 
 #include "app_httpClient.h"
+#include "model_settings.h"
 
 static const char *TAG = "App_HTTPClient";
 
+// Overridden by the host build, which talks to a server on localhost.
+#ifndef SERVER_IP
 #define SERVER_IP           "192.168.8.101"
+#endif
+#ifndef SERVER_HTTP_PORT
 #define SERVER_HTTP_PORT    8000
+#endif
 
 #define MAX_HTTP_RECV_BUFFER 512
 #define MAX_HTTP_OUTPUT_BUFFER 2048
 
+// Results are uploaded once this many are pending, or once the oldest
+// pending one has waited RESULTS_FLUSH_PERIOD_MS when the next one comes.
+#define RESULTS_BATCH_SIZE      64
+
+// Binary result record, all fields little-endian:
+//   0  uint32  image ID
+//   4  uint32  invoke time in microseconds
+//   8  uint8   kTopK labels, most probable first
+//   11 int8    kTopK scores, in the same order
+//   14 2 bytes reserved, zero
+// Must match RESULT_RECORD_DTYPE in Images_server/images_server.py.
+#define RESULT_RECORD_SIZE      16
+
 void decode_text_data(char* data_buffer);
 
+typedef enum
+{
+    IMAGE_FORMAT_RAW,   // Bare 8-bit pixels
+    IMAGE_FORMAT_PGM,   // Binary (P5) 8-bit grayscale netpbm image
+} image_format_t;
+
+// Destination of an /image or /images response: the body is decoded and
+// scattered across the caller's frames as it arrives, so that nothing but
+// the pixels is ever buffered.
+typedef struct
+{
+    uint8_t** frames;
+    uint32_t frame_count;
+    uint32_t received_len;
+    image_format_t format;
+    // PGM header parsing state: the magic number, width, height and maximum
+    // value fields come in this order, separated by whitespace or comments.
+    uint8_t header_field;
+    uint32_t header_value;
+    bool in_token;
+    bool in_comment;
+    bool header_done;
+    esp_err_t status;
+} image_batch_t;
+
+// Long-lived HTTP/1.1 session shared by image downloads and result uploads,
+// so that they all go over the same TCP connection.
+static struct
+{
+    esp_http_client_handle_t client;
+    SemaphoreHandle_t lock;
+    // Destination of the GET in progress, NULL while uploading results.
+    image_batch_t* batch;
+    // Encoded records waiting to be sent to /results.
+    char results[RESULTS_BATCH_SIZE * RESULT_RECORD_SIZE];
+    uint32_t results_len;
+    uint32_t results_count;
+    int64_t last_flush_time;
+    uint32_t connection_count;
+} http_session;
+
 esp_err_t _http_event_handle(esp_http_client_event_t *event)
 {
-    static char *output_buffer;  // Buffer to store response of http request from event handler
+    // Buffer to store response of http request from event handler. Only the
+    // connectivity checks and single requests use it, so it is statically
+    // sized instead of being allocated from the content length.
+    static char output_buffer[MAX_HTTP_OUTPUT_BUFFER + 1];
     static int output_len;       // Stores number of bytes read
     switch(event->event_id) 
     {
@@ -64,52 +129,31 @@ esp_err_t _http_event_handle(esp_http_client_event_t *event)
             event->header_key, event->header_value);
             break;
 
-        // Occurs when receiving data from the server, possibly multiple portions of the packet
+        // Occurs when receiving data from the server, possibly multiple portions of the packet.
+        // Chunked bodies are already decoded at this point.
         case HTTP_EVENT_ON_DATA:
             ESP_LOGI(TAG, "HTTP_EVENT_ON_DATA, len = %d", event->data_len);
-            if (!esp_http_client_is_chunked_response(event->client))
-            {
-                ESP_LOGI(TAG, "Response is not chunked.");
-                // If user_data buffer is configured,
-                // copy the response into the buffer.
-                if (event->user_data) {
-                    memcpy(event->user_data + output_len, event->data, event->data_len);
-                } else {
-                    if (output_buffer == NULL)
-                    {
-                        output_buffer = (char *) malloc(esp_http_client_get_content_length(event->client));
-                        output_len = 0;
-                        if (output_buffer == NULL) 
-                        {
-                            ESP_LOGE(TAG, "Failed to allocate memory for output buffer");
-                            return ESP_FAIL;
-                        }
-                    }
-                    memcpy(output_buffer + output_len, event->data, event->data_len);
-                    ESP_LOGI(TAG, "Response body reception is complete.");
-                }
+            // If user_data buffer is configured,
+            // copy the response into the buffer.
+            if (event->user_data) {
+                memcpy(event->user_data + output_len, event->data, event->data_len);
+                output_len += event->data_len;
             } else {
-                ESP_LOGI(TAG, "Response is chunked.");
-                if (output_buffer == NULL)
+                int copy_len = event->data_len;
+                if (output_len + copy_len > MAX_HTTP_OUTPUT_BUFFER)
                 {
-                    output_buffer = (char *) malloc(event->data_len * sizeof(char));
-                    output_len = 0;
-                    if (output_buffer == NULL)
-                    {
-                        ESP_LOGE(TAG, "Failed to allocate memory for output buffer");
-                        return ESP_FAIL;
-                    }
+                    ESP_LOGE(TAG, "Response truncated to %d bytes", MAX_HTTP_OUTPUT_BUFFER);
+                    copy_len = MAX_HTTP_OUTPUT_BUFFER - output_len;
                 }
-                int len = esp_http_client_read_response(event->client, output_buffer + output_len, event->data_len);
-                output_len += len;
-                ESP_LOGI(TAG, "Chunked response body reception is complete.");
+                memcpy(output_buffer + output_len, event->data, copy_len);
+                output_len += copy_len;
             }
             break;
 
         // Occurs when finish a HTTP session
         case HTTP_EVENT_ON_FINISH:
             ESP_LOGI(TAG, "HTTP_EVENT_ON_FINISH");
-            if (output_buffer != NULL) 
+            if (!event->user_data && output_len > 0) 
             {
                 // Response is accumulated in output_buffer.
                 // Uncomment the below line to print the accumulated response.
@@ -118,12 +162,11 @@ esp_err_t _http_event_handle(esp_http_client_event_t *event)
                 //ESP_ERROR_CHECK(esp_http_client_get_header(event->client, "Content-type", &content_type));
                 //if (strcmp(*content_type, "text_html"))
                 //{
+                output_buffer[output_len] = '\0';
                 decode_text_data(output_buffer);
                 //}
-                free(output_buffer);
-                output_buffer = NULL; // to avoid having a dangling pointer
             } else {
-                ESP_LOGI(TAG, "Output_buffer is NULL.");
+                ESP_LOGI(TAG, "Output_buffer is empty.");
             }
             output_len = 0;
             break;
@@ -137,11 +180,6 @@ esp_err_t _http_event_handle(esp_http_client_event_t *event)
                                                             NULL);
             if (err != 0) 
             {
-                if (output_buffer != NULL) 
-                {
-                    free(output_buffer);
-                    output_buffer = NULL; // to avoid having a dangling pointer
-                }
                 output_len = 0;
                 ESP_LOGI(TAG, "Last esp error: %s", esp_err_to_name(err));
                 ESP_LOGI(TAG, "Last mbedtls failure: 0x%x", mbedtls_err);
@@ -156,6 +194,259 @@ void decode_text_data(char* data_buffer)
     ESP_LOGI(TAG, "Text received: %s", data_buffer);
 }
 
+#define PGM_HEADER_FIELDS   4
+#define PGM_MAGIC           (('P' << 8) | '5')
+
+// Consumes as much of the PGM header as data holds and returns the number of
+// bytes used. Header fields may be split across any number of calls.
+static uint32_t pgm_parse_header(image_batch_t* batch, const uint8_t* data, uint32_t data_len)
+{
+    static const uint32_t expected[PGM_HEADER_FIELDS] = { PGM_MAGIC, kNumCols, kNumRows, 255 };
+    uint32_t used = 0;
+    while (used < data_len && !batch->header_done)
+    {
+        uint8_t c = data[used++];
+        bool is_space = (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+        if (batch->in_comment)
+        {
+            batch->in_comment = (c != '\n' && c != '\r');
+        } else if (is_space) {
+            if (!batch->in_token)
+            {
+                continue;
+            }
+            // Only a maximum value below 256 gives 8-bit samples.
+            bool valid = (batch->header_field == PGM_HEADER_FIELDS - 1) 
+                            ? (batch->header_value <= expected[batch->header_field])
+                            : (batch->header_value == expected[batch->header_field]);
+            if (!valid)
+            {
+                ESP_LOGE(TAG, "Unexpected PGM header field %d: %u", 
+                            batch->header_field, (unsigned) batch->header_value);
+                batch->status = ESP_FAIL;
+            }
+            batch->in_token = false;
+            batch->header_value = 0;
+            // A single whitespace separates the last field from the pixels.
+            batch->header_done = (++batch->header_field == PGM_HEADER_FIELDS);
+        } else if (c == '#' && !batch->in_token) {
+            batch->in_comment = true;
+        } else if (batch->header_field == 0) {
+            batch->in_token = true;
+            batch->header_value = (batch->header_value << 8) | c;
+        } else if (c >= '0' && c <= '9') {
+            batch->in_token = true;
+            batch->header_value = batch->header_value * 10 + (c - '0');
+        } else {
+            ESP_LOGE(TAG, "Malformed PGM header");
+            batch->status = ESP_FAIL;
+            batch->header_done = true;
+        }
+    }
+    return used;
+}
+
+static void image_batch_write(image_batch_t* batch, const uint8_t* data, uint32_t data_len)
+{
+    if (batch->format == IMAGE_FORMAT_PGM && !batch->header_done)
+    {
+        uint32_t header_len = pgm_parse_header(batch, data, data_len);
+        data += header_len;
+        data_len -= header_len;
+    }
+    if (batch->status != ESP_OK)
+    {
+        return;
+    }
+
+    uint32_t batch_len = batch->frame_count * kMaxImageSize;
+    while (data_len > 0 && batch->received_len < batch_len)
+    {
+        uint32_t frame_index = batch->received_len / kMaxImageSize;
+        uint32_t frame_offset = batch->received_len % kMaxImageSize;
+        uint32_t copy_len = kMaxImageSize - frame_offset;
+        if (copy_len > data_len)
+        {
+            copy_len = data_len;
+        }
+        memcpy(batch->frames[frame_index] + frame_offset, data, copy_len);
+        batch->received_len += copy_len;
+        data += copy_len;
+        data_len -= copy_len;
+    }
+    if (data_len > 0)
+    {
+        ESP_LOGE(TAG, "Batch response is larger than expected.");
+    }
+}
+
+static void put_le32(uint8_t* dest, uint32_t value)
+{
+    dest[0] = (uint8_t) value;
+    dest[1] = (uint8_t) (value >> 8);
+    dest[2] = (uint8_t) (value >> 16);
+    dest[3] = (uint8_t) (value >> 24);
+}
+
+static void encode_result_record(uint8_t* record, uint32_t image_id, const inference_result_t* result)
+{
+    put_le32(record, image_id);
+    put_le32(record + 4, result->invoke_time_us);
+    for (int k = 0; k < kTopK; k++)
+    {
+        record[8 + k] = result->labels[k];
+        record[8 + kTopK + k] = (uint8_t) result->scores[k];
+    }
+    memset(record + 8 + 2 * kTopK, 0, RESULT_RECORD_SIZE - 8 - 2 * kTopK);
+}
+
+static esp_err_t _http_session_event_handle(esp_http_client_event_t *event)
+{
+    switch(event->event_id) 
+    {
+        case HTTP_EVENT_ERROR:
+            ESP_LOGI(TAG, "HTTP_EVENT_ERROR");
+            break;
+
+        case HTTP_EVENT_ON_CONNECTED:
+            http_session.connection_count++;
+            ESP_LOGI(TAG, "Session connected (%u connections so far)", 
+                        (unsigned) http_session.connection_count);
+            break;
+
+        // The body is already de-chunked here, so each portion can be copied
+        // straight into the frames without buffering the whole response.
+        // Responses to result uploads carry no data worth keeping.
+        case HTTP_EVENT_ON_DATA:
+            if (http_session.batch != NULL)
+            {
+                image_batch_write(http_session.batch, (const uint8_t*) event->data, event->data_len);
+            }
+            break;
+
+        default:
+            break;
+    }
+    return ESP_OK;
+}
+
+// Must be called with the session lock held.
+static esp_err_t http_session_perform(esp_http_client_method_t method, const char* path, const char* query, 
+                                        const char* content_type, const char* post_data, int post_len)
+{
+    if (http_session.client == NULL)
+    {
+        esp_http_client_config_t config = {
+            .host = SERVER_IP,
+            .port = SERVER_HTTP_PORT,
+            .path = "/",
+            .method = HTTP_METHOD_GET,
+            .event_handler = _http_session_event_handle,
+        };
+        http_session.client = esp_http_client_init(&config);
+        if (http_session.client == NULL)
+        {
+            ESP_LOGE(TAG, "Failed to initialize the HTTP session.");
+            return ESP_FAIL;
+        }
+    }
+
+    char url[96];
+    snprintf(url, sizeof(url), "http://%s:%d%s%s%s", SERVER_IP, SERVER_HTTP_PORT, 
+                path, query ? "?" : "", query ? query : "");
+    esp_http_client_set_url(http_session.client, url);
+    esp_http_client_set_method(http_session.client, method);
+    esp_http_client_set_post_field(http_session.client, post_data, post_len);
+    if (content_type != NULL)
+    {
+        esp_http_client_set_header(http_session.client, "Content-Type", content_type);
+    } else {
+        esp_http_client_delete_header(http_session.client, "Content-Type");
+    }
+
+    // The connection stays open between requests as long as the server
+    // keeps it alive, the client reconnects by itself when it has not.
+    esp_err_t err = esp_http_client_perform(http_session.client);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Session request %s failed: %s", path, esp_err_to_name(err));
+        esp_http_client_close(http_session.client);
+        return err;
+    }
+
+    int status = esp_http_client_get_status_code(http_session.client);
+    if (status < 200 || status >= 300)
+    {
+        ESP_LOGE(TAG, "Session request %s returned status %d", path, status);
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    return ESP_OK;
+}
+
+// Must be called with the session lock held.
+static esp_err_t http_session_flush_results(void)
+{
+    if (http_session.results_count == 0)
+    {
+        return ESP_OK;
+    }
+
+    esp_err_t err = http_session_perform(HTTP_METHOD_POST, "/results", NULL, "application/octet-stream", 
+                                        http_session.results, http_session.results_len);
+    if (err == ESP_OK)
+    {
+        http_session.results_len = 0;
+        http_session.results_count = 0;
+        http_session.last_flush_time = esp_timer_get_time();
+    }
+    return err;
+}
+
+static bool http_session_lock(void)
+{
+    if (http_session.lock == NULL)
+    {
+        ESP_LOGE(TAG, "HTTP session used before app_httpClient_main().");
+        return false;
+    }
+    xSemaphoreTake(http_session.lock, portMAX_DELAY);
+    return true;
+}
+
+esp_err_t httpClient_getImages(uint32_t start_id, uint32_t count, uint8_t** frames)
+{
+    image_batch_t batch = {
+        .frames = frames,
+        .frame_count = count,
+        .format = IMAGE_FORMAT_RAW,
+        .status = ESP_OK,
+    };
+
+    char query[48];
+    snprintf(query, sizeof(query), "start=%u&count=%u", (unsigned) start_id, (unsigned) count);
+
+    if (!http_session_lock())
+    {
+        return ESP_FAIL;
+    }
+    http_session.batch = &batch;
+    esp_err_t err = http_session_perform(HTTP_METHOD_GET, "/images", query, NULL, NULL, 0);
+    http_session.batch = NULL;
+    xSemaphoreGive(http_session.lock);
+
+    if (err == ESP_OK)
+    {
+        err = batch.status;
+    }
+    if (err == ESP_OK && batch.received_len != count * kMaxImageSize)
+    {
+        ESP_LOGE(TAG, "Image batch truncated: %u of %u bytes", 
+                    (unsigned) batch.received_len, (unsigned) (count * kMaxImageSize));
+        err = ESP_FAIL;
+    }
+    return err;
+}
+
 esp_err_t http_rest_GET_request(const char* resourcePath, const char* parameters)
 {
     ESP_LOGI(TAG, "Sending a GET request...");
@@ -317,24 +608,114 @@ static void test_server_connectivity(void * pvParameters)
     }
 }
 
-void httpClient_getImage(uint8_t*)
+esp_err_t httpClient_getImage(uint32_t image_id, uint8_t* image)
 {
+    image_batch_t batch;
+
+    char query[48];
+    snprintf(query, sizeof(query), "outputFormat=pgm&ImageID=%u", (unsigned) image_id);
+
+    if (!http_session_lock())
+    {
+        return ESP_FAIL;
+    }
+
     esp_err_t err;
-    ESP_LOGI(TAG, "Getting image");
-    const char* image_param = "outputFormat=png&ImageID=500";
+    ESP_LOGI(TAG, "Getting image %u", (unsigned) image_id);
     do {
-        err = http_rest_GET_request("/image", image_param);
-        if (err != ESP_OK)
+        batch = (image_batch_t) {
+            .frames = &image,
+            .frame_count = 1,
+            .format = IMAGE_FORMAT_PGM,
+            .status = ESP_OK,
+        };
+        http_session.batch = &batch;
+        err = http_session_perform(HTTP_METHOD_GET, "/image", query, NULL, NULL, 0);
+        http_session.batch = NULL;
+        if (err != ESP_OK && err != ESP_ERR_INVALID_RESPONSE)
         {
+            // Wait for the connectivity task to see the server again.
             xEventGroupSetBits(server_event_group, SERVER_DISCONNECTED_BIT);
-            bits = xEventGroupWaitBits(server_event_group,
+            xEventGroupWaitBits(server_event_group,
                 SERVER_CONNECTED_BIT,
                 pdTRUE,
                 pdFALSE,
                 portMAX_DELAY);
         }
-        vTaskDelay(50 / portTICK_PERIOD_MS);
-    } while (err != ESP_OK);
+    } while (err != ESP_OK && err != ESP_ERR_INVALID_RESPONSE);
+
+    xSemaphoreGive(http_session.lock);
+
+    if (err != ESP_OK)
+    {
+        return err;
+    }
+    if (batch.status != ESP_OK || batch.received_len != kMaxImageSize)
+    {
+        ESP_LOGE(TAG, "Image %u could not be decoded (%u of %u pixels)", (unsigned) image_id, 
+                    (unsigned) batch.received_len, (unsigned) kMaxImageSize);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpClient_postResult(uint32_t image_id, const inference_result_t* result)
+{
+    if (!http_session_lock())
+    {
+        return ESP_FAIL;
+    }
+
+    if (http_session.results_count == 0)
+    {
+        http_session.last_flush_time = esp_timer_get_time();
+    }
+    encode_result_record((uint8_t*) http_session.results + http_session.results_len, image_id, result);
+    http_session.results_len += RESULT_RECORD_SIZE;
+    http_session.results_count++;
+
+    esp_err_t err = ESP_OK;
+    int64_t pending_time_ms = (esp_timer_get_time() - http_session.last_flush_time) / 1000;
+    if (http_session.results_count >= RESULTS_BATCH_SIZE || pending_time_ms >= RESULTS_FLUSH_PERIOD_MS)
+    {
+        err = http_session_flush_results();
+        // Keep the results for the next attempt, unless there is no room left.
+        if (err != ESP_OK && http_session.results_count >= RESULTS_BATCH_SIZE)
+        {
+            ESP_LOGE(TAG, "Dropping %u results.", (unsigned) http_session.results_count);
+            http_session.results_len = 0;
+            http_session.results_count = 0;
+        }
+    }
+
+    xSemaphoreGive(http_session.lock);
+    return err;
+}
+
+esp_err_t httpClient_flushResults(void)
+{
+    if (!http_session_lock())
+    {
+        return ESP_FAIL;
+    }
+    esp_err_t err = http_session_flush_results();
+    xSemaphoreGive(http_session.lock);
+    return err;
+}
+
+esp_err_t httpClient_exportResults(void)
+{
+    if (!http_session_lock())
+    {
+        return ESP_FAIL;
+    }
+    esp_err_t err = http_session_flush_results();
+    if (err == ESP_OK)
+    {
+        err = http_session_perform(HTTP_METHOD_POST, "/export", NULL, NULL, NULL, 0);
+    }
+    xSemaphoreGive(http_session.lock);
+    return err;
 }
 
 void app_httpClient_main(void)
@@ -342,6 +723,7 @@ void app_httpClient_main(void)
     ESP_LOGI(TAG, "Starting httpClient application.");
     
     server_event_group = xEventGroupCreate();
+    http_session.lock = xSemaphoreCreateMutex();
     EventBits_t bits;
 
     bits = xEventGroupClearBits(
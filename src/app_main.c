@@ -5,10 +5,12 @@
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_spi_flash.h"
+#include "sdkconfig.h"
 
 #include "app_tflite.h"
 #include "app_wifi.h"
 #include "app_httpClient.h"
+#include "app_pipeline.h"
 
 static const char *TAG = "App_Main";
 
@@ -16,15 +18,18 @@ void app_main()
 {
   ESP_LOGI(TAG, "Starting main application");
 
+  // Synthetic benchmark runs do not need the network at all.
+#ifndef CONFIG_BENCHMARK_SYNTHETIC_INPUT
   app_wifi_main();
   vTaskDelay(50 / portTICK_PERIOD_MS);
   app_httpClient_main();
   vTaskDelay(50 / portTICK_PERIOD_MS);
+#endif
   TF_init_status = app_tflite_init();
   
   if (TF_init_status == ESP_OK){
-      //Start prediction task
-      xTaskCreate(&tf_start_inference, "tf_start_inference", 1024*20, NULL, tskIDLE_PRIORITY, NULL);
+      //Start the fetch / preprocess / invoke / report pipeline
+      if (app_pipeline_start() != ESP_OK) ESP_LOGE(TAG, "Inference pipeline was not started");
   } else ESP_LOGI(TAG, "TfLite was not initialized");
 
   while(true)
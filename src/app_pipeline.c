@@ -0,0 +1,522 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/event_groups.h"
+#include "sdkconfig.h"
+
+#include "app_pipeline.h"
+#include "app_tflite.h"
+#include "app_httpClient.h"
+#include "image_provider.h"
+#include "frame_pool.h"
+#include "latency_stats.h"
+
+static const char *TAG = "App_Pipeline";
+
+#define PIPELINE_STAGE_COUNT        4
+#define PIPELINE_INVOKE_STAGE       2
+#define PIPELINE_TASK_STACK_SIZE    (1024 * 4)
+#define PIPELINE_INVOKE_STACK_SIZE  (1024 * 20)
+#define PIPELINE_TASK_PRIORITY      (tskIDLE_PRIORITY + 1)
+#define PIPELINE_DONE_BIT           BIT0
+
+typedef struct
+{
+    frame_t* frame;
+    // Set by the first stage that fails on this frame, the stages after it
+    // only forward the frame so it still gets back to the pool.
+    esp_err_t status;
+} pipeline_item_t;
+
+// Works on count frames at once, up to the batch size of the stage. The
+// worker index tells the invoke stage which interpreter to use.
+typedef esp_err_t (*pipeline_work_t)(frame_t* const* frames, int count, int worker);
+
+// One task of a stage. Frames leased by the fetch stage are handed from
+// queue to queue and returned to the frame pool by the report stage, so the
+// fetch worker has no input queue.
+typedef struct
+{
+    int stage;
+    int index;
+    char name[configMAX_TASK_NAME_LEN];
+    TaskHandle_t task;
+    QueueHandle_t input;
+    // Worker of the next stage the next frame goes to, they take turns.
+    int next_worker;
+    // Time spent in work(), published in milliseconds with relaxed atomics
+    // so the stats can be read from another task without tearing.
+    uint32_t busy_ms;
+    // Per-image time spent in work(), amortized over the batch. Only read
+    // once the pipeline is done.
+    latency_stats_t latency;
+} pipeline_worker_t;
+
+typedef struct
+{
+    const char* name;
+    pipeline_work_t work;
+    // Core of the first worker, the next ones go to the other cores in turn.
+    BaseType_t core;
+    uint32_t stack_size;
+    pipeline_worker_t* workers;
+    int worker_count;
+    // Most frames per work() call. A worker takes whichever frames are
+    // already queued, it never waits for a batch to fill up.
+    int batch_size;
+} pipeline_stage_t;
+
+static uint32_t reported_count = 0;
+static int64_t pipeline_start_time = 0;
+static EventGroupHandle_t pipeline_event_group = NULL;
+
+// Breakdown of the invoke stage into the interpreter itself and the input
+// copy plus top-k selection around it, per worker.
+static latency_stats_t interpreter_latency[TF_MAX_INSTANCES];
+static latency_stats_t topk_latency[TF_MAX_INSTANCES];
+
+static esp_err_t preprocess_work(frame_t* const* frames, int count, int worker);
+static esp_err_t invoke_work(frame_t* const* frames, int count, int worker);
+static esp_err_t report_work(frame_t* const* frames, int count, int worker);
+
+// The invoke stage runs one worker per interpreter, the others a single one.
+static pipeline_worker_t fetch_workers[1];
+static pipeline_worker_t preprocess_workers[1];
+static pipeline_worker_t invoke_workers[TF_MAX_INSTANCES];
+static pipeline_worker_t report_workers[1];
+
+// The fetch stage works on whole batches and has its own task, see
+// pipeline_fetch_task. The invoke stage batches as many images per invoke
+// as the interpreters take.
+static pipeline_stage_t stages[PIPELINE_STAGE_COUNT] = {
+    { "fetch",      NULL,            PIPELINE_NETWORK_CORE, PIPELINE_TASK_STACK_SIZE,   fetch_workers,      1, PIPELINE_FETCH_BATCH },
+    { "preprocess", preprocess_work, PIPELINE_COMPUTE_CORE, PIPELINE_TASK_STACK_SIZE,   preprocess_workers, 1, 1 },
+    { "invoke",     invoke_work,     PIPELINE_COMPUTE_CORE, PIPELINE_INVOKE_STACK_SIZE, invoke_workers,     1, 1 },
+    { "report",     report_work,     PIPELINE_NETWORK_CORE, PIPELINE_TASK_STACK_SIZE,   report_workers,     1, 1 },
+};
+
+static esp_err_t preprocess_work(frame_t* const* frames, int count, int worker)
+{
+    (void) worker;
+    for (int i = 0; i < count; i++)
+    {
+        esp_err_t err = PreprocessImage(frames[i]->data.pixels, &frames[i]->data);
+        if (err != ESP_OK)
+        {
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t invoke_work(frame_t* const* frames, int count, int worker)
+{
+    const void* images[TF_MAX_BATCH];
+    inference_result_t* results[TF_MAX_BATCH];
+    for (int i = 0; i < count; i++)
+    {
+        images[i] = &frames[i]->data;
+        results[i] = &frames[i]->result;
+    }
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = tf_invoke(worker, images, count, results);
+    if (err == ESP_OK)
+    {
+        // Per image, the invoke time is already its share of the batch.
+        uint32_t total_us = (uint32_t) (esp_timer_get_time() - start) / count;
+        uint32_t invoke_us = frames[0]->result.invoke_time_us;
+        latency_stats_record(&interpreter_latency[worker], invoke_us, count);
+        latency_stats_record(&topk_latency[worker], (total_us > invoke_us) ? total_us - invoke_us : 0, count);
+    }
+    return err;
+}
+
+// Round-robin dispatch of the frames to the workers of the next stage.
+static void pipeline_forward(pipeline_worker_t* worker, const pipeline_item_t* item)
+{
+    const pipeline_stage_t* next = &stages[worker->stage + 1];
+    QueueHandle_t queue = next->workers[worker->next_worker].input;
+    worker->next_worker = (worker->next_worker + 1) % next->worker_count;
+    xQueueSend(queue, item, portMAX_DELAY);
+}
+
+#ifdef CONFIG_BENCHMARK_SYNTHETIC_INPUT
+// Deterministic pseudo-random images, so that benchmark runs are comparable
+// and do not depend on the network or the images server.
+static esp_err_t pipeline_get_images(uint32_t start_id, uint32_t count, uint8_t** frames)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t state = ((start_id + i) * 2654435761u) | 1;
+        for (uint32_t p = 0; p < kMaxImageSize; p++)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            frames[i][p] = (uint8_t) state;
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t report_work(frame_t* const* frames, int count, int worker)
+{
+    (void) frames;
+    (void) count;
+    (void) worker;
+    return ESP_OK;
+}
+
+static void report_idle(void)
+{
+}
+#else
+static esp_err_t pipeline_get_images(uint32_t start_id, uint32_t count, uint8_t** frames)
+{
+    return httpClient_getImages(start_id, count, frames);
+}
+
+static esp_err_t report_work(frame_t* const* frames, int count, int worker)
+{
+    (void) worker;
+    for (int i = 0; i < count; i++)
+    {
+        esp_err_t err = httpClient_postResult(frames[i]->image_id, &frames[i]->result);
+        if (err != ESP_OK)
+        {
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+// The results are posted in batches, the last ones of a burst would wait
+// for the next frame to be reported: they are uploaded once no frame has
+// come for RESULTS_FLUSH_PERIOD_MS.
+static void report_idle(void)
+{
+    if (httpClient_flushResults() != ESP_OK)
+    {
+        ESP_LOGE(TAG, "The pending results could not be uploaded.");
+    }
+}
+#endif
+
+static void log_pipeline_stats(void)
+{
+    uint32_t elapsed_ms = (uint32_t) ((esp_timer_get_time() - pipeline_start_time) / 1000);
+    if (elapsed_ms == 0)
+    {
+        return;
+    }
+
+    ESP_LOGI(TAG, "%u images in %u ms (%.2f images/s)",
+                (unsigned) reported_count, (unsigned) elapsed_ms, reported_count * 1000.0f / elapsed_ms);
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++)
+    {
+        // Occupancy of the workers on average, and the frames waiting for
+        // any of them.
+        uint32_t busy_ms = 0;
+        uint32_t queued = 0;
+        for (int w = 0; w < stages[i].worker_count; w++)
+        {
+            const pipeline_worker_t* worker = &stages[i].workers[w];
+            busy_ms += __atomic_load_n(&worker->busy_ms, __ATOMIC_RELAXED);
+            queued += (worker->input != NULL) ? uxQueueMessagesWaiting(worker->input) : frame_pool_available();
+        }
+        ESP_LOGI(TAG, "  %-10s occupancy %5.1f%%, %u frames queued, %d workers",
+                    stages[i].name, busy_ms * 100.0f / elapsed_ms / stages[i].worker_count, (unsigned) queued,
+                    stages[i].worker_count);
+    }
+}
+
+static void print_latency_json(const char* name, const latency_stats_t* stats, bool last)
+{
+    printf("\"%s\":{\"count\":%u,\"mean_us\":%u,\"p50_us\":%u,\"p95_us\":%u,\"p99_us\":%u,\"max_us\":%u}%s",
+            name, (unsigned) stats->count, (unsigned) latency_stats_mean(stats),
+            (unsigned) latency_stats_percentile(stats, 50), (unsigned) latency_stats_percentile(stats, 95),
+            (unsigned) latency_stats_percentile(stats, 99), (unsigned) stats->max_us, last ? "" : ",");
+}
+
+// Merges the histograms of the workers, once they are all done with them.
+static const latency_stats_t* merge_latency(const latency_stats_t* stats, int count)
+{
+    static latency_stats_t merged;
+    latency_stats_reset(&merged);
+    for (int i = 0; i < count; i++)
+    {
+        latency_stats_merge(&merged, &stats[i]);
+    }
+    return &merged;
+}
+
+static const latency_stats_t* stage_latency(const pipeline_stage_t* stage)
+{
+    static latency_stats_t merged;
+    latency_stats_reset(&merged);
+    for (int i = 0; i < stage->worker_count; i++)
+    {
+        latency_stats_merge(&merged, &stage->workers[i].latency);
+    }
+    return &merged;
+}
+
+// Prints the results of the run as a single JSON line, meant to be picked
+// out of the console output with grep '^{"benchmark"'. The fetch latency is
+// per image, amortized over the batch it was downloaded with.
+static void print_benchmark_json(void)
+{
+    uint32_t elapsed_ms = (uint32_t) ((esp_timer_get_time() - pipeline_start_time) / 1000);
+#ifdef CONFIG_BENCHMARK_SYNTHETIC_INPUT
+    const char* input = "synthetic";
+#else
+    const char* input = "server";
+#endif
+
+    const model_entry_t* model = tf_model();
+
+    printf("{\"benchmark\":\"pipeline\",\"model\":\"%s\",\"model_size_bytes\":%u,\"input\":\"%s\","
+            "\"images\":%u,\"elapsed_ms\":%u,\"images_per_s\":%.2f,\"instances\":%d,\"batch\":%d,\"arena_used_bytes\":%u,"
+            "\"ram_weights_bytes\":%u,\"model_weights_bytes\":%u,"
+            "\"stages\":{",
+            model ? model->name : "", model ? model->size : 0, input, (unsigned) reported_count, (unsigned) elapsed_ms,
+            elapsed_ms > 0 ? reported_count * 1000.0 / elapsed_ms : 0.0, tf_instance_count(), tf_batch_size(),
+            (unsigned) tf_arena_used_bytes(), (unsigned) tf_ram_weights_bytes(), (unsigned) tf_model_weights_bytes());
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++)
+    {
+        print_latency_json(stages[i].name, stage_latency(&stages[i]), i == PIPELINE_STAGE_COUNT - 1);
+    }
+    printf("},\"invoke_breakdown\":{");
+    print_latency_json("interpreter", merge_latency(interpreter_latency, tf_instance_count()), false);
+    print_latency_json("topk", merge_latency(topk_latency, tf_instance_count()), true);
+    printf("}}\n");
+    fflush(stdout);
+    tf_print_profile_json();
+}
+
+static void pipeline_fetch_task(void* pvParameters)
+{
+    pipeline_worker_t* worker = (pipeline_worker_t*) pvParameters;
+    pipeline_item_t items[PIPELINE_FETCH_BATCH];
+    uint8_t* frames[PIPELINE_FETCH_BATCH];
+    uint32_t next_image_id = 0;
+    int64_t busy_us = 0;
+
+    while (next_image_id < PIPELINE_IMAGE_COUNT)
+    {
+        // Wait for one free frame, then batch it with whichever other frames
+        // have already been released by the report stage. The report stage
+        // notifies this task after every release, so no wake-up is lost
+        // between a failed lease and the wait.
+        uint32_t remaining = PIPELINE_IMAGE_COUNT - next_image_id;
+        uint32_t count = 0;
+        while ((items[0].frame = frame_pool_acquire()) == NULL)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+        count++;
+        while (count < PIPELINE_FETCH_BATCH && count < remaining
+                && (items[count].frame = frame_pool_acquire()) != NULL)
+        {
+            count++;
+        }
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            items[i].frame->image_id = next_image_id + i;
+            items[i].status = ESP_OK;
+            frames[i] = items[i].frame->data.pixels;
+        }
+
+        int64_t start = esp_timer_get_time();
+        while (pipeline_get_images(next_image_id, count, frames) != ESP_OK)
+        {
+            ESP_LOGE(TAG, "Fetching images %u to %u failed, retrying.",
+                        (unsigned) next_image_id, (unsigned) (next_image_id + count - 1));
+            vTaskDelay(1000 / portTICK_PERIOD_MS);
+        }
+        int64_t batch_us = esp_timer_get_time() - start;
+        busy_us += batch_us;
+        __atomic_store_n(&worker->busy_ms, (uint32_t) (busy_us / 1000), __ATOMIC_RELAXED);
+        latency_stats_record(&worker->latency, (uint32_t) (batch_us / count), count);
+        next_image_id += count;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            pipeline_forward(worker, &items[i]);
+        }
+    }
+
+    ESP_LOGI(TAG, "All images have been fetched.");
+    vTaskDelete(NULL);
+}
+
+static void pipeline_stage_task(void* pvParameters)
+{
+    pipeline_worker_t* worker = (pipeline_worker_t*) pvParameters;
+    const pipeline_stage_t* stage = &stages[worker->stage];
+    bool is_last_stage = (worker->stage == PIPELINE_STAGE_COUNT - 1);
+    TickType_t wait_ticks = is_last_stage ? pdMS_TO_TICKS(RESULTS_FLUSH_PERIOD_MS) : portMAX_DELAY;
+    int64_t busy_us = 0;
+    pipeline_item_t items[FRAME_POOL_SIZE];
+    frame_t* frames[FRAME_POOL_SIZE];
+
+    while (true)
+    {
+        // Wait for one frame, then batch it with whichever other frames are
+        // already waiting. The report stage wakes up when idle to upload
+        // the results it has queued.
+        int count = 0;
+        if (xQueueReceive(worker->input, &items[count], wait_ticks) != pdTRUE)
+        {
+            report_idle();
+            continue;
+        }
+        count++;
+        while (count < stage->batch_size && xQueueReceive(worker->input, &items[count], 0) == pdTRUE)
+        {
+            count++;
+        }
+
+        // Frames a previous stage failed on are only passed along.
+        int work_count = 0;
+        for (int i = 0; i < count; i++)
+        {
+            if (items[i].status == ESP_OK)
+            {
+                frames[work_count++] = items[i].frame;
+            }
+        }
+        if (work_count > 0)
+        {
+            int64_t start = esp_timer_get_time();
+            esp_err_t status = stage->work(frames, work_count, worker->index);
+            int64_t work_us = esp_timer_get_time() - start;
+            busy_us += work_us;
+            __atomic_store_n(&worker->busy_ms, (uint32_t) (busy_us / 1000), __ATOMIC_RELAXED);
+            latency_stats_record(&worker->latency, (uint32_t) (work_us / work_count), work_count);
+
+            for (int i = 0; i < count && status != ESP_OK; i++)
+            {
+                if (items[i].status == ESP_OK)
+                {
+                    items[i].status = status;
+                    ESP_LOGE(TAG, "Stage %s failed on image %u.", worker->name, (unsigned) items[i].frame->image_id);
+                }
+            }
+        }
+
+        bool done = false;
+        for (int i = 0; i < count; i++)
+        {
+            if (!is_last_stage)
+            {
+                pipeline_forward(worker, &items[i]);
+                continue;
+            }
+
+            reported_count++;
+            if (reported_count % PIPELINE_STATS_PERIOD == 0)
+            {
+                log_pipeline_stats();
+            }
+            frame_pool_release(items[i].frame);
+            xTaskNotifyGive(fetch_workers[0].task);
+            done = (reported_count >= PIPELINE_IMAGE_COUNT);
+        }
+
+        if (done)
+        {
+            // Unless the last frame already logged them.
+            if (reported_count % PIPELINE_STATS_PERIOD != 0)
+            {
+                log_pipeline_stats();
+            }
+            print_benchmark_json();
+#ifndef CONFIG_BENCHMARK_SYNTHETIC_INPUT
+            ESP_LOGI(TAG, "All results have been reported, exporting.");
+            httpClient_exportResults();
+#endif
+            xEventGroupSetBits(pipeline_event_group, PIPELINE_DONE_BIT);
+            break;
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+esp_err_t app_pipeline_start(void)
+{
+    ESP_LOGI(TAG, "Starting inference pipeline.");
+
+    frame_pool_init();
+
+    pipeline_event_group = xEventGroupCreate();
+    if (pipeline_event_group == NULL)
+    {
+        ESP_LOGE(TAG, "Failed to create the pipeline event group.");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // One invoke worker per interpreter, taking as many images as it runs
+    // per invoke.
+    stages[PIPELINE_INVOKE_STAGE].worker_count = tf_instance_count();
+    stages[PIPELINE_INVOKE_STAGE].batch_size = tf_batch_size();
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++)
+    {
+        for (int w = 0; w < stages[i].worker_count; w++)
+        {
+            pipeline_worker_t* worker = &stages[i].workers[w];
+            worker->stage = i;
+            worker->index = w;
+            if (stages[i].worker_count > 1)
+            {
+                snprintf(worker->name, sizeof(worker->name), "%s%d", stages[i].name, w);
+            } else {
+                snprintf(worker->name, sizeof(worker->name), "%s", stages[i].name);
+            }
+            if (i == 0)
+            {
+                continue;
+            }
+            worker->input = xQueueCreate(FRAME_POOL_SIZE, sizeof(pipeline_item_t));
+            if (worker->input == NULL)
+            {
+                ESP_LOGE(TAG, "Failed to create the %s queue.", worker->name);
+                return ESP_ERR_NO_MEM;
+            }
+        }
+    }
+
+    pipeline_start_time = esp_timer_get_time();
+    for (int i = 0; i < PIPELINE_STAGE_COUNT; i++)
+    {
+        TaskFunction_t task = (i == 0) ? &pipeline_fetch_task : &pipeline_stage_task;
+        for (int w = 0; w < stages[i].worker_count; w++)
+        {
+            pipeline_worker_t* worker = &stages[i].workers[w];
+            BaseType_t core = (stages[i].core + w) % PIPELINE_CORE_COUNT;
+            if (xTaskCreatePinnedToCore(task, worker->name, stages[i].stack_size,
+                                        worker, PIPELINE_TASK_PRIORITY, &worker->task, core) != pdPASS)
+            {
+                ESP_LOGE(TAG, "Failed to start the %s task.", worker->name);
+                return ESP_FAIL;
+            }
+        }
+    }
+
+    return ESP_OK;
+}
+
+void app_pipeline_wait(void)
+{
+    xEventGroupWaitBits(pipeline_event_group, PIPELINE_DONE_BIT, pdFALSE, pdTRUE, portMAX_DELAY);
+}
@@ -14,8 +14,21 @@ limitations under the License.
 ==============================================================================*/
 
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <new>
 
 #include "esp_system.h"
+#include "esp_timer.h"
+#ifdef CONFIG_MODEL_STATE_SNAPSHOT
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#include "esp_ota_ops.h"
+#else
+#include <sys/stat.h>
+#endif
+#endif
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
@@ -24,41 +37,256 @@ limitations under the License.
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/micro/kernels/micro_ops.h"
-#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
 #include "tensorflow/lite/micro/system_setup.h"
+#include "tensorflow/lite/micro/tensor_placement.h"
 
 #include "app_tflite.h"
 
 #include "image_provider.h"
 #include "model_settings.h"
-#include "model.h"
+#include "model_op_resolver.h"
+#include "model_registry.h"
+#include "model_source.h"
 #include "app_httpClient.h"
+#ifdef CONFIG_BENCHMARK_OP_PROFILER
+#include "op_profiler.h"
+#endif
+#ifdef CONFIG_BENCHMARK_ARENA_TUNER
+#include "arena_tuner.h"
+#endif
+
+static const char *TAG = "App_TFLite";
 
 namespace {
   // setting up logging
   tflite::ErrorReporter* error_reporter = nullptr;
 
+  const model_entry_t* model_entry = nullptr;
   const tflite::Model* model = nullptr;
-  tflite::MicroInterpreter* interpreter = nullptr;
 
-  TfLiteTensor* input = nullptr;
-  TfLiteTensor* output = nullptr;
+  // One interpreter over the shared, read-only model, with the input and
+  // output tensors of its own arena slice.
+  typedef struct
+  {
+    tflite::MicroInterpreter* interpreter;
+    TfLiteTensor* input;
+    TfLiteTensor* output;
+  } tf_instance_t;
+
+  tf_instance_t instances[TF_MAX_INSTANCES];
+  int instance_count = 0;
+  int batch_size = 0;
+  // Bytes of one image in the input tensor.
+  size_t input_image_bytes = 0;
 
   // Create an area of memory to use for input, output, and intermediate arrays.
   // The size of this will depend on the model you're using, and may need to be
-  // determined by experimentation.
-  constexpr int kTensorArenaSize = 12 * 1024;
-  static uint8_t tensor_arena[kTensorArenaSize];
+  // determined by experimentation. It is sized for the largest linked model,
+  // plus room for the recording allocator when the arena is tuned on target,
+  // and for the activations of a whole batch. Every interpreter gets a slice
+  // of that size, which keeps the next one aligned.
+#if TF_MAX_BATCH > MODEL_ARENA_MAX_BATCH
+#error "The arena is only tuned for batches of up to MODEL_ARENA_MAX_BATCH images"
+#endif
+#ifdef CONFIG_BENCHMARK_ARENA_TUNER
+  constexpr int kTensorArenaSize = (MODEL_REGISTRY_BATCH_ARENA_SIZE(TF_MAX_BATCH) + 1024 + MODEL_ARENA_ALIGNMENT - 1)
+                                   / MODEL_ARENA_ALIGNMENT * MODEL_ARENA_ALIGNMENT;
+#else
+  constexpr int kTensorArenaSize = (MODEL_REGISTRY_BATCH_ARENA_SIZE(TF_MAX_BATCH) + MODEL_ARENA_ALIGNMENT - 1)
+                                   / MODEL_ARENA_ALIGNMENT * MODEL_ARENA_ALIGNMENT;
+#endif
+  alignas(MODEL_ARENA_ALIGNMENT) static uint8_t tensor_arena[TF_MAX_INSTANCES][kTensorArenaSize];
+
+#if defined(CONFIG_MODEL_FAST_WEIGHTS_SIZE) && CONFIG_MODEL_FAST_WEIGHTS_SIZE > 0
+  // The model is read from flash through its cache, which the large dense
+  // weights, read once per invoke, keep evicting. The small tensors read
+  // over and over, convolution filters and biases, get copied to internal
+  // RAM, one copy per interpreter. Not IRAM: it only takes 32-bit accesses
+  // and the int8 kernels read the weights byte by byte.
+  constexpr size_t kFastWeightsSize = (CONFIG_MODEL_FAST_WEIGHTS_SIZE + MODEL_ARENA_ALIGNMENT - 1)
+                                      / MODEL_ARENA_ALIGNMENT * MODEL_ARENA_ALIGNMENT;
+  alignas(MODEL_ARENA_ALIGNMENT) static uint8_t fast_weights[TF_MAX_INSTANCES][kFastWeightsSize];
+  const tflite::SmallTensorPlacementPolicy fast_weights_policy(CONFIG_MODEL_FAST_WEIGHT_MAX_TENSOR);
+#endif
+
+  // The interpreters are only constructed once the model is known.
+  alignas(tflite::MicroInterpreter) static uint8_t interpreter_storage[TF_MAX_INSTANCES][sizeof(tflite::MicroInterpreter)];
+
+  // Destroys the first count interpreters, constructed in
+  // interpreter_storage, when the initialization fails past them.
+  void destroy_instances(int count)
+  {
+    for (int i = 0; i < count; i++)
+    {
+      instances[i].interpreter->~MicroInterpreter();
+      instances[i] = tf_instance_t();
+    }
+  }
+
+#ifdef CONFIG_BENCHMARK_OP_PROFILER
+  // Times every operator of every invoke of the first interpreter, the
+  // profiler must only be used by one task.
+  OpProfiler op_profiler;
+  tflite::MicroProfiler* profiler = &op_profiler;
+#else
+  tflite::MicroProfiler* profiler = nullptr;
+#endif
+
+#ifdef CONFIG_MODEL_STATE_SNAPSHOT
+  // The state each interpreter is left in by AllocateTensors(), which the
+  // next boot restores instead of planning the arena and preparing the
+  // kernels again. On target it is kept in the RTC memory, that deep sleep
+  // retains and that nothing initializes at boot: after a power-on it holds
+  // garbage, that fails the checksum. On the host it is kept in a file, and
+  // the addresses the state holds only stay the same without ASLR.
+  constexpr size_t kStateSnapshotSize = CONFIG_MODEL_STATE_SNAPSHOT_SIZE;
+#ifdef ESP_PLATFORM
+  RTC_NOINIT_ATTR uint8_t state_snapshots[TF_MAX_INSTANCES][kStateSnapshotSize];
+#else
+  uint8_t state_snapshots[TF_MAX_INSTANCES][kStateSnapshotSize];
+#endif
+
+  uint64_t fnv1a_64(uint64_t hash, const void* data, size_t size)
+  {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+      hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+  }
+
+  // A snapshot points into the model and the code of the build that took
+  // it, it is keyed by both. The hash of the build covers the linked
+  // models, only the ones from a model source, that were not tuned, are
+  // hashed: that would take longer than preparing the interpreter.
+  uint64_t state_snapshot_key(const model_entry_t* entry)
+  {
+    uint64_t key = fnv1a_64(14695981039346656037ull, &entry->size, sizeof(entry->size));
+    if (entry->arena_size == 0)
+    {
+      key = fnv1a_64(key, entry->data, entry->size);
+    }
+#ifdef ESP_PLATFORM
+    const esp_app_desc_t* app = esp_ota_get_app_description();
+    key = fnv1a_64(key, app->app_elf_sha256, sizeof(app->app_elf_sha256));
+#else
+    struct stat status;
+    if (stat("/proc/self/exe", &status) == 0)
+    {
+      key = fnv1a_64(key, &status.st_size, sizeof(status.st_size));
+      key = fnv1a_64(key, &status.st_mtime, sizeof(status.st_mtime));
+    }
+#endif
+    return key;
+  }
+
+#ifndef ESP_PLATFORM
+  void load_state_snapshots(void)
+  {
+    memset(state_snapshots, 0, sizeof(state_snapshots));
+    FILE* file = fopen(CONFIG_MODEL_STATE_FILE, "rb");
+    if (file != nullptr)
+    {
+      fread(state_snapshots, 1, sizeof(state_snapshots), file);
+      fclose(file);
+    }
+  }
+
+  void save_state_snapshots(void)
+  {
+    FILE* file = fopen(CONFIG_MODEL_STATE_FILE, "wb");
+    if (file == nullptr)
+    {
+      ESP_LOGW(TAG, "Cannot write the interpreter state to %s.", CONFIG_MODEL_STATE_FILE);
+      return;
+    }
+    fwrite(state_snapshots, 1, sizeof(state_snapshots), file);
+    fclose(file);
+  }
+#endif
+#endif
+
+  // Inserts every category into the kTopK best ones, sorted by decreasing
+  // score. Ties keep the lowest label first.
+  template <typename T>
+  void select_top_k(const T* scores, uint8_t* labels, T* best)
+  {
+    int filled = 0;
+    for (uint i = 0; i < kCategoryCount; i++)
+    {
+      T score = scores[i];
+      if (filled == kTopK && score <= best[kTopK - 1])
+      {
+        continue;
+      }
+      int k = (filled < kTopK) ? filled++ : kTopK - 1;
+      for (; k > 0 && score > best[k - 1]; k--)
+      {
+        labels[k] = labels[k - 1];
+        best[k] = best[k - 1];
+      }
+      labels[k] = i;
+      best[k] = score;
+    }
+  }
+
+  // Float probabilities are reported on the same scale as the int8 softmax
+  // output: scale 1/256, zero point -128.
+  int8_t quantize_probability(float probability)
+  {
+    int32_t value = static_cast<int32_t>(roundf(probability * 256.0f)) - 128;
+    return static_cast<int8_t>(value < -128 ? -128 : (value > 127 ? 127 : value));
+  }
 }  // namespace
 
 esp_err_t TF_init_status = ESP_FAIL;
 TaskHandle_t tf_xHandle = NULL;
 //static QueueHandle_t  predictionQueue =NULL;
 
-static const char *TAG = "App_TFLite";
-
 esp_err_t app_tflite_init(void)
 {
+#ifdef CONFIG_MODEL_SOURCE_URI
+  // A model rolled out apart from the firmware takes over the linked one,
+  // which is still run if it cannot be opened.
+  static model_source_t source;
+  if (sizeof(CONFIG_MODEL_SOURCE_URI) > 1)
+  {
+    if (model_source_open(CONFIG_MODEL_SOURCE_URI, CONFIG_MODEL_SOURCE_MAX_SIZE, &source) == ESP_OK)
+    {
+      return app_tflite_init_model(&source.entry, TF_MAX_INSTANCES, TF_MAX_BATCH);
+    }
+    ESP_LOGW(TAG, "Cannot open model %s, running the linked one.", CONFIG_MODEL_SOURCE_URI);
+  }
+#endif
+  return app_tflite_init_model(model_registry_default(), TF_MAX_INSTANCES, TF_MAX_BATCH);
+}
+
+esp_err_t app_tflite_init_model(const model_entry_t* entry, int count, int batch)
+{
+  if (entry == nullptr)
+  {
+    ESP_LOGE(TAG, "No model to run.");
+    return ESP_FAIL;
+  }
+  if (count < 1 || count > TF_MAX_INSTANCES)
+  {
+    ESP_LOGE(TAG, "%d interpreters requested, from 1 to %d can run.", count, TF_MAX_INSTANCES);
+    return ESP_FAIL;
+  }
+  if (batch < 1 || batch > TF_MAX_BATCH)
+  {
+    ESP_LOGE(TAG, "Batches of %d images requested, from 1 to %d can run.", batch, TF_MAX_BATCH);
+    return ESP_FAIL;
+  }
+  if (instance_count > 0)
+  {
+    ESP_LOGE(TAG, "The interpreters have already been initialized.");
+    return ESP_FAIL;
+  }
+  model_entry = entry;
+  ESP_LOGI(TAG, "Loading model %s (%u bytes)", entry->name, entry->size);
+
   tflite::InitializeTarget();
 
   // Set up logging. Google style is to avoid globals or statics because of
@@ -68,7 +296,7 @@ esp_err_t app_tflite_init(void)
   
   // Map the model into a usable data structure. This doesn't involve any
   // copying or parsing, it's a very lightweight operation.
-  model = tflite::GetModel(g_model);
+  model = tflite::GetModel(entry->data);
 
   // Check the model to ensure its schema version is compatible with 
   // the version we are using
@@ -88,40 +316,137 @@ esp_err_t app_tflite_init(void)
   // your tf model needs, and include "all_ops_resolver.h"
   // static tflite::AllOpsResolver op_resolver;
   
-  // Pull in only the operation implementations we need.
-  // This relies on a complete list of all the ops needed by this graph.
-  // An easier approach is to just use the AllOpsResolver, but this will
-  // incur some penalty in code space for op implementations that are not
-  // needed by this graph.
-  // If you are using AllOpsResolver above, comment the next lines.
-  #define OPERATIONS_NBR  6
-  static tflite::MicroMutableOpResolver<OPERATIONS_NBR> op_resolver;
-  op_resolver.AddConv2D();
-  op_resolver.AddRelu();
-  op_resolver.AddMaxPool2D();
-  op_resolver.AddReshape();
-  op_resolver.AddFullyConnected();
-  op_resolver.AddSoftmax();
-
-  // Instantiate an interpreter to run the model with.
-  ESP_LOGI(TAG, "Instantiating an interpreter");
-  static tflite::MicroInterpreter static_interpreter(
-      model, op_resolver, tensor_arena, kTensorArenaSize, error_reporter
-  );
-  interpreter = &static_interpreter;
-
-  // Allocate memory from the tensor_arena for the model's tensors.
-  ESP_LOGI(TAG, "Allocating Tensors memory");
-  TfLiteStatus allocate_status = interpreter->AllocateTensors();
-  if (allocate_status != kTfLiteOk) {
-    TF_LITE_REPORT_ERROR(error_reporter, "AllocateTensors() failed");
+  // Pull in only the operation implementations we need, the ones of the
+  // linked models, listed in model_ops.h by host/gen_op_resolver.py.
+  // If you are using AllOpsResolver above, comment the next line.
+  static ModelOpResolver op_resolver;
+
+#ifdef CONFIG_MODEL_STATE_SNAPSHOT
+  const uint64_t state_key = state_snapshot_key(entry);
+#ifndef ESP_PLATFORM
+  load_state_snapshots();
+#endif
+#endif
+
+#ifdef CONFIG_BENCHMARK_ARENA_TUNER
+  // Measures the arena with this target's pointer size, before the
+  // interpreter takes the arena over. The output completes the generated
+  // model_arena.h.
+  arena_tuning_t tuning;
+  if (TuneArena(model, op_resolver, TF_MAX_BATCH, tensor_arena[0], kTensorArenaSize, &tuning) == kTfLiteOk)
+  {
+    printf("#if __SIZEOF_POINTER__ == %d\n", (int) sizeof(void*));
+    PrintArenaTuning(stdout, entry->name, entry->name, &tuning);
+    printf("#endif\n");
+    fflush(stdout);
+  } else {
+    ESP_LOGE(TAG, "The arena could not be tuned, the model does not fit in %d bytes.", kTensorArenaSize);
+  }
+#endif
+
+  // Instantiate the interpreters to run the model with. They share the
+  // model, the op resolver and the error reporter, which are only read.
+  for (int i = 0; i < count; i++)
+  {
+    ESP_LOGI(TAG, "Instantiating interpreter %d", i);
+    tf_instance_t* instance = &instances[i];
+    instance->interpreter = new (interpreter_storage[i]) tflite::MicroInterpreter(
+        model, op_resolver, tensor_arena[i], kTensorArenaSize, error_reporter, (i == 0) ? profiler : nullptr
+    );
+
+    // Allocate memory from the interpreter's slice of the arena for the
+    // model's tensors, batch times the activations.
+    if (instance->interpreter->SetBatchSize(batch) != kTfLiteOk) {
+      TF_LITE_REPORT_ERROR(error_reporter, "SetBatchSize() failed");
+      destroy_instances(i + 1);
+      return ESP_FAIL;
+    }
+#if defined(CONFIG_MODEL_FAST_WEIGHTS_SIZE) && CONFIG_MODEL_FAST_WEIGHTS_SIZE > 0
+    if (instance->interpreter->SetTensorPlacement(&fast_weights_policy, fast_weights[i], kFastWeightsSize) != kTfLiteOk) {
+      TF_LITE_REPORT_ERROR(error_reporter, "SetTensorPlacement() failed");
+      destroy_instances(i + 1);
+      return ESP_FAIL;
+    }
+#endif
+    int64_t prepare_start = esp_timer_get_time();
+#ifdef CONFIG_MODEL_STATE_SNAPSHOT
+    if (instance->interpreter->RestoreState(state_snapshots[i], kStateSnapshotSize, state_key) == kTfLiteOk)
+    {
+      ESP_LOGI(TAG, "Interpreter state restored in %lld us", (long long) (esp_timer_get_time() - prepare_start));
+    } else
+#endif
+    {
+      ESP_LOGI(TAG, "Allocating Tensors memory");
+      TfLiteStatus allocate_status = instance->interpreter->AllocateTensors();
+      if (allocate_status != kTfLiteOk) {
+        TF_LITE_REPORT_ERROR(error_reporter, "AllocateTensors() failed");
+        destroy_instances(i + 1);
+      return ESP_FAIL;
+      }
+      ESP_LOGI(TAG, "Tensors memory allocated successfully");
+#ifdef CONFIG_MODEL_FROZEN_GRAPH
+      if (instance->interpreter->FreezeGraph() != kTfLiteOk) {
+        TF_LITE_REPORT_ERROR(error_reporter, "FreezeGraph() failed");
+        destroy_instances(i + 1);
+      return ESP_FAIL;
+      }
+#endif
+      ESP_LOGI(TAG, "Interpreter prepared in %lld us", (long long) (esp_timer_get_time() - prepare_start));
+#ifdef CONFIG_MODEL_STATE_SNAPSHOT
+      if (instance->interpreter->SaveState(state_snapshots[i], kStateSnapshotSize, state_key) != kTfLiteOk)
+      {
+        ESP_LOGW(TAG, "The interpreter state (%u bytes) does not fit in the snapshot.",
+                 (unsigned) instance->interpreter->SavedStateSize());
+      }
+#endif
+    }
+
+    // Obtain pointers to the model's input tensors.
+    // 0 represents the first (and only) input tensor.
+    instance->input = instance->interpreter->input(0);
+    instance->output = instance->interpreter->output(0);
+  }
+#if defined(CONFIG_MODEL_STATE_SNAPSHOT) && !defined(ESP_PLATFORM)
+  save_state_snapshots();
+#endif
+  // The images are written straight into the input tensor, in whichever
+  // type the model takes, one after the other for a batch. For int8 models
+  // the scale and zero point never change, so the pixel quantization table
+  // only has to be built once. It is the same for every interpreter. The
+  // interpreters are only used once their tensors are checked.
+  const TfLiteTensor* input = instances[0].input;
+  const TfLiteTensor* output = instances[0].output;
+  size_t image_bytes = input->bytes / batch;
+  size_t output_image_bytes = output->bytes / batch;
+  if (input->type == kTfLiteInt8 && image_bytes == kMaxImageSize)
+  {
+    InitImagePreprocessing(IMAGE_INPUT_INT8, input->params.scale, input->params.zero_point);
+  } else if (input->type == kTfLiteFloat32 && image_bytes == kMaxImageSize * sizeof(float)) {
+    InitImagePreprocessing(IMAGE_INPUT_FLOAT32, 1.0f, 0);
+  } else {
+    ESP_LOGE(TAG, "Unsupported input: %s, %u bytes.", TfLiteTypeGetName(input->type), (unsigned) input->bytes);
+    destroy_instances(count);
     return ESP_FAIL;
   }
-  ESP_LOGI(TAG, "Tensors memory allocated successfully");
 
-  // Obtain pointers to the model's input tensors.
-  // 0 represents the first (and only) input tensor.
-  input = interpreter->input(0);
+  if ((output->type != kTfLiteInt8 && output->type != kTfLiteFloat32) 
+      || output_image_bytes != kCategoryCount * (output->type == kTfLiteInt8 ? 1 : sizeof(float)))
+  {
+    ESP_LOGE(TAG, "Unsupported output: %s, %u bytes.", TfLiteTypeGetName(output->type), (unsigned) output->bytes);
+    destroy_instances(count);
+    return ESP_FAIL;
+  }
+
+#ifdef CONFIG_BENCHMARK_OP_PROFILER
+  op_profiler.Reset(instances[0].interpreter->invoked_operators_size());
+#endif
+  const tflite::TensorPlacementStats& placement = instances[0].interpreter->tensor_placement_stats();
+  ESP_LOGI(TAG, "Weights: %u tensors (%u bytes) in RAM, %u (%u bytes) read from the model.",
+           (unsigned) placement.placed_count, (unsigned) placement.placed_bytes,
+           (unsigned) placement.model_count, (unsigned) placement.model_bytes);
+  input_image_bytes = image_bytes;
+  batch_size = batch;
+  instance_count = count;
 
   // This queue will hold the index of Max prediction
   //predictionQueue = xQueueCreate(5, sizeof(const char*));
@@ -137,31 +462,23 @@ void tf_start_inference(void)
     vTaskDelete(NULL);
   }
 
+  // The first interpreter runs the demo loop.
+  tflite::MicroInterpreter* interpreter = instances[0].interpreter;
+  TfLiteTensor* input = instances[0].input;
+  uint32_t image_id = 0;
   while(true)
   {
-    // Get normalized image array from image_provider.
-    float* tmp_buffer = (float*) malloc(kMaxImageSize * sizeof(float));
-    if (tmp_buffer == NULL)
-    {
-        ESP_LOGE(TAG, "Tmp_buffer not allocated.");
-        continue;
-    }
-    ESP_LOGI(TAG, "Loading normalized image array from image_provider.");
-    esp_err_t status = GetImage(kNumCols, kNumRows, kNumChannels, tmp_buffer);
+    // Get the quantized image from image_provider, written directly into
+    // the model's input tensor.
+    ESP_LOGI(TAG, "Loading quantized image %u from image_provider.", (unsigned) image_id);
+    esp_err_t status = GetImage(image_id, kNumCols, kNumRows, kNumChannels, input->data.raw);
+    image_id = (image_id + 1) % kTestImageCount;
     if ( status != ESP_OK) 
     {
       ESP_LOGE(TAG, "Image loading failed.");
       continue;
     }
 
-    for (uint i = 0; i < kMaxImageSize; i++)
-    {
-      // Quantize input : from floating point values to signed 8bit integers
-      input->data.int8[i] = (tmp_buffer[i] / input->params.scale ) + input->params.zero_point;
-    }
-    free(tmp_buffer);
-    tmp_buffer = NULL;
-
     // Run the model on this input and make sure it succeeds.
     ESP_LOGI(TAG, "Invoking interpreter.");
     TfLiteStatus invoke_status = interpreter->Invoke();
@@ -172,13 +489,14 @@ void tf_start_inference(void)
     }
 
     // Obtain pointers to the model's output tensors.
-    output = interpreter->output(0);
+    const TfLiteTensor* output = interpreter->output(0);
 
     float y_pred[kCategoryCount];
-    // Dequantize the output from uint8 to floating-point
+    // Dequantize the output from int8 to floating-point
     for (uint i = 0; i < kCategoryCount; i++)
     {
-      y_pred[i] = (output->data.int8[i] - output->params.zero_point) * output->params.scale;
+      y_pred[i] = (output->type == kTfLiteFloat32) ? output->data.f[i]
+                  : (output->data.int8[i] - output->params.zero_point) * output->params.scale;
     }
 
     uint8_t max_porb_index = 0;
@@ -199,7 +517,91 @@ void tf_start_inference(void)
   }
 }
 
+int tf_instance_count(void)
+{
+  return instance_count;
+}
+
+int tf_batch_size(void)
+{
+  return batch_size;
+}
+
+esp_err_t tf_invoke(int instance, const void* const* images, int count, inference_result_t* const* results)
+{
+  if (TF_init_status != ESP_OK || instance < 0 || instance >= instance_count || count < 1 || count > batch_size)
+  {
+    return ESP_FAIL;
+  }
+  tflite::MicroInterpreter* interpreter = instances[instance].interpreter;
+  TfLiteTensor* input = instances[instance].input;
+
+  // The rest of a partial batch is run on whatever the input holds, and
+  // its results ignored.
+  for (int b = 0; b < count; b++)
+  {
+    memcpy(input->data.uint8 + b * input_image_bytes, images[b], input_image_bytes);
+  }
+
+  int64_t start_time = esp_timer_get_time();
+  if (interpreter->Invoke() != kTfLiteOk)
+  {
+    TF_LITE_REPORT_ERROR(error_reporter, "Interpreter invoke failed.");
+    return ESP_FAIL;
+  }
+  uint32_t invoke_time_us = (uint32_t) (esp_timer_get_time() - start_time) / count;
+
+  // Dequantization preserves ordering, so the most probable categories can
+  // be picked straight from the int8 scores.
+  const TfLiteTensor* output = instances[instance].output;
+  for (int b = 0; b < count; b++)
+  {
+    inference_result_t* result = results[b];
+    result->invoke_time_us = invoke_time_us;
+    if (output->type == kTfLiteInt8)
+    {
+      select_top_k(output->data.int8 + b * kCategoryCount, result->labels, result->scores);
+    } else {
+      float probabilities[kTopK];
+      select_top_k(output->data.f + b * kCategoryCount, result->labels, probabilities);
+      for (int k = 0; k < kTopK; k++)
+      {
+        result->scores[k] = quantize_probability(probabilities[k]);
+      }
+    }
+  }
+
+  return ESP_OK;
+}
+
 void tf_stop_inference(void)
 {
   vTaskDelete(tf_xHandle);
-}
\ No newline at end of file
+}
+
+const model_entry_t* tf_model(void)
+{
+  return model_entry;
+}
+
+size_t tf_arena_used_bytes(void)
+{
+  return (instance_count > 0) ? instances[0].interpreter->arena_used_bytes() : 0;
+}
+
+size_t tf_ram_weights_bytes(void)
+{
+  return (instance_count > 0) ? instances[0].interpreter->tensor_placement_stats().placed_bytes : 0;
+}
+
+size_t tf_model_weights_bytes(void)
+{
+  return (instance_count > 0) ? instances[0].interpreter->tensor_placement_stats().model_bytes : 0;
+}
+
+void tf_print_profile_json(void)
+{
+#ifdef CONFIG_BENCHMARK_OP_PROFILER
+  op_profiler.PrintJson(model_entry ? model_entry->name : nullptr);
+#endif
+}
@@ -0,0 +1,161 @@
+#include <cstdarg>
+#include <cstring>
+
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/recording_micro_interpreter.h"
+
+#include "arena_tuner.h"
+
+namespace {
+  // Most of the trials are expected to run out of memory, their errors are
+  // not worth printing.
+  class SilentErrorReporter : public tflite::ErrorReporter {
+   public:
+    int Report(const char* /*format*/, va_list /*args*/) override { return 0; }
+  };
+
+  SilentErrorReporter silent_error_reporter;
+
+  // Runs the model once on a batch of images in the first arena_size bytes
+  // of arena, as the app does with an arena of that size.
+  bool model_fits(const tflite::Model* model, const tflite::MicroOpResolver& op_resolver,
+                  int batch_size, uint8_t* arena, size_t arena_size, bool invoke)
+  {
+    tflite::MicroInterpreter interpreter(model, op_resolver, arena, arena_size, &silent_error_reporter);
+    // The dispatch table of the frozen graph is always counted, the app
+    // builds it by default.
+    if (interpreter.SetBatchSize(batch_size) != kTfLiteOk || interpreter.AllocateTensors() != kTfLiteOk
+        || interpreter.FreezeGraph() != kTfLiteOk)
+    {
+      return false;
+    }
+    if (!invoke)
+    {
+      return true;
+    }
+    for (size_t i = 0; i < interpreter.inputs_size(); i++)
+    {
+      TfLiteTensor* input = interpreter.input(i);
+      memset(input->data.raw, 0, input->bytes);
+    }
+    return interpreter.Invoke() == kTfLiteOk;
+  }
+
+  // Smallest arena the model runs in with this batch, or 0 if it does not
+  // even fit in arena_size bytes.
+  size_t minimal_arena(const tflite::Model* model, const tflite::MicroOpResolver& op_resolver,
+                       int batch_size, uint8_t* arena, size_t arena_size)
+  {
+    // Invariant: the model does not fit in too_small bytes, and fits in fits.
+    size_t too_small = 0;
+    size_t fits = arena_size;
+    if (!model_fits(model, op_resolver, batch_size, arena, fits, false))
+    {
+      return 0;
+    }
+    while (fits - too_small > 1)
+    {
+      size_t size = too_small + (fits - too_small) / 2;
+      if (model_fits(model, op_resolver, batch_size, arena, size, false))
+      {
+        fits = size;
+      } else {
+        too_small = size;
+      }
+    }
+    // Kernels may only fail at Invoke() if their buffers were not requested
+    // at Prepare(), which would go unnoticed until the first image.
+    return model_fits(model, op_resolver, batch_size, arena, fits, true) ? fits : 0;
+  }
+
+  void print_allocation(FILE* file, const char* prefix, const char* name,
+                        const tflite::RecordedAllocation& allocation, const char* description)
+  {
+    fprintf(file, "#define %s_ARENA_%s %u // %s, %u allocations\n", prefix, name,
+            (unsigned) allocation.used_bytes, description, (unsigned) allocation.count);
+  }
+}  // namespace
+
+TfLiteStatus TuneArena(const tflite::Model* model, const tflite::MicroOpResolver& op_resolver,
+                       int max_batch_size, uint8_t* arena, size_t arena_size, arena_tuning_t* tuning)
+{
+  memset(tuning, 0, sizeof(*tuning));
+  if (reinterpret_cast<uintptr_t>(arena) % ARENA_TUNER_ALIGNMENT != 0 || max_batch_size < 1)
+  {
+    return kTfLiteError;
+  }
+
+  size_t fits = minimal_arena(model, op_resolver, 1, arena, arena_size);
+  if (fits == 0)
+  {
+    return kTfLiteError;
+  }
+  tuning->minimal_size = fits;
+
+  // The activations grow with the batch, but the planner may lay them out
+  // differently for each one: keep the steepest growth from a single image.
+  for (int batch_size = 2; batch_size <= max_batch_size; batch_size++)
+  {
+    size_t batch_fits = minimal_arena(model, op_resolver, batch_size, arena, arena_size);
+    if (batch_fits == 0)
+    {
+      return kTfLiteError;
+    }
+    size_t image_bytes = (batch_fits > fits) ? (batch_fits - fits + batch_size - 2) / (batch_size - 1) : 0;
+    if (image_bytes > tuning->batch_image_bytes)
+    {
+      tuning->batch_image_bytes = image_bytes;
+    }
+  }
+
+  // The breakdown comes from a recording allocator, which is bigger than the
+  // one the app uses. It is left out if the arena has no room for it.
+  {
+    tflite::RecordingMicroInterpreter interpreter(model, op_resolver, arena, arena_size, &silent_error_reporter);
+    if (interpreter.AllocateTensors() == kTfLiteOk)
+    {
+      const tflite::RecordingMicroAllocator& allocator = interpreter.GetMicroAllocator();
+      tuning->tensor_data_bytes = allocator.GetSimpleMemoryAllocator()->GetHeadUsedBytes();
+      tuning->eval_tensors = allocator.GetRecordedAllocation(tflite::RecordedAllocationType::kTfLiteEvalTensorData);
+      tuning->persistent_tensors = allocator.GetRecordedAllocation(tflite::RecordedAllocationType::kPersistentTfLiteTensorData);
+      tuning->quantization_data = allocator.GetRecordedAllocation(tflite::RecordedAllocationType::kPersistentTfLiteTensorQuantizationData);
+      tuning->persistent_buffers = allocator.GetRecordedAllocation(tflite::RecordedAllocationType::kPersistentBufferData);
+      tuning->variable_buffers = allocator.GetRecordedAllocation(tflite::RecordedAllocationType::kTfLiteTensorVariableBufferData);
+      tuning->node_and_registrations = allocator.GetRecordedAllocation(tflite::RecordedAllocationType::kNodeAndRegistrationArray);
+    }
+  }
+
+  size_t accounted = tuning->tensor_data_bytes + tuning->eval_tensors.used_bytes
+      + tuning->persistent_tensors.used_bytes + tuning->quantization_data.used_bytes
+      + tuning->persistent_buffers.used_bytes + tuning->variable_buffers.used_bytes
+      + tuning->node_and_registrations.used_bytes;
+  tuning->other_bytes = (fits > accounted) ? fits - accounted : 0;
+  return kTfLiteOk;
+}
+
+void PrintArenaTuning(FILE* file, const char* name, const char* source,
+                      const arena_tuning_t* tuning)
+{
+  char prefix[48] = "MODEL_";
+  size_t length = strlen(prefix);
+  for (; *name != '\0' && length < sizeof(prefix) - 1; name++)
+  {
+    prefix[length++] = (*name >= 'a' && *name <= 'z') ? *name - 'a' + 'A' : *name;
+  }
+  prefix[length] = '\0';
+
+  fprintf(file, "// %s\n", source);
+  fprintf(file, "#define %s_ARENA_SIZE %u\n", prefix, (unsigned) tuning->minimal_size);
+  fprintf(file, "#define %s_ARENA_TENSOR_DATA %u // tensor data and scratch buffers, at the head\n",
+          prefix, (unsigned) tuning->tensor_data_bytes);
+  print_allocation(file, prefix, "EVAL_TENSORS", tuning->eval_tensors, "TfLiteEvalTensor structs");
+  print_allocation(file, prefix, "PERSISTENT_TENSORS", tuning->persistent_tensors, "persistent TfLiteTensor structs");
+  print_allocation(file, prefix, "QUANTIZATION_DATA", tuning->quantization_data, "their quantization parameters");
+  print_allocation(file, prefix, "PERSISTENT_BUFFERS", tuning->persistent_buffers, "kernels' persistent buffers");
+  print_allocation(file, prefix, "VARIABLE_BUFFERS", tuning->variable_buffers, "variable tensors");
+  print_allocation(file, prefix, "NODE_AND_REGISTRATIONS", tuning->node_and_registrations, "NodeAndRegistration structs");
+  fprintf(file, "#define %s_ARENA_OTHER %u // allocator and alignment padding\n", prefix, (unsigned) tuning->other_bytes);
+  fprintf(file, "#define %s_ARENA_BATCH_IMAGE %u // more per image of a batch, after the first\n",
+          prefix, (unsigned) tuning->batch_image_bytes);
+}
@@ -0,0 +1,84 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "esp_log.h"
+
+#include "frame_pool.h"
+
+static const char *TAG = "Frame_Pool";
+
+#if (FRAME_POOL_SIZE & (FRAME_POOL_SIZE - 1)) != 0
+#error "FRAME_POOL_SIZE must be a power of two"
+#endif
+
+static frame_t frames[FRAME_POOL_SIZE];
+
+// Single-producer / single-consumer ring of free frames. head is only
+// written by the acquiring task and tail by the releasing one, both count up
+// forever and are wrapped into the ring when indexing.
+static frame_t* free_frames[FRAME_POOL_SIZE];
+static atomic_uint head;
+static atomic_uint tail;
+
+// Whether each frame is leased: set when it is acquired and cleared when it
+// is released, so that a frame released twice is caught whether or not the
+// ring is full. Kept apart from frame_t, whose header is plain C for C++.
+static atomic_bool leased[FRAME_POOL_SIZE];
+
+void frame_pool_init(void)
+{
+    for (int i = 0; i < FRAME_POOL_SIZE; i++)
+    {
+        free_frames[i] = &frames[i];
+        atomic_store(&leased[i], false);
+    }
+    atomic_store(&head, 0);
+    atomic_store(&tail, FRAME_POOL_SIZE);
+}
+
+frame_t* frame_pool_acquire(void)
+{
+    unsigned int current_head = atomic_load_explicit(&head, memory_order_relaxed);
+    // Pairs with the release in frame_pool_release() so the frame pointer
+    // written before tail moved is visible here.
+    unsigned int current_tail = atomic_load_explicit(&tail, memory_order_acquire);
+    if (current_head == current_tail)
+    {
+        return NULL;
+    }
+
+    frame_t* frame = free_frames[current_head % FRAME_POOL_SIZE];
+    atomic_store_explicit(&leased[frame - frames], true, memory_order_relaxed);
+    atomic_store_explicit(&head, current_head + 1, memory_order_release);
+    return frame;
+}
+
+bool frame_pool_release(frame_t* frame)
+{
+    if (frame < &frames[0] || frame >= &frames[FRAME_POOL_SIZE] || frame != &frames[frame - frames])
+    {
+        ESP_LOGE(TAG, "Released frame %p does not belong to the pool.", frame);
+        return false;
+    }
+
+    // Only the release that clears the lease puts the frame back, a second
+    // one finds it cleared.
+    bool was_leased = true;
+    if (!atomic_compare_exchange_strong_explicit(&leased[frame - frames], &was_leased, false,
+                                                 memory_order_relaxed, memory_order_relaxed))
+    {
+        ESP_LOGE(TAG, "Frame %p released twice.", frame);
+        return false;
+    }
+
+    unsigned int current_tail = atomic_load_explicit(&tail, memory_order_relaxed);
+    free_frames[current_tail % FRAME_POOL_SIZE] = frame;
+    atomic_store_explicit(&tail, current_tail + 1, memory_order_release);
+    return true;
+}
+
+uint32_t frame_pool_available(void)
+{
+    return atomic_load(&tail) - atomic_load(&head);
+}
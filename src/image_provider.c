@@ -16,6 +16,7 @@ limitations under the License.
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #include "esp_system.h"
 
@@ -29,30 +30,76 @@ static const char *TAG = "Image_Provider";
 
 static float get_normalised_value(uint8_t intval);
 
-static void normalise_image_buffer(float* dest_image_buffer, uint8_t* imageBuffer, uint size)
+// Maps every possible pixel value straight to its quantized int8 value, so
+// preparing the input tensor is a single table lookup per pixel.
+static int8_t quantization_lookup[256];
+static image_input_type_t image_input_type = IMAGE_INPUT_INT8;
+
+// Raw 8-bit frame, decoded into by the HTTP client as the image arrives.
+static uint8_t image_buffer[kMaxImageSize];
+
+void InitImagePreprocessing(image_input_type_t input_type, float scale, int32_t zero_point)
+{
+  image_input_type = input_type;
+  if (input_type != IMAGE_INPUT_INT8)
+  {
+    return;
+  }
+
+  for (int i = 0; i < 256; i++)
+  {
+    int32_t value = (int32_t) roundf(get_normalised_value((uint8_t) i) / scale) + zero_point;
+    if (value < INT8_MIN) value = INT8_MIN;
+    if (value > INT8_MAX) value = INT8_MAX;
+    quantization_lookup[i] = (int8_t) value;
+  }
+}
+
+static void quantize_image_buffer(int8_t* dest_image_buffer, const uint8_t* imageBuffer, uint size)
 {
   for (uint i = 0; i < size; i++)
+  {
+    dest_image_buffer[i] = quantization_lookup[imageBuffer[i]];
+  }
+}
+
+// Walks the image backwards, so that a float never overwrites a pixel that
+// has not been read yet when converting in place.
+static void normalise_image_buffer(float* dest_image_buffer, const uint8_t* imageBuffer, uint size)
+{
+  for (uint i = size; i-- > 0; )
   {
     dest_image_buffer[i] = get_normalised_value(imageBuffer[i]);
   }
 }
 
-esp_err_t GetImage(uint8_t image_width, uint8_t image_height, uint8_t channels, float* image_data)
+esp_err_t PreprocessImage(const uint8_t* image, void* image_data)
+{
+  if (image_input_type == IMAGE_INPUT_FLOAT32)
+  {
+    normalise_image_buffer((float*) image_data, image, kMaxImageSize);
+  } else {
+    quantize_image_buffer((int8_t*) image_data, image, kMaxImageSize);
+  }
+
+  return ESP_OK;
+}
+
+esp_err_t GetImage(uint32_t image_id, uint8_t image_width, uint8_t image_height, uint8_t channels, void* image_data)
 { 
-  uint8_t* array_buffer = (uint8_t*) malloc(kMaxImageSize * sizeof(uint8_t));
+  if (image_width != kNumCols || image_height != kNumRows || channels != kNumChannels)
+  {
+    ESP_LOGE(TAG, "Only %dx%dx%d images are served.", kNumCols, kNumRows, kNumChannels);
+    return ESP_ERR_INVALID_SIZE;
+  }
 
-  if (array_buffer == NULL) 
+  esp_err_t status = httpClient_getImage(image_id, image_buffer);
+  if (status != ESP_OK)
   {
-	ESP_LOGE(TAG, "Array_buffer was not allocated.");
-	return ESP_FAIL;
+    return status;
   }
 
-  normalise_image_buffer(image_data, array_buffer, kMaxImageSize);
-  
-  free(array_buffer);
-  array_buffer = NULL;
-  
-  return ESP_OK;
+  return PreprocessImage(image_buffer, image_data);
 }
 
 // This is to ease the load on ESP's since each pixel value needs to be normalised, a lookup table will speed things up. 
@@ -60,7 +107,6 @@ esp_err_t GetImage(uint8_t image_width, uint8_t image_height, uint8_t channels,
 
 static float get_normalised_value(uint8_t intval)
 {
-	if (intval > 255) return 0.0;
 	static const float lookup[256] = {
 	0.000000 ,	0.003922 ,	0.007843 ,	0.011765 ,	0.015686 ,	0.019608 ,	0.023529 ,	0.027451 ,	
 	0.031373 ,	0.035294 ,	0.039216 ,	0.043137 ,	0.047059 ,	0.050980 ,	0.054902 ,	0.058824 ,	
@@ -0,0 +1,96 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "latency_stats.h"
+
+#define LATENCY_STATS_MAX_US    ((1u << LATENCY_STATS_MAX_BITS) - 1)
+
+static uint32_t bucket_index(uint32_t value_us)
+{
+    if (value_us < LATENCY_STATS_SUB_BUCKETS)
+    {
+        return value_us;
+    }
+    if (value_us > LATENCY_STATS_MAX_US)
+    {
+        value_us = LATENCY_STATS_MAX_US;
+    }
+    // The top LATENCY_STATS_SUB_BUCKET_BITS bits under the leading one
+    // select the bucket within its power of two.
+    uint32_t msb = 31 - __builtin_clz(value_us);
+    uint32_t shift = msb - LATENCY_STATS_SUB_BUCKET_BITS;
+    return (shift + 1) * LATENCY_STATS_SUB_BUCKETS + ((value_us >> shift) & (LATENCY_STATS_SUB_BUCKETS - 1));
+}
+
+// Middle of the range of values counted by a bucket.
+static uint32_t bucket_value(uint32_t index)
+{
+    if (index < LATENCY_STATS_SUB_BUCKETS)
+    {
+        return index;
+    }
+    uint32_t shift = index / LATENCY_STATS_SUB_BUCKETS - 1;
+    uint32_t lowest = (LATENCY_STATS_SUB_BUCKETS + index % LATENCY_STATS_SUB_BUCKETS) << shift;
+    return lowest + ((1u << shift) >> 1);
+}
+
+void latency_stats_reset(latency_stats_t* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+void latency_stats_record(latency_stats_t* stats, uint32_t value_us, uint32_t count)
+{
+    stats->buckets[bucket_index(value_us)] += count;
+    stats->count += count;
+    stats->total_us += (uint64_t) value_us * count;
+    if (value_us > stats->max_us)
+    {
+        stats->max_us = value_us;
+    }
+}
+
+uint32_t latency_stats_percentile(const latency_stats_t* stats, float percentile)
+{
+    if (stats->count == 0)
+    {
+        return 0;
+    }
+
+    // Rank of the sample, counted from 1, the percentile falls on.
+    uint32_t rank = (uint32_t) (percentile / 100.0f * stats->count + 0.5f);
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+    uint32_t seen = 0;
+    for (uint32_t i = 0; i < LATENCY_STATS_BUCKETS; i++)
+    {
+        seen += stats->buckets[i];
+        if (seen >= rank)
+        {
+            uint32_t value = bucket_value(i);
+            return (value < stats->max_us) ? value : stats->max_us;
+        }
+    }
+    return stats->max_us;
+}
+
+uint32_t latency_stats_mean(const latency_stats_t* stats)
+{
+    return (stats->count > 0) ? (uint32_t) (stats->total_us / stats->count) : 0;
+}
+
+void latency_stats_merge(latency_stats_t* into, const latency_stats_t* stats)
+{
+    for (uint32_t i = 0; i < LATENCY_STATS_BUCKETS; i++)
+    {
+        into->buckets[i] += stats->buckets[i];
+    }
+    into->count += stats->count;
+    into->total_us += stats->total_us;
+    if (stats->max_us > into->max_us)
+    {
+        into->max_us = stats->max_us;
+    }
+}
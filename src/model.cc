@@ -10,7 +10,7 @@
 const unsigned int g_model_len = 23264;
 
 // Keep model aligned to 8 bytes to guarantee aligned 64-bit accesses.
-const unsigned char g_model[] = {
+alignas(8) const unsigned char g_model[] = {
   0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
   0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
   0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
@@ -0,0 +1,7153 @@
+// Automatically created from a TensorFlow Lite flatbuffer using the command:
+// xxd -i model_q_aware.tflite > model_q_aware.cc
+
+// This is a standard TensorFlow Lite model file that has been converted into a
+// C data array, so it can be easily compiled into a binary for devices that
+// don't have a file system.
+
+#include "model.h"
+
+const unsigned int g_model_q_aware_len = 85664;
+
+// Keep model aligned to 8 bytes to guarantee aligned 64-bit accesses.
+alignas(8) const unsigned char g_model_q_aware[] = {
+  0x24, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1c, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x4d, 0x01, 0x00,
+  0xc4, 0x41, 0x01, 0x00, 0xac, 0x41, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x65, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
+  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x71, 0x75, 0x61, 0x6e,
+  0x74, 0x5f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x2a, 0xbe, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x31, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x17, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f,
+  0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73,
+  0x69, 0x6f, 0x6e, 0x00, 0x18, 0x00, 0x00, 0x00, 0xd8, 0x40, 0x01, 0x00,
+  0xc4, 0x40, 0x01, 0x00, 0x88, 0x40, 0x01, 0x00, 0x44, 0x40, 0x01, 0x00,
+  0x20, 0x40, 0x01, 0x00, 0x2c, 0x03, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00,
+  0x5c, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x6c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd6, 0xbe, 0xfe, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
+  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbc, 0xb3, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcc, 0xb3, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xb3, 0xfe, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xec, 0xb3, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfc, 0xb3, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xb4, 0xfe, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0xb4, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0xb4, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xb4, 0xfe, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4c, 0xb4, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5c, 0xb4, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xb4, 0xfe, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7c, 0xb4, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8c, 0xb4, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xb4, 0xfe, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xac, 0xb4, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xbf, 0xfe, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x24, 0x13, 0x4e, 0xbe,
+  0xee, 0x76, 0x11, 0x3d, 0xa8, 0xd4, 0x35, 0x3e, 0x47, 0xe4, 0xbb, 0xbe,
+  0xe8, 0xf3, 0x41, 0x3d, 0x77, 0xdc, 0xb8, 0x3e, 0xfe, 0x6f, 0xc0, 0x3e,
+  0xca, 0xa5, 0xa3, 0x3e, 0xd8, 0xcc, 0x32, 0x3e, 0x86, 0x30, 0x86, 0x3c,
+  0xa3, 0x06, 0xd5, 0x3e, 0x06, 0xb4, 0xd6, 0x3b, 0xd8, 0x61, 0xa4, 0x3e,
+  0xe9, 0x27, 0x35, 0x3e, 0x19, 0xcd, 0xb1, 0x3e, 0x8d, 0x8a, 0x71, 0xbd,
+  0xca, 0x48, 0x49, 0x3e, 0x38, 0xac, 0x9d, 0x3e, 0x2c, 0x1a, 0xd2, 0x3d,
+  0x67, 0xba, 0x93, 0x3e, 0x17, 0x7f, 0xf9, 0xbd, 0x6d, 0xef, 0x9b, 0x3e,
+  0x2d, 0xe1, 0x89, 0x3e, 0xb7, 0x67, 0xbe, 0x3d, 0x00, 0x72, 0x10, 0xbe,
+  0xac, 0x36, 0x76, 0x3e, 0xf8, 0x75, 0xd0, 0x3e, 0x85, 0x0b, 0x84, 0x3e,
+  0xee, 0x5c, 0x35, 0x3e, 0x03, 0xba, 0x3b, 0x3e, 0x8e, 0xe8, 0x3e, 0x3e,
+  0xac, 0xa2, 0x4b, 0x3c, 0x37, 0x74, 0xa5, 0x3e, 0x34, 0xf4, 0xb6, 0x3e,
+  0x75, 0x0b, 0xca, 0x3e, 0xb4, 0xa2, 0xcb, 0x3c, 0xa9, 0xe3, 0xa9, 0x3e,
+  0x80, 0xef, 0x2e, 0xbd, 0xa9, 0xe3, 0xa9, 0xbe, 0x88, 0x9f, 0xd5, 0x3e,
+  0x8b, 0x58, 0xb7, 0x3e, 0xd3, 0x1e, 0xc3, 0xbd, 0xa5, 0x7a, 0x21, 0xbc,
+  0xe4, 0xf9, 0x8e, 0x3e, 0xec, 0xf0, 0xd3, 0x3e, 0x5b, 0xec, 0xa9, 0x3d,
+  0x1d, 0x19, 0xd8, 0x3e, 0xa7, 0x4f, 0xb1, 0x3c, 0x09, 0x89, 0xa2, 0x3d,
+  0x6a, 0x91, 0xea, 0x3e, 0x9f, 0xa3, 0x5d, 0xbd, 0xe1, 0x30, 0xfb, 0x3d,
+  0xcb, 0xb5, 0xd0, 0x3e, 0xb4, 0x3a, 0xa6, 0x3e, 0x21, 0x25, 0x63, 0x3e,
+  0x8d, 0x3f, 0x2e, 0x3e, 0xeb, 0x21, 0x8f, 0x3e, 0xc7, 0x95, 0xc5, 0x3e,
+  0xc9, 0xe8, 0x08, 0x3d, 0xbf, 0x79, 0x50, 0x3e, 0x12, 0xed, 0xf8, 0x3d,
+  0x0b, 0x5b, 0x95, 0x3d, 0x33, 0xb0, 0x90, 0x3e, 0xa2, 0x56, 0x68, 0x3e,
+  0x92, 0xf4, 0x73, 0x3d, 0x2e, 0x67, 0x0b, 0x3e, 0x26, 0x36, 0x91, 0x3d,
+  0x34, 0x67, 0x0b, 0x3c, 0x2a, 0x6b, 0xb8, 0x3e, 0x2a, 0x6b, 0xb8, 0x3e,
+  0x0a, 0xa3, 0x22, 0xbd, 0x92, 0xf4, 0x73, 0x3d, 0x56, 0xc9, 0x91, 0x3e,
+  0xbf, 0xc4, 0x83, 0x3e, 0x56, 0xc9, 0x11, 0x3f, 0x36, 0x00, 0x9d, 0x3e,
+  0x36, 0x00, 0x9d, 0x3d, 0x92, 0x12, 0x55, 0x3e, 0x07, 0xf7, 0x00, 0xbf,
+  0x5a, 0x99, 0x1b, 0xbf, 0x18, 0x07, 0x32, 0xbf, 0x1e, 0xc6, 0xca, 0xbe,
+  0xcf, 0x64, 0x6d, 0xbd, 0x6b, 0x27, 0xa8, 0x3e, 0x7f, 0x73, 0x2b, 0x3d,
+  0x41, 0x5e, 0xd1, 0x3e, 0xfc, 0x2d, 0xc4, 0x3e, 0x15, 0xab, 0x97, 0x3e,
+  0x26, 0xf7, 0x1a, 0x3e, 0xad, 0xe2, 0x83, 0xbe, 0xfd, 0x6c, 0xa0, 0xbe,
+  0xba, 0x1d, 0xb3, 0xbe, 0x35, 0xa1, 0x69, 0xbe, 0x75, 0xce, 0xc5, 0x3e,
+  0xec, 0x0d, 0x5a, 0x3e, 0x87, 0x71, 0x2e, 0x3d, 0x58, 0xa3, 0x98, 0x3e,
+  0x73, 0xac, 0xb4, 0x3e, 0xfc, 0x6c, 0xa0, 0x3e, 0xa3, 0x18, 0x4d, 0x3f,
+  0xea, 0x08, 0x5b, 0xbf, 0x73, 0xf2, 0xee, 0xbe, 0x41, 0x67, 0x07, 0xbf,
+  0xba, 0xe2, 0x7c, 0xbf, 0x45, 0x5e, 0x0f, 0x3f, 0xde, 0x23, 0x43, 0xbf,
+  0x45, 0x5e, 0x8f, 0x3e, 0x97, 0x33, 0x35, 0x3f, 0x00, 0x00, 0x00, 0x00,
+  0xb6, 0xc1, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0xe0, 0x3c, 0x01, 0x00,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xbd, 0xb1, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbf, 0x7c, 0x45, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xe3, 0x5d, 0x80, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbf, 0x7c, 0x45, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x6a, 0xfd, 0x9d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x66, 0xfd, 0x9d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x12, 0xbd, 0x31, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xba, 0x3d, 0x8a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xe6, 0x5d, 0x80, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x66, 0xfd, 0x9d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xea, 0x9c, 0xbb, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x12, 0xbd, 0x31, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x44, 0x1c, 0xe3, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xea, 0x9c, 0xbb, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x3d, 0x8a, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xe3, 0x5d, 0x80, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x16, 0xbd, 0xb1, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x52, 0xed, 0x22, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0xb0, 0xb5, 0x8c, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0x52, 0xed, 0x22, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x19, 0xfc, 0x6c, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x66, 0xfd, 0x9d, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x40, 0xdd, 0xa7, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xed, 0x9c, 0xbb, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xea, 0x9c, 0xbb, 0xbd,
+  0x70, 0x3c, 0xd9, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x16, 0xbd, 0xb1, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x47, 0x1c, 0xe3, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xe4, 0x5d, 0x00, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0x3c, 0x59, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x66, 0xfd, 0x9d, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x3d, 0x8a, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x97, 0x5c, 0xcf, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x19, 0xfc, 0x6c, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x9a, 0x5c, 0xcf, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xbd, 0xb1, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0xcf, 0x4d, 0x05, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x9a, 0x5c, 0xcf, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x00, 0xad, 0x36, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xe6, 0x5d, 0x80, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x7c, 0x0d, 0x19, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x01, 0xad, 0x36, 0x3e,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xc1, 0x7c, 0x45, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x14, 0xbd, 0x31, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0x72, 0x3c, 0x59, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xea, 0x9c, 0xbb, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x72, 0x3c, 0x59, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6e, 0x3c, 0xd9, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x70, 0x3c, 0xd9, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xba, 0x3d, 0x0a, 0xbe,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x66, 0xfd, 0x9d, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xea, 0x9c, 0xbb, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b, 0x97, 0x5c, 0xcf, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xc5, 0x7c, 0x45, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0xcf, 0x4d, 0x05, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x52, 0xed, 0x22, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xed, 0x9c, 0xbb, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x91, 0x1d, 0x14, 0xbe,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0xc5, 0x7c, 0x45, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x14, 0xbd, 0x31, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x29, 0xcd, 0x2c, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x18, 0xbd, 0x31, 0x3d,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0x1b, 0xfc, 0x6c, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x06, 0xec, 0x71, 0xbe, 0x30, 0x0c, 0x68, 0xbe,
+  0x3e, 0xdd, 0x27, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x1e, 0xfc, 0xec, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0xe3, 0x5d, 0x80, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xd6, 0x8c, 0x40, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe3, 0x5d, 0x80, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x40, 0xdd, 0xa7, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xe4, 0x5d, 0x00, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x19, 0xfc, 0x6c, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x40, 0xdd, 0xa7, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0xe4, 0x5d, 0x00, 0xbe,
+  0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x70, 0x3c, 0xd9, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x1a, 0xfc, 0xec, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xe6, 0x5d, 0x80, 0x3d, 0xba, 0x3d, 0x8a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x67, 0xfd, 0x1d, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x14, 0xbd, 0x31, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0x91, 0x1d, 0x94, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x40, 0xdd, 0xa7, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xcf, 0x4d, 0x85, 0xbe,
+  0x19, 0xfc, 0x6c, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x54, 0xed, 0x22, 0x3e,
+  0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0xed, 0x9c, 0xbb, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xed, 0x9c, 0xbb, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xcf, 0x4d, 0x05, 0xbe, 0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0xe4, 0x5d, 0x00, 0xbe,
+  0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0xc5, 0x7c, 0x45, 0x3d,
+  0x52, 0xed, 0x22, 0xbe, 0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x3e, 0xdd, 0x27, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x93, 0x1d, 0x94, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0xba, 0x3d, 0x0a, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x68, 0xfd, 0x9d, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x1e, 0xfc, 0xec, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0xe5, 0x5d, 0x00, 0x3e,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xd8, 0x8c, 0x40, 0x3e,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x72, 0x3c, 0x59, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xed, 0x9c, 0xbb, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x97, 0x5c, 0xcf, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x97, 0x5c, 0xcf, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xeb, 0x9c, 0x3b, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xba, 0x3d, 0x8a, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x7c, 0x0d, 0x19, 0xbe,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0x14, 0xbd, 0xb1, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0xed, 0x9c, 0xbb, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x12, 0xbd, 0x31, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x72, 0x3c, 0x59, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbf, 0x7c, 0x45, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0xbf, 0x7c, 0x45, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0xba, 0x3d, 0x8a, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x74, 0xfd, 0x1d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x91, 0x1d, 0x14, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xba, 0x3d, 0x0a, 0xbe,
+  0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0xeb, 0x9c, 0x3b, 0xbe,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xbd, 0xb1, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x40, 0xdd, 0xa7, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0x1e, 0xfc, 0xec, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x90, 0x1d, 0x94, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x65, 0xfd, 0x1d, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x12, 0xbd, 0x31, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x52, 0xed, 0x22, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x40, 0xdd, 0xa7, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xed, 0x9c, 0xbb, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc4, 0x7c, 0xc5, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x44, 0x1c, 0xe3, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xba, 0x3d, 0x8a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x6c, 0x3c, 0x59, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xba, 0x3d, 0x8a, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x52, 0xed, 0x22, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32,
+  0x97, 0x5c, 0xcf, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0xac, 0x6c, 0x4a, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0x98, 0x5c, 0x4f, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0xac, 0x6c, 0x4a, 0xbe, 0x80, 0xfd, 0x9d, 0x3b,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xcf, 0x4d, 0x05, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x14, 0xbd, 0x31, 0xbe, 0x83, 0x4c, 0x54, 0xbe, 0xba, 0x3d, 0x8a, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x52, 0xed, 0x22, 0xbe, 0x91, 0x1d, 0x14, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x7c, 0x0d, 0x19, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x90, 0x1d, 0x94, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc5, 0xc5, 0x87, 0xbe, 0xe4, 0x5d, 0x80, 0xbe, 0x50, 0xfd, 0x9d, 0xbb,
+  0x52, 0xed, 0x22, 0xbe, 0x52, 0xed, 0x22, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xf2, 0xdb, 0x76, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xea, 0x9c, 0xbb, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0xe3, 0x5d, 0x80, 0xbd,
+  0xeb, 0x9c, 0x3b, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xc1, 0x7c, 0x45, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x52, 0xed, 0x22, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x62, 0xfd, 0x9d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x93, 0x1d, 0x94, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x7e, 0x0d, 0x19, 0x3e,
+  0x16, 0xbd, 0xb1, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x66, 0xfd, 0x9d, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xbd, 0xb1, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xd0, 0x4d, 0x05, 0x3e,
+  0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x70, 0x3c, 0xd9, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x14, 0xbd, 0xb1, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xd0, 0x4d, 0x05, 0x3e,
+  0x14, 0xbd, 0xb1, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x22, 0xfc, 0xec, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xba, 0x3d, 0x0a, 0xbe, 0xe3, 0x5d, 0x80, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x1b, 0xfc, 0x6c, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0x98, 0x5c, 0x4f, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x18, 0xbd, 0x31, 0x3d,
+  0x00, 0xad, 0x36, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x52, 0xed, 0x22, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x30, 0x0c, 0x68, 0xbe, 0x6e, 0x3c, 0x59, 0xbe, 0x93, 0x1d, 0x94, 0x3d,
+  0x98, 0x5c, 0x4f, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x1e, 0xfc, 0xec, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc, 0x29, 0xcd, 0x2c, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x1e, 0xfc, 0xec, 0x3d,
+  0x29, 0xcd, 0x2c, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0x97, 0x5c, 0xcf, 0xbd, 0xed, 0x9c, 0xbb, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x69, 0xfd, 0x1d, 0x3e,
+  0xbc, 0x3d, 0x0a, 0x3e, 0x00, 0x00, 0x40, 0x32, 0x22, 0xfc, 0xec, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x19, 0xfc, 0x6c, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x93, 0x1d, 0x94, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xd0, 0x4d, 0x05, 0x3e,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xed, 0x9c, 0xbb, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0x01, 0xad, 0x36, 0x3e,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xe6, 0x5d, 0x80, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x2a, 0xcd, 0x2c, 0x3e,
+  0x72, 0x3c, 0x59, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0xed, 0x9c, 0xbb, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x47, 0x1c, 0xe3, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x84, 0x4c, 0x54, 0x3e,
+  0x70, 0x3c, 0xd9, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x16, 0xbd, 0xb1, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x90, 0x1d, 0x94, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x16, 0xfc, 0xec, 0xbc, 0x7c, 0x0d, 0x19, 0xbe, 0xe3, 0x5d, 0x80, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0x3c, 0xd9, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x1e, 0xfc, 0xec, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x91, 0x1d, 0x14, 0xbe, 0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x97, 0x5c, 0xcf, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xda, 0xd5, 0x82, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x14, 0xbd, 0xb1, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x12, 0xbd, 0x31, 0xbd, 0xe4, 0x5d, 0x80, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x98, 0x5c, 0x4f, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0xae, 0x6c, 0x4a, 0x3e,
+  0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xcf, 0x4d, 0x05, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x47, 0x1c, 0xe3, 0x3d,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x44, 0x1c, 0xe3, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc4, 0x7c, 0xc5, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x97, 0x5c, 0xcf, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xe3, 0x5d, 0x80, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x66, 0xfd, 0x9d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x30, 0x0c, 0x68, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xba, 0x3d, 0x8a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0xbb, 0x3d, 0x8a, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x50, 0xfd, 0x9d, 0xbb, 0xe4, 0x5d, 0x00, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x87, 0x95, 0x96, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x29, 0xcd, 0x2c, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0x3e, 0xdd, 0x27, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x7c, 0x0d, 0x19, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xac, 0x6c, 0x4a, 0xbe, 0xd6, 0x8c, 0x40, 0xbe, 0x00, 0xad, 0x36, 0xbe,
+  0x1b, 0xfc, 0x6c, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0x1b, 0xfc, 0x6c, 0xbe,
+  0xcf, 0x4d, 0x05, 0xbe, 0xf2, 0xdb, 0x76, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x9c, 0xa5, 0x91, 0xbe, 0xc5, 0xc5, 0x87, 0xbe, 0x22, 0xfc, 0xec, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xed, 0x9c, 0xbb, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x9a, 0x5c, 0xcf, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0xd0, 0x4d, 0x05, 0x3e,
+  0x62, 0xfd, 0x9d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x97, 0x5c, 0xcf, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x90, 0x1d, 0x94, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32,
+  0x90, 0x1d, 0x94, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x66, 0xfd, 0x9d, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x7c, 0x0d, 0x19, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xd6, 0x8c, 0x40, 0xbe,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x7e, 0x0d, 0x19, 0x3e, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x98, 0x5c, 0x4f, 0xbe,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x70, 0x3c, 0xd9, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x40, 0xdd, 0xa7, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x29, 0xcd, 0x2c, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x80, 0xfd, 0x9d, 0x3b, 0xa6, 0x2d, 0x8f, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x14, 0xbd, 0xb1, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x67, 0xfd, 0x1d, 0xbe,
+  0x91, 0x1d, 0x14, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbb, 0x3d, 0x8a, 0xbe, 0x45, 0x1c, 0x63, 0xbe,
+  0xbb, 0x3d, 0x8a, 0xbe, 0x83, 0x4c, 0x54, 0xbe, 0x83, 0x4c, 0x54, 0xbe,
+  0x9c, 0xa5, 0x91, 0xbe, 0x87, 0x95, 0x96, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0xda, 0xd5, 0x82, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x10, 0xfc, 0x6c, 0xbc,
+  0x1e, 0xfc, 0xec, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x19, 0xfc, 0x6c, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6a, 0xfd, 0x9d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x70, 0x3c, 0xd9, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x70, 0x3c, 0xd9, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x90, 0x1d, 0x94, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x97, 0x5c, 0xcf, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xe3, 0x5d, 0x80, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x12, 0xbd, 0x31, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x47, 0x1c, 0xe3, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xe4, 0x5d, 0x00, 0xbe,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x54, 0xed, 0x22, 0x3e, 0x72, 0x3c, 0x59, 0x3d,
+  0xbc, 0x3d, 0x0a, 0x3e, 0xc4, 0x7c, 0xc5, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x93, 0x1d, 0x94, 0x3d, 0x34, 0x55, 0xaa, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xc5, 0x7c, 0x45, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x1a, 0xfc, 0xec, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6c, 0x3c, 0x59, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x44, 0x1c, 0xe3, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0x6c, 0x3c, 0x59, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0xcf, 0x4d, 0x05, 0xbe, 0xd6, 0x8c, 0x40, 0xbe, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x70, 0x3c, 0xd9, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x7c, 0x0d, 0x19, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x1a, 0xfc, 0xec, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x18, 0xbd, 0x31, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x6c, 0x3c, 0x59, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x14, 0xbd, 0x31, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x3e, 0xdd, 0x27, 0xbe,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe4, 0x5d, 0x00, 0xbe, 0xae, 0x6c, 0x4a, 0x3e,
+  0x1e, 0xfc, 0xec, 0x3d, 0xe5, 0x5d, 0x00, 0x3e, 0x16, 0xbd, 0xb1, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x16, 0xbd, 0xb1, 0x3d,
+  0xe5, 0x5d, 0x00, 0x3e, 0x6e, 0xfd, 0x9d, 0x3c, 0x7c, 0x0d, 0x19, 0xbe,
+  0x72, 0x3c, 0x59, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xbd, 0xb1, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x7e, 0x0d, 0x19, 0x3e, 0xe5, 0x5d, 0x00, 0x3e, 0xd0, 0x4d, 0x05, 0x3e,
+  0x40, 0xdd, 0xa7, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0x30, 0x0c, 0x68, 0xbe,
+  0x91, 0x1d, 0x14, 0xbe, 0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xc1, 0x7c, 0x45, 0xbe, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x90, 0x1d, 0x94, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x1a, 0xfc, 0xec, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x00, 0x00, 0x40, 0x32, 0xe3, 0x5d, 0x80, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x91, 0x1d, 0x14, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0x93, 0x1d, 0x94, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x7e, 0x0d, 0x19, 0x3e,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0x44, 0x1c, 0xe3, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x66, 0xfd, 0x9d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x62, 0xfd, 0x9d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0xdd, 0xcb, 0x7b, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0xe4, 0x5d, 0x00, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x72, 0x3c, 0x59, 0x3d, 0x91, 0x1d, 0x14, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0xe3, 0x5d, 0x80, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xf4, 0xdb, 0xf6, 0x3d, 0x92, 0x1d, 0x14, 0x3e, 0x54, 0xed, 0x22, 0x3e,
+  0xc5, 0x7c, 0x45, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0xea, 0x9c, 0xbb, 0xbd,
+  0x16, 0xbd, 0xb1, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x00, 0xad, 0x36, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xbd, 0xb1, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x98, 0x5c, 0x4f, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x00, 0xad, 0x36, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x44, 0x1c, 0xe3, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0xc1, 0x7c, 0x45, 0xbe,
+  0x3e, 0xdd, 0x27, 0xbe, 0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x66, 0xfd, 0x9d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xac, 0x6c, 0x4a, 0xbe, 0xe4, 0x5d, 0x80, 0xbe, 0x87, 0x95, 0x96, 0xbe,
+  0xb0, 0xb5, 0x8c, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0x06, 0xec, 0x71, 0xbe,
+  0x98, 0x5c, 0x4f, 0xbe, 0xac, 0x6c, 0x4a, 0xbe, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x1b, 0xfc, 0x6c, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0xe3, 0x5d, 0x80, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x29, 0xcd, 0x2c, 0xbe, 0x6c, 0x3c, 0x59, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x6e, 0x3c, 0x59, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0x67, 0xfd, 0x1d, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0x66, 0xfd, 0x9d, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x97, 0x5c, 0xcf, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x66, 0xfd, 0x9d, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xac, 0x6c, 0x4a, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x3e, 0xdd, 0x27, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x29, 0xcd, 0x2c, 0xbe,
+  0x22, 0xfc, 0xec, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x29, 0xcd, 0x2c, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x52, 0xed, 0x22, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd, 0xed, 0x9c, 0xbb, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xf2, 0xdb, 0x76, 0xbe,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xc5, 0x7c, 0x45, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x40, 0xdd, 0xa7, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x40, 0xdd, 0xa7, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x19, 0xfc, 0x6c, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x1e, 0xfc, 0xec, 0x3d, 0xba, 0x3d, 0x8a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x6c, 0x3c, 0x59, 0xbd, 0xc4, 0x7c, 0xc5, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x91, 0x1d, 0x14, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x66, 0xfd, 0x9d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x3f, 0xdd, 0x27, 0x3e,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x93, 0x1d, 0x94, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0xea, 0x9c, 0xbb, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x40, 0xdd, 0xa7, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x97, 0x5c, 0xcf, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x72, 0x3c, 0x59, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x16, 0xfc, 0xec, 0xbc, 0xac, 0x6c, 0x4a, 0xbe,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x6e, 0x3c, 0x59, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xe5, 0x5d, 0x00, 0x3e,
+  0x16, 0xbd, 0xb1, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0xed, 0x9c, 0xbb, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xc5, 0x7c, 0x45, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xe6, 0x5d, 0x80, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x54, 0xed, 0x22, 0x3e,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x3e, 0xdd, 0x27, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd, 0x72, 0x85, 0x9b, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xe6, 0x5d, 0x80, 0x3d, 0xd6, 0x8c, 0x40, 0xbe,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x70, 0x3c, 0xd9, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x72, 0x3c, 0x59, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xe5, 0x5d, 0x00, 0x3e, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x1e, 0xfc, 0xec, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x40, 0xdd, 0xa7, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xe5, 0x5d, 0x00, 0x3e,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0xba, 0x3d, 0x8a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0xe5, 0x5d, 0x00, 0x3e,
+  0x72, 0x3c, 0x59, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x72, 0x3c, 0x59, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xed, 0x9c, 0xbb, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x14, 0xbd, 0xb1, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xe5, 0x5d, 0x00, 0x3e,
+  0x00, 0x00, 0x40, 0x32, 0x22, 0xfc, 0xec, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x47, 0x1c, 0xe3, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0xf4, 0xdb, 0xf6, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0x54, 0xed, 0x22, 0x3e,
+  0x16, 0xfc, 0xec, 0xbc, 0x14, 0xbd, 0x31, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xbd, 0xb1, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x52, 0xed, 0x22, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x10, 0xfc, 0x6c, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0x31, 0xbe, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x14, 0xbd, 0x31, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x12, 0xbd, 0x31, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x00, 0xad, 0x36, 0xbe, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x97, 0x5c, 0xcf, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0xad, 0x36, 0xbe, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x14, 0xbd, 0x31, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x52, 0xed, 0x22, 0xbe, 0x52, 0xed, 0x22, 0xbe, 0x22, 0xfc, 0xec, 0x3c,
+  0xeb, 0x9c, 0x3b, 0xbe, 0xc1, 0x7c, 0x45, 0xbe, 0x91, 0x1d, 0x14, 0xbe,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x7c, 0x0d, 0x19, 0xbe, 0x52, 0xed, 0x22, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x06, 0xec, 0x71, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x22, 0xfc, 0xec, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x00, 0xad, 0x36, 0xbe, 0x67, 0xfd, 0x1d, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xeb, 0x9c, 0x3b, 0xbe, 0x3e, 0xdd, 0x27, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xcf, 0x4d, 0x85, 0xbe, 0x74, 0xfd, 0x1d, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xea, 0x9c, 0xbb, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x91, 0x1d, 0x14, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x22, 0xfc, 0xec, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0x90, 0x1d, 0x94, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x66, 0xfd, 0x9d, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xbc, 0x3d, 0x0a, 0x3e, 0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xe6, 0x5d, 0x80, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x40, 0xdd, 0xa7, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xbd, 0xb1, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x40, 0xdd, 0xa7, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0xe6, 0x5d, 0x80, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x90, 0x1d, 0x94, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6a, 0xfd, 0x9d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x50, 0xfd, 0x9d, 0xbb,
+  0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x93, 0x1d, 0x94, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xea, 0x9c, 0xbb, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xea, 0x9c, 0xbb, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x1e, 0xfc, 0xec, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x72, 0x3c, 0x59, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0xd0, 0x4d, 0x05, 0x3e,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x97, 0x5c, 0xcf, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x9a, 0x5c, 0xcf, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xea, 0x9c, 0xbb, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xf2, 0xdb, 0x76, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd, 0xd6, 0x8c, 0x40, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x14, 0xbd, 0x31, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0xea, 0x9c, 0xbb, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xba, 0x3d, 0x8a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xf1, 0xdb, 0xf6, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xe3, 0x5d, 0x80, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xea, 0x9c, 0xbb, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0xba, 0x3d, 0x8a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x66, 0xfd, 0x9d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xba, 0x3d, 0x8a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x54, 0xed, 0x22, 0x3e,
+  0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xed, 0x9c, 0xbb, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x91, 0x1d, 0x14, 0xbe,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x00, 0x00, 0x40, 0x32, 0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0xeb, 0x9c, 0xbb, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x3e, 0xdd, 0xa7, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x5d, 0x75, 0xa0, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x90, 0x1d, 0x94, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xc1, 0x7c, 0x45, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0xf2, 0xdb, 0x76, 0xbe, 0xc1, 0x7c, 0x45, 0xbe, 0x50, 0xfd, 0x9d, 0xbb,
+  0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x12, 0xbd, 0x31, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x16, 0xfc, 0xec, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xbd, 0xb1, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x0a, 0xbe,
+  0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x30, 0x0c, 0x68, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xac, 0x6c, 0x4a, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x1a, 0xfc, 0xec, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x52, 0xed, 0x22, 0xbe,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x90, 0x1d, 0x94, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0xba, 0x3d, 0x8a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x00, 0xad, 0x36, 0xbe, 0x91, 0x1d, 0x94, 0xbe, 0xf2, 0xdb, 0x76, 0xbe,
+  0xc5, 0xc5, 0x87, 0xbe, 0x3e, 0xdd, 0x27, 0xbe, 0x83, 0x4c, 0x54, 0xbe,
+  0xc5, 0xc5, 0x87, 0xbe, 0x6e, 0x3c, 0x59, 0xbe, 0x3e, 0xdd, 0x27, 0xbe,
+  0x9c, 0xa5, 0x91, 0xbe, 0xb0, 0xb5, 0x8c, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc5, 0x7c, 0x45, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x1f, 0xfc, 0x6c, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x40, 0xdd, 0xa7, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xbd, 0xb1, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x70, 0x3c, 0xd9, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x92, 0x1d, 0x14, 0x3e,
+  0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xd0, 0x4d, 0x05, 0x3e,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x14, 0xbd, 0x31, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0xed, 0x9c, 0xbb, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x44, 0x1c, 0xe3, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x65, 0xfd, 0x1d, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xea, 0x9c, 0xbb, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc, 0xec, 0x9c, 0x3b, 0x3e,
+  0x22, 0xfc, 0xec, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0xde, 0xcb, 0x7b, 0x3e,
+  0x12, 0xbd, 0x31, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xe4, 0x5d, 0x00, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x2a, 0xcd, 0x2c, 0x3e,
+  0x97, 0x5c, 0xcf, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xea, 0x9c, 0xbb, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x67, 0xfd, 0x1d, 0xbe, 0x19, 0xfc, 0x6c, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x98, 0x5c, 0x4f, 0xbe, 0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x74, 0xfd, 0x1d, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xbf, 0x7c, 0x45, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xba, 0x3d, 0x8a, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x2a, 0xcd, 0x2c, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x54, 0xed, 0x22, 0x3e,
+  0xc5, 0x7c, 0x45, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x3f, 0xdd, 0x27, 0x3e,
+  0x22, 0xfc, 0xec, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xf4, 0xdb, 0xf6, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0xea, 0x9c, 0xbb, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x97, 0x5c, 0xcf, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xbd, 0x31, 0x3e,
+  0xe6, 0x5d, 0x80, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x0a, 0xbe, 0x44, 0x1c, 0xe3, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0x08, 0xec, 0x71, 0x3e,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xbd, 0xb1, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x18, 0xbd, 0x31, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x66, 0xfd, 0x9d, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0x70, 0x3c, 0x59, 0x3e,
+  0xed, 0x9c, 0xbb, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x66, 0xfd, 0x9d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x2a, 0xcd, 0x2c, 0x3e,
+  0xec, 0x9c, 0x3b, 0x3e, 0xbc, 0x3d, 0x0a, 0x3e, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e, 0x01, 0xad, 0x36, 0x3e,
+  0x70, 0x3c, 0xd9, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x16, 0xbd, 0x31, 0x3e, 0xf4, 0xdb, 0xf6, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x47, 0x1c, 0xe3, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xbd, 0xb1, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x40, 0xdd, 0xa7, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x2a, 0xcd, 0x2c, 0x3e,
+  0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x16, 0xbd, 0xb1, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xd0, 0x4d, 0x05, 0x3e,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xed, 0x9c, 0xbb, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x22, 0xfc, 0xec, 0x3c,
+  0xbc, 0x3d, 0x0a, 0x3e, 0x22, 0xfc, 0xec, 0x3c, 0x5b, 0x2c, 0x5e, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xbd, 0xb1, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x3f, 0xdd, 0x27, 0x3e,
+  0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xe5, 0x5d, 0x00, 0x3e,
+  0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x18, 0xbd, 0x31, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xbd, 0xb1, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x47, 0x1c, 0xe3, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xa7, 0x2d, 0x0f, 0x3e, 0xd0, 0x4d, 0x05, 0x3e, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x7e, 0x0d, 0x19, 0x3e, 0xbc, 0x3d, 0x0a, 0x3e, 0xd8, 0x8c, 0x40, 0x3e,
+  0x54, 0xed, 0x22, 0x3e, 0x6a, 0xfd, 0x9d, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0xec, 0x9c, 0x3b, 0x3e, 0xec, 0x9c, 0x3b, 0x3e, 0x18, 0xbd, 0x31, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0xed, 0x9c, 0xbb, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c, 0x40, 0xdd, 0xa7, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x40, 0xdd, 0xa7, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x54, 0xed, 0x22, 0x3e,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0xec, 0x9c, 0x3b, 0x3e,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xbd, 0xb1, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x99, 0x5c, 0x4f, 0x3e,
+  0x18, 0xbd, 0x31, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x40, 0xdd, 0xa7, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xec, 0x9c, 0x3b, 0x3e,
+  0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xbd, 0xb1, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbf, 0x7c, 0x45, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0xed, 0x9c, 0xbb, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd, 0xed, 0x9c, 0xbb, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xbd, 0xb1, 0x3d, 0x66, 0xfd, 0x9d, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x72, 0x3c, 0x59, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x7e, 0x0d, 0x19, 0x3e,
+  0xc5, 0x7c, 0x45, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xe5, 0x5d, 0x00, 0x3e,
+  0x70, 0x3c, 0xd9, 0x3d, 0xd8, 0x8c, 0x40, 0x3e, 0xae, 0x6c, 0x4a, 0x3e,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e,
+  0xed, 0x9c, 0xbb, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x5b, 0x2c, 0x5e, 0x3e, 0x1e, 0xfc, 0xec, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x74, 0xfd, 0x1d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xbd, 0xb1, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x16, 0xbd, 0xb1, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x72, 0x3c, 0x59, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0x93, 0x1d, 0x94, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x69, 0xfd, 0x1d, 0x3e,
+  0x16, 0xfc, 0xec, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xe4, 0x5d, 0x00, 0xbe,
+  0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xe6, 0x5d, 0x80, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x22, 0xfc, 0xec, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x54, 0xed, 0x22, 0x3e, 0xc5, 0x7c, 0x45, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x00, 0x00, 0x40, 0x32, 0x9a, 0x5c, 0xcf, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x50, 0xfd, 0x9d, 0xbb, 0x93, 0x1d, 0x94, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0xe6, 0x5d, 0x80, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x93, 0x1d, 0x94, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xbd, 0xb1, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x16, 0xbd, 0xb1, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x19, 0xfc, 0x6c, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6b, 0xfd, 0x1d, 0x3d, 0xba, 0x3d, 0x0a, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x16, 0xbd, 0xb1, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xc1, 0x7c, 0x45, 0xbe,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x92, 0x1d, 0x14, 0x3e, 0x14, 0xbd, 0xb1, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x72, 0x3c, 0x59, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x47, 0x1c, 0xe3, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x93, 0x1d, 0x94, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x52, 0xed, 0x22, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x7c, 0x0d, 0x19, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xba, 0x3d, 0x0a, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x52, 0xed, 0x22, 0xbe,
+  0xc5, 0x7c, 0x45, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb,
+  0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x5a, 0x2c, 0x5e, 0xbe,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x14, 0xbd, 0x31, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xbd, 0xb1, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x5a, 0x2c, 0x5e, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xea, 0x9c, 0xbb, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x83, 0x4c, 0x54, 0xbe,
+  0x3e, 0xdd, 0x27, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0xc1, 0x7c, 0x45, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x1a, 0xfc, 0xec, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0xba, 0x3d, 0x8a, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0xbf, 0x7c, 0x45, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x1a, 0xfc, 0xec, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x97, 0x5c, 0xcf, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xba, 0x3d, 0x8a, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x74, 0xfd, 0x1d, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x14, 0xbd, 0x31, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x29, 0xcd, 0x2c, 0xbe, 0x52, 0xed, 0x22, 0xbe, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x66, 0xfd, 0x9d, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0xe5, 0x5d, 0x00, 0x3e,
+  0x40, 0xdd, 0xa7, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x44, 0x1c, 0xe3, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0xed, 0x9c, 0xbb, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xbd, 0xb1, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6b, 0xfd, 0x1d, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6c, 0x3c, 0x59, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x52, 0xed, 0x22, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0x66, 0xfd, 0x9d, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x70, 0x3c, 0xd9, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x93, 0x1d, 0x94, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x44, 0x1c, 0xe3, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc, 0xcf, 0x4d, 0x05, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x00, 0xad, 0x36, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x3e, 0xdd, 0x27, 0xbe,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xcf, 0x4d, 0x05, 0xbe, 0x91, 0x1d, 0x14, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x1b, 0xfc, 0x6c, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x3e, 0xdd, 0x27, 0xbe, 0x7c, 0x0d, 0x19, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0xe3, 0x5d, 0x80, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x47, 0x1c, 0xe3, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xf4, 0xdb, 0xf6, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb,
+  0x18, 0xbd, 0x31, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e,
+  0xe6, 0x5d, 0x80, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0xec, 0x9c, 0x3b, 0x3e,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d, 0xc1, 0x7c, 0x45, 0xbe,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x9c, 0xa5, 0x91, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0xa6, 0x2d, 0x8f, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x0a, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x68, 0xfd, 0x9d, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc5, 0x7c, 0x45, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x7c, 0x0d, 0x99, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x97, 0x5c, 0xcf, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x91, 0x1d, 0x14, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xe6, 0x5d, 0x80, 0x3d, 0x92, 0x1d, 0x14, 0x3e,
+  0xed, 0x9c, 0xbb, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b,
+  0x72, 0x3c, 0x59, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xe6, 0x5d, 0x80, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x92, 0x1d, 0x14, 0x3e,
+  0x93, 0x1d, 0x94, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x66, 0xfd, 0x9d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0xf4, 0xdb, 0xf6, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xea, 0x9c, 0xbb, 0xbd,
+  0x93, 0x1d, 0x94, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c,
+  0x40, 0xdd, 0xa7, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0x6c, 0x3c, 0x59, 0xbd,
+  0xe4, 0x5d, 0x80, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x16, 0xbd, 0xb1, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xea, 0x9c, 0xbb, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x1d, 0xfc, 0x6c, 0x3e,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xea, 0x9c, 0xbb, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x1d, 0xfc, 0x6c, 0x3e,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xd0, 0x4d, 0x05, 0x3e,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0x01, 0xad, 0x36, 0x3e,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xda, 0xd5, 0x82, 0x3e,
+  0xe5, 0x5d, 0x00, 0x3e, 0x22, 0xfc, 0xec, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xa7, 0x2d, 0x0f, 0x3e, 0x50, 0xfd, 0x9d, 0xbb, 0x70, 0x3c, 0x59, 0x3e,
+  0x40, 0xdd, 0xa7, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xd8, 0x8c, 0x40, 0x3e,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xbf, 0x7c, 0x45, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x84, 0x4c, 0x54, 0x3e,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x40, 0xdd, 0xa7, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xba, 0x3d, 0x0a, 0xbe, 0xf2, 0xdb, 0x76, 0xbe, 0x06, 0xec, 0x71, 0xbe,
+  0x5a, 0x2c, 0x5e, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0x29, 0xcd, 0x2c, 0xbe,
+  0xc1, 0x7c, 0x45, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0xac, 0x6c, 0x4a, 0xbe,
+  0x5a, 0x2c, 0x5e, 0xbe, 0x6e, 0x3c, 0x59, 0xbe, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x16, 0xbd, 0xb1, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x70, 0x3c, 0xd9, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x08, 0xec, 0x71, 0x3e,
+  0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x73, 0x85, 0x9b, 0x3e,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0xe5, 0x5d, 0x80, 0x3e,
+  0xe6, 0x5d, 0x80, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x69, 0xfd, 0x1d, 0x3e,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x3d, 0x8a, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x70, 0x3c, 0xd9, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x44, 0x1c, 0xe3, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xea, 0x9c, 0xbb, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x14, 0xbd, 0x31, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x29, 0xcd, 0x2c, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc, 0x47, 0x1c, 0xe3, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x90, 0x1d, 0x94, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x18, 0xbd, 0x31, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x16, 0xfc, 0xec, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x44, 0x1c, 0xe3, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x74, 0xfd, 0x1d, 0x3c, 0xea, 0x9c, 0xbb, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xf1, 0xdb, 0xf6, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x1f, 0xfc, 0x6c, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x66, 0xfd, 0x9d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x52, 0xed, 0x22, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x97, 0x5c, 0xcf, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x83, 0x4c, 0x54, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x93, 0x1d, 0x94, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xb7, 0xf4, 0xc7, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x62, 0xfd, 0x9d, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x11, 0x74, 0xef, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0x19, 0xfc, 0x6c, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xcf, 0x4d, 0x05, 0xbe, 0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0x3c, 0x59, 0xbe,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xed, 0x9c, 0xbb, 0x3d, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x45, 0x1c, 0x63, 0xbe,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x7c, 0x0d, 0x19, 0xbe,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x40, 0xdd, 0xa7, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x14, 0xbd, 0xb1, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xe5, 0x5d, 0x00, 0x3e, 0xc4, 0x7c, 0xc5, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xe5, 0x5d, 0x00, 0x3e, 0x93, 0x1d, 0x94, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x72, 0x3c, 0x59, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xc1, 0x7c, 0x45, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x87, 0x95, 0x96, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x91, 0x1d, 0x14, 0xbe, 0x6e, 0xfd, 0x9d, 0x3c, 0x34, 0x55, 0xaa, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc, 0x91, 0x1d, 0x14, 0xbe,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x1e, 0xfc, 0xec, 0x3d, 0x14, 0xbd, 0x31, 0xbe,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x52, 0xed, 0x22, 0xbe,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x1a, 0xfc, 0xec, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xe4, 0x5d, 0x00, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xf2, 0xdb, 0x76, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0x6c, 0x3c, 0x59, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xd0, 0x4d, 0x05, 0x3e, 0x1e, 0xfc, 0xec, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xed, 0x9c, 0xbb, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6a, 0xfd, 0x9d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc5, 0x7c, 0x45, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x98, 0x5c, 0x4f, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xe6, 0x5d, 0x80, 0x3d, 0xd6, 0x8c, 0x40, 0xbe,
+  0x28, 0xfc, 0x6c, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xe3, 0x5d, 0x80, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xe4, 0x5d, 0x00, 0xbe,
+  0x40, 0xdd, 0xa7, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x30, 0x0c, 0x68, 0xbe,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b,
+  0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x67, 0xfd, 0x1d, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0x87, 0x95, 0x96, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x6c, 0x3c, 0x59, 0xbd,
+  0x93, 0x1d, 0x94, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x18, 0xbd, 0x31, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x1f, 0xfc, 0x6c, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x72, 0x3c, 0x59, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x14, 0xbd, 0xb1, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32, 0xe5, 0x5d, 0x00, 0x3e,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x1a, 0xfc, 0xec, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xe4, 0x5d, 0x00, 0xbe, 0xd6, 0x8c, 0x40, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x29, 0xcd, 0x2c, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x52, 0xed, 0x22, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x3e, 0xdd, 0x27, 0xbe,
+  0x00, 0xad, 0x36, 0xbe, 0x14, 0xbd, 0x31, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x40, 0xdd, 0xa7, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xd0, 0x4d, 0x05, 0x3e,
+  0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x12, 0xbd, 0x31, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x50, 0xfd, 0x9d, 0xbb, 0xba, 0x3d, 0x8a, 0xbd, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x14, 0xbd, 0xb1, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x90, 0x1d, 0x94, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbf, 0x7c, 0x45, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0xc1, 0x7c, 0x45, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd, 0xed, 0x9c, 0xbb, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x1e, 0xfc, 0xec, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x70, 0x3c, 0xd9, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0xba, 0x3d, 0x8a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x40, 0xdd, 0xa7, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xd0, 0x4d, 0x05, 0x3e, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc5, 0x7c, 0x45, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xbc, 0x3d, 0x0a, 0x3e, 0x6a, 0xfd, 0x9d, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x1a, 0xfc, 0xec, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x14, 0xbd, 0xb1, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xc1, 0x7c, 0x45, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x12, 0xbd, 0x31, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xe3, 0x5d, 0x80, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x1a, 0xfc, 0xec, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x10, 0xfc, 0x6c, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0xea, 0x9c, 0xbb, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0xd6, 0x8c, 0x40, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xeb, 0x9c, 0x3b, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x52, 0xed, 0x22, 0xbe, 0x14, 0xbd, 0x31, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x45, 0x1c, 0x63, 0xbe, 0x14, 0xbd, 0x31, 0xbe, 0xd6, 0x8c, 0x40, 0xbe,
+  0x00, 0xad, 0x36, 0xbe, 0x7c, 0x0d, 0x19, 0xbe, 0x10, 0xfc, 0x6c, 0xbc,
+  0xeb, 0x9c, 0x3b, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x50, 0xfd, 0x9d, 0xbb,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0x52, 0xed, 0x22, 0xbe,
+  0x6e, 0x3c, 0x59, 0xbe, 0x3e, 0xdd, 0x27, 0xbe, 0x91, 0x1d, 0x14, 0xbe,
+  0x5a, 0x2c, 0x5e, 0xbe, 0xc5, 0xc5, 0x87, 0xbe, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x91, 0x1d, 0x94, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xd6, 0x8c, 0x40, 0xbe, 0xac, 0x6c, 0x4a, 0xbe, 0x29, 0xcd, 0x2c, 0xbe,
+  0xac, 0x6c, 0x4a, 0xbe, 0xd6, 0x8c, 0x40, 0xbe, 0x67, 0xfd, 0x1d, 0xbe,
+  0x83, 0x4c, 0x54, 0xbe, 0x14, 0xbd, 0x31, 0xbe, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x00, 0xad, 0x36, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x62, 0xfd, 0x9d, 0xbc,
+  0x67, 0xfd, 0x1d, 0xbe, 0xd6, 0x8c, 0x40, 0xbe, 0x44, 0x1c, 0xe3, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0x91, 0x1d, 0x14, 0xbe,
+  0x98, 0x5c, 0x4f, 0xbe, 0x3e, 0xdd, 0x27, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xd6, 0x8c, 0x40, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x10, 0xfc, 0x6c, 0xbc,
+  0xeb, 0x9c, 0x3b, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x6e, 0x3c, 0x59, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x52, 0xed, 0x22, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0xba, 0x3d, 0x8a, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x19, 0xfc, 0x6c, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xc1, 0x7c, 0x45, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x45, 0x1c, 0x63, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xf2, 0xdb, 0x76, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x3e, 0xdd, 0x27, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x7c, 0x0d, 0x19, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xb8, 0x3d, 0x0a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x72, 0x3c, 0x59, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xba, 0x3d, 0x8a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xea, 0x9c, 0xbb, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xd6, 0x8c, 0x40, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xbf, 0x7c, 0x45, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x92, 0x1d, 0x14, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x72, 0x3c, 0x59, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x22, 0xfc, 0xec, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6a, 0xfd, 0x9d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x3d, 0x8a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb,
+  0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x93, 0x1d, 0x94, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x66, 0xfd, 0x9d, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xbc, 0x3d, 0x0a, 0x3e,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0x06, 0xec, 0x71, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xf3, 0xdb, 0x76, 0x3e,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xb1, 0xb5, 0x8c, 0x3e,
+  0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xbf, 0x7c, 0x45, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x1a, 0xfc, 0xec, 0xbd, 0x3f, 0xdd, 0xa7, 0x3e,
+  0x50, 0xfd, 0x9d, 0xbb, 0xba, 0x3d, 0x8a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0xa7, 0x2d, 0x8f, 0x3e,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x47, 0x1c, 0xe3, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x92, 0x1d, 0x94, 0x3e,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x9a, 0x5c, 0xcf, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x93, 0x1d, 0x94, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x53, 0xed, 0xa2, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x14, 0xbd, 0xb1, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x1a, 0xfc, 0xec, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x91, 0x1d, 0x94, 0xbe,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x66, 0xfd, 0x9d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0x0a, 0x35, 0xb4, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0x9c, 0xa5, 0x91, 0x3e,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x90, 0x1d, 0x94, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x87, 0x95, 0x96, 0xbe,
+  0x22, 0xfc, 0xec, 0x3c, 0x44, 0x1c, 0xe3, 0xbd, 0x88, 0x95, 0x96, 0x3e,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x18, 0xbd, 0x31, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x93, 0x1d, 0x94, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x92, 0x1d, 0x94, 0x3e,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x97, 0x5c, 0xcf, 0xbd, 0x69, 0xfd, 0x1d, 0x3e,
+  0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x7e, 0x0d, 0x19, 0x3e,
+  0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0xe3, 0x5d, 0x80, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x7c, 0x0d, 0x19, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xc1, 0x7c, 0x45, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x40, 0xdd, 0xa7, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x00, 0xad, 0x36, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0xe5, 0x5d, 0x00, 0x3e,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x83, 0x4c, 0x54, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x98, 0x5c, 0x4f, 0xbe, 0xe6, 0x5d, 0x80, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x15, 0xbd, 0xb1, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0x46, 0x1c, 0x63, 0x3e,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xb0, 0xb5, 0x8c, 0xbe,
+  0x22, 0xfc, 0xec, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x47, 0x1c, 0xe3, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x91, 0x1d, 0x14, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xde, 0xcb, 0x7b, 0x3e,
+  0xba, 0x3d, 0x8a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x65, 0xfd, 0x1d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x44, 0x1c, 0xe3, 0xbd, 0x16, 0xbd, 0x31, 0x3e,
+  0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0xcf, 0x4d, 0x05, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x14, 0xbd, 0xb1, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xcf, 0x4d, 0x05, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x22, 0xfc, 0xec, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0xe4, 0x5d, 0x00, 0xbe,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x40, 0xdd, 0xa7, 0x3d, 0xe5, 0x5d, 0x00, 0x3e, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x52, 0xed, 0x22, 0xbe,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x40, 0xdd, 0xa7, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x44, 0x1c, 0xe3, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xec, 0x9c, 0x3b, 0x3e,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x34, 0x55, 0xaa, 0xbe,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x16, 0xfc, 0xec, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x0a, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x18, 0xbd, 0x31, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0xc3, 0x7c, 0x45, 0x3e,
+  0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe4, 0x5d, 0x00, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0xe3, 0x5d, 0x80, 0xbd,
+  0x52, 0xed, 0x22, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x10, 0xfc, 0x6c, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0x19, 0xfc, 0x6c, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x14, 0xbd, 0xb1, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xed, 0x9c, 0xbb, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xbf, 0x7c, 0x45, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0x3e, 0xdd, 0x27, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0xba, 0x3d, 0x0a, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x40, 0xdd, 0xa7, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x93, 0x1d, 0x94, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x97, 0x5c, 0xcf, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x3e, 0xdd, 0x27, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0x3e, 0xdd, 0x27, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x62, 0xfd, 0x9d, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x66, 0xfd, 0x9d, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x67, 0xfd, 0x1d, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb, 0x72, 0x3c, 0x59, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x19, 0xfc, 0x6c, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x1e, 0xfc, 0xec, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x40, 0xdd, 0xa7, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x3d, 0x8a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0xed, 0x9c, 0xbb, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0xed, 0x9c, 0xbb, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x92, 0x1d, 0x14, 0x3e, 0x47, 0x1c, 0xe3, 0x3d, 0x29, 0xcd, 0x2c, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xbd, 0xb1, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x3d, 0x8a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0xf4, 0xdb, 0xf6, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x93, 0x1d, 0x94, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x90, 0x1d, 0x94, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x66, 0xfd, 0x9d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc5, 0x7c, 0x45, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x22, 0xfc, 0xec, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x40, 0xdd, 0xa7, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x83, 0x4c, 0x54, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x90, 0x1d, 0x94, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x93, 0x1d, 0x94, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0x3c, 0xd9, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x67, 0xfd, 0x1d, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x19, 0xfc, 0x6c, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x90, 0x1d, 0x94, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xec, 0x9c, 0x3b, 0x3e,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe4, 0x5d, 0x00, 0xbe, 0x50, 0xfd, 0x9d, 0xbb,
+  0xba, 0x3d, 0x8a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x19, 0xfc, 0x6c, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x19, 0xfc, 0x6c, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x91, 0x1d, 0x14, 0xbe, 0x19, 0xfc, 0x6c, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xe3, 0x5d, 0x80, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x44, 0x1c, 0xe3, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x1a, 0xfc, 0xec, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x14, 0xbd, 0xb1, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x62, 0xfd, 0x9d, 0xbc, 0x1a, 0xfc, 0xec, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x3d, 0xdd, 0xa7, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x14, 0xbd, 0x31, 0xbe,
+  0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x92, 0x1d, 0x14, 0x3e,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x83, 0x4c, 0x54, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0x3c, 0xd9, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x66, 0xfd, 0x9d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x45, 0x1c, 0x63, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x14, 0xbd, 0x31, 0xbe,
+  0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x97, 0x5c, 0xcf, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x18, 0xbd, 0x31, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x18, 0xbd, 0x31, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x44, 0x1c, 0xe3, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x1f, 0xfc, 0x6c, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x14, 0xbd, 0xb1, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbf, 0x7c, 0x45, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x14, 0xbd, 0x31, 0xbe, 0x16, 0xfc, 0xec, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x83, 0x4c, 0x54, 0xbe, 0x16, 0xfc, 0xec, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xcf, 0x4d, 0x85, 0xbe, 0x6c, 0x3c, 0x59, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x10, 0xfc, 0x6c, 0xbc, 0xcf, 0x4d, 0x05, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x34, 0x55, 0xaa, 0xbe, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb0, 0xb5, 0x8c, 0xbe, 0x50, 0xfd, 0x9d, 0xbb,
+  0x29, 0xcd, 0x2c, 0xbe, 0x16, 0xfc, 0xec, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xe4, 0x5d, 0x00, 0xbe, 0x72, 0x85, 0x9b, 0xbe, 0x18, 0xbd, 0x31, 0x3d,
+  0x00, 0xad, 0x36, 0xbe, 0xcf, 0x4d, 0x05, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x68, 0xfd, 0x9d, 0xbe, 0x47, 0x1c, 0xe3, 0x3d,
+  0x97, 0x5c, 0xcf, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x00, 0xad, 0x36, 0xbe, 0x70, 0x3c, 0xd9, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x1a, 0xfc, 0xec, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x16, 0xbd, 0xb1, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x16, 0xbd, 0xb1, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xbc, 0x3d, 0x0a, 0x3e, 0x9a, 0x5c, 0xcf, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xd0, 0x4d, 0x05, 0x3e,
+  0xed, 0x9c, 0xbb, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e, 0x16, 0xbd, 0xb1, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x1a, 0xfc, 0xec, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0x10, 0xfc, 0x6c, 0xbc, 0x92, 0x1d, 0x14, 0x3e,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b,
+  0x90, 0x1d, 0x94, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x18, 0xbd, 0x31, 0x3d,
+  0x5a, 0x2c, 0x5e, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x14, 0xbd, 0xb1, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x29, 0xcd, 0x2c, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xba, 0x3d, 0x8a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x65, 0xfd, 0x1d, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xd0, 0x4d, 0x05, 0x3e,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x47, 0x1c, 0xe3, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xa6, 0x2d, 0x0f, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x1a, 0xfc, 0xec, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x47, 0x1c, 0xe3, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x47, 0x1c, 0xe3, 0x3d,
+  0x1a, 0xfc, 0xec, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d,
+  0xd0, 0x4d, 0x05, 0x3e, 0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x40, 0xdd, 0xa7, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x50, 0xfd, 0x9d, 0xbb,
+  0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x7e, 0x0d, 0x19, 0x3e,
+  0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xba, 0x3d, 0x8a, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x93, 0x1d, 0x94, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xba, 0x3d, 0x8a, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x47, 0x1c, 0xe3, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x3f, 0xdd, 0x27, 0x3e,
+  0x22, 0xfc, 0xec, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x6e, 0x3c, 0xd9, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x91, 0x1d, 0x14, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x97, 0x5c, 0xcf, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x40, 0xdd, 0xa7, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xba, 0x3d, 0x8a, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xe6, 0x5d, 0x80, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xd6, 0x8c, 0x40, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x52, 0xed, 0x22, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xe5, 0x5d, 0x00, 0x3e,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x92, 0x1d, 0x14, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xd8, 0x8c, 0x40, 0x3e,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32,
+  0xbf, 0x7c, 0x45, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xec, 0x9c, 0x3b, 0x3e,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x7d, 0x0d, 0x99, 0x3e,
+  0x70, 0x3c, 0xd9, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x3f, 0xdd, 0x27, 0x3e,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x47, 0x1c, 0xe3, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x93, 0x1d, 0x94, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x7e, 0x0d, 0x19, 0x3e,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0xad, 0x36, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x3e, 0xdd, 0x27, 0xbe, 0x6e, 0xfd, 0x9d, 0x3c, 0x7c, 0x0d, 0x19, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0x5a, 0x2c, 0x5e, 0xbe, 0xed, 0x9c, 0xbb, 0x3d,
+  0x14, 0xbd, 0x31, 0xbe, 0x00, 0x00, 0x40, 0x32, 0x93, 0x1d, 0x94, 0x3d,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x67, 0xfd, 0x1d, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0xad, 0x36, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x40, 0xdd, 0xa7, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xeb, 0x9c, 0x3b, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0xea, 0x9c, 0xbb, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xe6, 0x5d, 0x80, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xe4, 0x5d, 0x00, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x54, 0xed, 0x22, 0x3e,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d, 0x91, 0x1d, 0x14, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x93, 0x1d, 0x94, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xae, 0x6c, 0x4a, 0x3e,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0xec, 0x9c, 0x3b, 0x3e,
+  0xed, 0x9c, 0xbb, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0xf3, 0xdb, 0x76, 0x3e,
+  0xe6, 0x5d, 0x80, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x99, 0x5c, 0x4f, 0x3e,
+  0xec, 0x9c, 0x3b, 0x3e, 0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0x40, 0xdd, 0xa7, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x7e, 0x0d, 0x19, 0x3e,
+  0x70, 0x3c, 0xd9, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e, 0x46, 0x1c, 0x63, 0x3e,
+  0xf3, 0xdb, 0x76, 0x3e, 0xed, 0x9c, 0xbb, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0xbc, 0x3d, 0x0a, 0x3e, 0x54, 0xed, 0x22, 0x3e, 0xe5, 0x5d, 0x00, 0x3e,
+  0xe5, 0x5d, 0x00, 0x3e, 0xbc, 0x3d, 0x8a, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0x70, 0x3c, 0x59, 0x3e, 0x54, 0xed, 0x22, 0x3e, 0x70, 0x3c, 0xd9, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xac, 0x6c, 0x4a, 0xbe, 0x98, 0x5c, 0x4f, 0xbe,
+  0x6e, 0x3c, 0x59, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc, 0xac, 0x6c, 0x4a, 0xbe,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0x18, 0xbd, 0x31, 0x3d,
+  0x52, 0xed, 0x22, 0xbe, 0x62, 0xfd, 0x9d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x14, 0xbd, 0xb1, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x6c, 0x3c, 0x59, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xed, 0x9c, 0xbb, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0xad, 0x36, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x1a, 0xfc, 0xec, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x91, 0x1d, 0x14, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x7c, 0x0d, 0x19, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x72, 0x3c, 0x59, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c, 0x1a, 0xfc, 0xec, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x52, 0xed, 0x22, 0xbe,
+  0x00, 0xad, 0x36, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x29, 0xcd, 0x2c, 0xbe, 0x80, 0xfd, 0x9d, 0x3b, 0x45, 0x1c, 0xe3, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x92, 0x1d, 0x14, 0x3e,
+  0x7c, 0x0d, 0x19, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc, 0xd5, 0x11, 0x04, 0xbf,
+  0x97, 0x5c, 0xcf, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x92, 0x1d, 0x14, 0x3e,
+  0xea, 0x9c, 0xbb, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x53, 0xed, 0xa2, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x32, 0x0c, 0x68, 0x3e,
+  0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xe5, 0x5d, 0x00, 0x3e, 0x16, 0xbd, 0xb1, 0x3d, 0x16, 0xbd, 0x31, 0x3e,
+  0x69, 0xfd, 0x1d, 0x3e, 0xa7, 0x2d, 0x0f, 0x3e, 0xd0, 0x4d, 0x05, 0x3e,
+  0xc6, 0xc5, 0x87, 0x3e, 0x99, 0x5c, 0x4f, 0x3e, 0x92, 0x1d, 0x94, 0x3e,
+  0x3f, 0xdd, 0x27, 0x3e, 0x32, 0x0c, 0x68, 0x3e, 0x5b, 0x2c, 0x5e, 0x3e,
+  0x1d, 0xfc, 0x6c, 0x3e, 0x47, 0x1c, 0xe3, 0x3d, 0x01, 0xad, 0x36, 0x3e,
+  0x46, 0x1c, 0x63, 0x3e, 0xda, 0xd5, 0x82, 0x3e, 0xd8, 0x8c, 0x40, 0x3e,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x65, 0xfd, 0x1d, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc, 0x29, 0xcd, 0x2c, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xea, 0x9c, 0xbb, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0xed, 0x9c, 0xbb, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xd8, 0x8c, 0x40, 0x3e,
+  0x65, 0xfd, 0x1d, 0xbd, 0xed, 0x9c, 0xbb, 0x3d, 0xd6, 0x8c, 0x40, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x1e, 0xfc, 0xec, 0x3d,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0xad, 0x6c, 0xca, 0xbe,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xea, 0x9c, 0xbb, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x44, 0x1c, 0xe3, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xeb, 0x9c, 0x3b, 0xbe, 0x28, 0xfc, 0x6c, 0x3c, 0x6d, 0xc1, 0x1c, 0xbf,
+  0x7c, 0x0d, 0x19, 0xbe, 0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x29, 0xcd, 0x2c, 0xbe, 0x9a, 0x5c, 0xcf, 0x3d, 0xc5, 0xc5, 0x07, 0xbf,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc1, 0x7c, 0x45, 0xbe, 0x62, 0xfd, 0x9d, 0xbc, 0x06, 0xec, 0x71, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x62, 0xfd, 0x9d, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0x3c, 0xd9, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x3d, 0x0a, 0x3e, 0x47, 0x1c, 0xe3, 0x3d, 0xe5, 0x5d, 0x00, 0x3e,
+  0x18, 0xbd, 0x31, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e, 0x2a, 0xcd, 0x2c, 0x3e,
+  0x16, 0xbd, 0xb1, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xae, 0x6c, 0x4a, 0x3e,
+  0xbc, 0x3d, 0x0a, 0x3e, 0xc8, 0x7c, 0xc5, 0x3c, 0x84, 0x4c, 0x54, 0x3e,
+  0x40, 0xdd, 0xa7, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x66, 0xfd, 0x9d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xd0, 0x4d, 0x05, 0x3e,
+  0xba, 0x3d, 0x8a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xe3, 0x5d, 0x80, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0x47, 0x1c, 0xe3, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x19, 0xfc, 0x6c, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x44, 0x1c, 0xe3, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x1a, 0xfc, 0xec, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x5a, 0x2c, 0x5e, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x53, 0xed, 0xa2, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0xe6, 0x5d, 0x80, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb, 0x19, 0xfc, 0x6c, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x83, 0x4c, 0xd4, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x91, 0x1d, 0x14, 0xbe, 0x74, 0xfd, 0x1d, 0x3c, 0x1b, 0xfc, 0x6c, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0x83, 0x4c, 0x54, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x90, 0x1d, 0x94, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x7c, 0x0d, 0x19, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x29, 0xcd, 0x2c, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x1a, 0xfc, 0xec, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x70, 0x3c, 0xd9, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0xba, 0x3d, 0x8a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c, 0xd0, 0x4d, 0x05, 0x3e,
+  0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xbf, 0x7c, 0x45, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xd8, 0x8c, 0x40, 0x3e,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x90, 0x1d, 0x94, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xec, 0x9c, 0x3b, 0x3e,
+  0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x06, 0xec, 0x71, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x54, 0xed, 0x22, 0x3e,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xdd, 0xcb, 0x7b, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x29, 0xcd, 0x2c, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xbd, 0xb1, 0x3d,
+  0x14, 0xbd, 0xb1, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x62, 0xfd, 0x9d, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x3e, 0xdd, 0x27, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x30, 0x0c, 0x68, 0xbe,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0xe4, 0x5d, 0x00, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x97, 0x5c, 0xcf, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x91, 0x1d, 0x14, 0xbe, 0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e,
+  0xed, 0x9c, 0xbb, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x3f, 0xdd, 0x27, 0x3e,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0xd0, 0x4d, 0x05, 0x3e, 0xe6, 0x5d, 0x80, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0xe5, 0x5d, 0x00, 0x3e,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x3d, 0x8a, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xe4, 0x5d, 0x00, 0xbe, 0x70, 0x3c, 0xd9, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x44, 0x1c, 0xe3, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0x14, 0xbd, 0xb1, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0xcf, 0x4d, 0x85, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xcf, 0x4d, 0x05, 0xbe, 0x62, 0xfd, 0x9d, 0xbc, 0x3e, 0xdd, 0x27, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x16, 0xbd, 0xb1, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32,
+  0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x00, 0x00, 0x40, 0x32, 0x6a, 0xfd, 0x9d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0xea, 0x9c, 0xbb, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0x19, 0xfc, 0x6c, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x1e, 0xfc, 0xec, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x72, 0x3c, 0x59, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x69, 0xfd, 0x1d, 0x3e,
+  0x18, 0xbd, 0x31, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x93, 0x1d, 0x94, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x40, 0xdd, 0xa7, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6c, 0x3c, 0x59, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x93, 0x1d, 0x94, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x72, 0x3c, 0x59, 0x3d, 0x1d, 0xfc, 0x6c, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xec, 0x9c, 0x3b, 0x3e,
+  0x72, 0x3c, 0x59, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x40, 0xdd, 0xa7, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b,
+  0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x93, 0x1d, 0x94, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x01, 0xad, 0x36, 0x3e,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x70, 0x3c, 0x59, 0x3e,
+  0x65, 0xfd, 0x1d, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x93, 0x1d, 0x94, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x1e, 0xfc, 0xec, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x1e, 0xfc, 0xec, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x93, 0x1d, 0x94, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xbd, 0xb1, 0x3d, 0x69, 0xfd, 0x1d, 0x3e,
+  0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xba, 0x3d, 0x8a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xba, 0x3d, 0x8a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x1e, 0xfc, 0xec, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x22, 0xfc, 0xec, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x22, 0xfc, 0xec, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xd0, 0x4d, 0x05, 0x3e,
+  0x50, 0xfd, 0x9d, 0xbb, 0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0xe6, 0x5d, 0x80, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc, 0x69, 0xfd, 0x1d, 0x3e,
+  0x16, 0xbd, 0xb1, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x22, 0xfc, 0xec, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xf1, 0xdb, 0xf6, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0xea, 0x9c, 0xbb, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x7e, 0x0d, 0x19, 0x3e, 0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xed, 0x9c, 0xbb, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0xd0, 0x4d, 0x05, 0x3e,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x92, 0x1d, 0x14, 0x3e, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e,
+  0xe6, 0x5d, 0x80, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x40, 0xdd, 0xa7, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c, 0x93, 0x1d, 0x94, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xe5, 0x5d, 0x00, 0x3e,
+  0x72, 0x3c, 0x59, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc4, 0x7c, 0xc5, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xbd, 0xb1, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0xf4, 0xdb, 0xf6, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x44, 0x1c, 0xe3, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x44, 0x1c, 0xe3, 0xbd, 0xe5, 0x5d, 0x00, 0x3e,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xbd, 0xb1, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x70, 0x3c, 0xd9, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xf4, 0xdb, 0xf6, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x7e, 0x0d, 0x19, 0x3e, 0x74, 0xfd, 0x1d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x93, 0x1d, 0x94, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xe5, 0x5d, 0x00, 0x3e, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xd0, 0x4d, 0x05, 0x3e, 0x18, 0xbd, 0x31, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6c, 0x3c, 0x59, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x47, 0x1c, 0xe3, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x72, 0x3c, 0x59, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x40, 0xdd, 0xa7, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x92, 0x1d, 0x14, 0x3e, 0x9a, 0x5c, 0xcf, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x66, 0xfd, 0x9d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x66, 0xfd, 0x9d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x97, 0x5c, 0xcf, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x70, 0x3c, 0xd9, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x92, 0x1d, 0x14, 0x3e,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x47, 0x1c, 0xe3, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x16, 0xbd, 0xb1, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xe6, 0x5d, 0x80, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xed, 0x9c, 0xbb, 0x3d, 0x7e, 0x0d, 0x19, 0x3e,
+  0x70, 0x3c, 0xd9, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x97, 0x5c, 0xcf, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x66, 0xfd, 0x9d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xe3, 0x5d, 0x80, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6c, 0x3c, 0x59, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0x29, 0xcd, 0x2c, 0xbe,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x98, 0x5c, 0x4f, 0xbe,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x65, 0xfd, 0x1d, 0xbd, 0xed, 0x9c, 0xbb, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xcf, 0x4d, 0x05, 0xbe, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x46, 0x1c, 0x63, 0x3e,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0x3c, 0xd9, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xba, 0x3d, 0x8a, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd, 0xb1, 0xb5, 0x8c, 0x3e,
+  0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xba, 0x3d, 0x8a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xe3, 0x5d, 0x80, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xe4, 0x5d, 0x00, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x1a, 0xfc, 0xec, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd, 0xd8, 0x8c, 0x40, 0x3e,
+  0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0xec, 0x9c, 0x3b, 0x3e,
+  0x52, 0xed, 0x22, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x00, 0xad, 0x36, 0xbe, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x00, 0xad, 0x36, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0xd6, 0x8c, 0x40, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xba, 0x3d, 0x0a, 0xbe, 0x52, 0xed, 0x22, 0xbe, 0x16, 0xfc, 0xec, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0x3e, 0xdd, 0x27, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0xc1, 0x7c, 0x45, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xcf, 0x4d, 0x05, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x90, 0x1d, 0x94, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbf, 0x7c, 0x45, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x14, 0xbd, 0xb1, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xea, 0x9c, 0xbb, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xec, 0x9c, 0x3b, 0x3e,
+  0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0xae, 0x6c, 0x4a, 0x3e,
+  0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x62, 0xfd, 0x9d, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xc3, 0x7c, 0x45, 0x3e,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x3e, 0xdd, 0x27, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x92, 0x1d, 0x14, 0x3e,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0x7c, 0x0d, 0x19, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x3e, 0xdd, 0x27, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xba, 0x3d, 0x0a, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x80, 0xfd, 0x9d, 0x3b, 0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x44, 0x1c, 0xe3, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x29, 0xcd, 0x2c, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x98, 0x5c, 0x4f, 0xbe, 0x83, 0x4c, 0x54, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x06, 0xec, 0x71, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xeb, 0x9c, 0x3b, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xc0, 0x7c, 0xc5, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x29, 0xcd, 0x2c, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x40, 0xdd, 0xa7, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x29, 0xcd, 0x2c, 0xbe,
+  0x40, 0xdd, 0xa7, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x30, 0x0c, 0x68, 0xbe,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x10, 0xfc, 0x6c, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c, 0x14, 0xbd, 0x31, 0xbe,
+  0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x47, 0x1c, 0xe3, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x47, 0x1c, 0xe3, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x66, 0xfd, 0x9d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x5b, 0x2c, 0x5e, 0x3e,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x3d, 0x8a, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xe6, 0x5d, 0x80, 0x3d, 0x3e, 0xdd, 0x27, 0xbe,
+  0x00, 0x00, 0x40, 0x32, 0xc5, 0x7c, 0x45, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x1b, 0xfc, 0x6c, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x14, 0xbd, 0xb1, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0x7c, 0x0d, 0x19, 0xbe,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xf4, 0xdb, 0xf6, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x70, 0x3c, 0xd9, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x92, 0x1d, 0x94, 0x3e,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x19, 0xfc, 0x6c, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x92, 0x1d, 0x14, 0x3e,
+  0x18, 0xbd, 0x31, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x44, 0x1c, 0xe3, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0xac, 0x6c, 0x4a, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x7c, 0x0d, 0x19, 0xbe, 0x16, 0xfc, 0xec, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x1a, 0xfc, 0xec, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xeb, 0x9c, 0x3b, 0xbe,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0xe4, 0x5d, 0x00, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x1f, 0xfc, 0x6c, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d, 0x97, 0x5c, 0xcf, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x2a, 0xcd, 0x2c, 0x3e,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0xe5, 0x5d, 0x00, 0x3e,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0xe5, 0x5d, 0x00, 0x3e,
+  0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x80, 0xfd, 0x9d, 0x3b, 0x12, 0xbd, 0x31, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x16, 0xfc, 0xec, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x18, 0xbd, 0x31, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0xe6, 0x5d, 0x80, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xe4, 0x5d, 0x00, 0xbe,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x3e, 0xdd, 0x27, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x90, 0x1d, 0x94, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x90, 0x1d, 0x94, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32, 0xcf, 0x4d, 0x05, 0xbe,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xed, 0x9c, 0xbb, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x44, 0x1c, 0xe3, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xbd, 0xb1, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0xed, 0x9c, 0xbb, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0x54, 0xed, 0x22, 0x3e,
+  0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x44, 0x1c, 0xe3, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xcf, 0x4d, 0x05, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x29, 0xcd, 0x2c, 0xbe,
+  0x91, 0x1d, 0x14, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x6c, 0x3c, 0x59, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0xbb, 0x3d, 0x8a, 0xbe,
+  0x22, 0xfc, 0xec, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0xc1, 0x7c, 0x45, 0xbe,
+  0x93, 0x1d, 0x94, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x93, 0x1d, 0x94, 0x3d, 0xb0, 0xb5, 0x8c, 0xbe,
+  0xed, 0x9c, 0xbb, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x70, 0x3c, 0xd9, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xed, 0x9c, 0xbb, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x7c, 0x0d, 0x19, 0xbe,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0x9a, 0x5c, 0xcf, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0x72, 0x3c, 0x59, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x1e, 0xfc, 0xec, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x44, 0x1c, 0xe3, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0x6c, 0x3c, 0x59, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0xea, 0x9c, 0xbb, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x14, 0xbd, 0xb1, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x67, 0xfd, 0x1d, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x90, 0x1d, 0x94, 0xbd, 0x0a, 0x35, 0xb4, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xd0, 0x4d, 0x05, 0x3e, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0x3c, 0x59, 0xbe,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x70, 0x3c, 0xd9, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xf2, 0xdb, 0x76, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xbd, 0xb1, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xbd, 0xb1, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x1a, 0xfc, 0xec, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x1a, 0xfc, 0xec, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x00, 0xad, 0x36, 0xbe, 0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x14, 0xbd, 0xb1, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x83, 0x4c, 0x54, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0xac, 0x6c, 0x4a, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x3e, 0xdd, 0x27, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x00, 0xad, 0x36, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe3, 0x5d, 0x80, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xcf, 0x4d, 0x85, 0xbe, 0xd6, 0x8c, 0x40, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x14, 0xbd, 0x31, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xea, 0x9c, 0xbb, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x44, 0x1c, 0xe3, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbf, 0x7c, 0x45, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xeb, 0x9c, 0x3b, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32,
+  0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc, 0xe4, 0x5d, 0x00, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x12, 0xbd, 0x31, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x97, 0x5c, 0xcf, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0x12, 0xbd, 0x31, 0xbd, 0xd6, 0x8c, 0x40, 0xbe,
+  0xd6, 0x8c, 0x40, 0xbe, 0xf2, 0xdb, 0x76, 0xbe, 0x44, 0x1c, 0xe3, 0xbd,
+  0x00, 0xad, 0x36, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x7c, 0x0d, 0x19, 0xbe, 0x98, 0x5c, 0x4f, 0xbe, 0x06, 0xec, 0x71, 0xbe,
+  0xc1, 0x7c, 0x45, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0xc1, 0x7c, 0x45, 0xbe, 0x83, 0x4c, 0x54, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x29, 0xcd, 0x2c, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x30, 0x0c, 0x68, 0xbe,
+  0xac, 0x6c, 0x4a, 0xbe, 0x1b, 0xfc, 0x6c, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x14, 0xbd, 0x31, 0xbe, 0x29, 0xcd, 0x2c, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x14, 0xbd, 0x31, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x3e, 0xdd, 0x27, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x98, 0x5c, 0x4f, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0x5a, 0x2c, 0x5e, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0xd6, 0x8c, 0x40, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0x83, 0x4c, 0x54, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0x67, 0xfd, 0x1d, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x67, 0xfd, 0x1d, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x6c, 0x3c, 0x59, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xf2, 0xdb, 0x76, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc1, 0x7c, 0x45, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x90, 0x1d, 0x94, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x16, 0xfc, 0xec, 0xbc, 0xcf, 0x4d, 0x05, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x93, 0x1d, 0x94, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x67, 0xfd, 0x1d, 0xbe, 0xda, 0xd5, 0x82, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0x16, 0xfc, 0xec, 0xbc, 0x7c, 0x0d, 0x19, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x45, 0x1c, 0x63, 0xbe, 0x83, 0x4c, 0x54, 0xbe,
+  0x00, 0xad, 0x36, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0xc5, 0xc5, 0x87, 0xbe,
+  0x5a, 0x2c, 0x5e, 0xbe, 0x30, 0x0c, 0x68, 0xbe, 0x72, 0x3c, 0x59, 0x3d,
+  0x30, 0x0c, 0x68, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0xe4, 0x5d, 0x80, 0xbe, 0xe4, 0x5d, 0x80, 0xbe,
+  0xeb, 0x9c, 0x3b, 0xbe, 0x12, 0xbd, 0x31, 0xbd, 0xc1, 0x7c, 0x45, 0xbe,
+  0x83, 0x4c, 0x54, 0xbe, 0xc5, 0xc5, 0x87, 0xbe, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xac, 0x6c, 0x4a, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0x45, 0x1c, 0x63, 0xbe,
+  0x83, 0x4c, 0x54, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0x6e, 0x3c, 0x59, 0xbe,
+  0x83, 0x4c, 0x54, 0xbe, 0x45, 0x1c, 0x63, 0xbe, 0x72, 0x3c, 0x59, 0x3d,
+  0x6e, 0x3c, 0x59, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc1, 0x7c, 0x45, 0xbe, 0x06, 0xec, 0x71, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x45, 0x1c, 0x63, 0xbe,
+  0x5a, 0x2c, 0x5e, 0xbe, 0x1b, 0xfc, 0x6c, 0xbe, 0x00, 0x00, 0x40, 0x32,
+  0x14, 0xbd, 0x31, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0x83, 0x4c, 0x54, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd, 0xac, 0x6c, 0x4a, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x72, 0x3c, 0x59, 0x3d,
+  0x14, 0xbd, 0x31, 0xbe, 0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xcf, 0x4d, 0x05, 0xbe, 0x00, 0x00, 0x40, 0x32, 0x40, 0xdd, 0xa7, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0xe6, 0x5d, 0x80, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6c, 0x3c, 0x59, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x93, 0x1d, 0x94, 0x3d,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x97, 0x5c, 0xcf, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbf, 0x7c, 0x45, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x97, 0x5c, 0xcf, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xcf, 0x4d, 0x05, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x83, 0x4c, 0x54, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x00, 0xad, 0x36, 0xbe, 0x91, 0x1d, 0x14, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x29, 0xcd, 0x2c, 0xbe,
+  0xc1, 0x7c, 0x45, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xeb, 0x9c, 0x3b, 0xbe, 0x3e, 0xdd, 0x27, 0xbe, 0x12, 0xbd, 0x31, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x3e, 0xdd, 0x27, 0xbe, 0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x3e, 0xdd, 0x27, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xd6, 0x8c, 0x40, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xeb, 0x9c, 0x3b, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xd6, 0x8c, 0x40, 0xbe, 0x12, 0xbd, 0x31, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0xc1, 0x7c, 0x45, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x29, 0xcd, 0x2c, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x66, 0xfd, 0x9d, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x74, 0xfd, 0x1d, 0x3c,
+  0x1a, 0xfc, 0xec, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c,
+  0x16, 0xbd, 0xb1, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x16, 0xbd, 0xb1, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x72, 0x3c, 0x59, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x40, 0xdd, 0xa7, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0xed, 0x9c, 0xbb, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbf, 0x7c, 0x45, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x30, 0x0c, 0x68, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xeb, 0x9c, 0x3b, 0xbe, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xbd, 0xb1, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xed, 0x9c, 0xbb, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xbd, 0xb1, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x16, 0xfc, 0xec, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x70, 0x3c, 0xd9, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x1f, 0xfc, 0x6c, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x40, 0xdd, 0xa7, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x29, 0xcd, 0x2c, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xbd, 0xb1, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x6e, 0x3c, 0x59, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xc5, 0x7c, 0x45, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x16, 0xfc, 0xec, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0xac, 0x6c, 0x4a, 0xbe,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x93, 0x1d, 0x94, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xc1, 0x7c, 0x45, 0xbe,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x40, 0xdd, 0xa7, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x97, 0x5c, 0xcf, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x3d, 0x8a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x91, 0x1d, 0x14, 0xbe, 0x6c, 0x3c, 0x59, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x91, 0x1d, 0x14, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xe5, 0x5d, 0x00, 0x3e, 0x1e, 0xfc, 0xec, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x9a, 0x5c, 0xcf, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xb0, 0xb5, 0x8c, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x93, 0x1d, 0x94, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xf6, 0x24, 0xb9, 0xbe,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x1e, 0xfc, 0xec, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x1e, 0xfc, 0xec, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x97, 0x5c, 0xcf, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xe4, 0x5d, 0x00, 0xbe, 0x52, 0xed, 0x22, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0xc1, 0x7c, 0x45, 0xbe, 0x52, 0xed, 0x22, 0xbe, 0x3e, 0xdd, 0x27, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xc1, 0x7c, 0x45, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0xc5, 0xc5, 0x87, 0xbe, 0x6e, 0x3c, 0x59, 0xbe, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0xe5, 0x5d, 0x00, 0x3e, 0xed, 0x9c, 0xbb, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e,
+  0xed, 0x9c, 0xbb, 0x3d, 0x47, 0x1c, 0xe3, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x47, 0x1c, 0xe3, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xe6, 0x5d, 0x80, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b, 0xc5, 0x7c, 0x45, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0xcf, 0x4d, 0x05, 0xbe, 0x44, 0x1c, 0xe3, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0xba, 0x3d, 0x8a, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x16, 0xbd, 0xb1, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xcf, 0x4d, 0x05, 0xbe, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0xe4, 0x5d, 0x00, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x97, 0x5c, 0xcf, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x1e, 0xfc, 0xec, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x44, 0x1c, 0xe3, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x3e, 0xdd, 0x27, 0xbe, 0x14, 0xbd, 0x31, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x3e, 0xdd, 0x27, 0xbe, 0xac, 0x6c, 0x4a, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x40, 0xdd, 0xa7, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d, 0x54, 0xed, 0x22, 0x3e,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x16, 0xbd, 0xb1, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xbb, 0x3d, 0x8a, 0x3e,
+  0x00, 0xad, 0x36, 0xbe, 0x52, 0xed, 0x22, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x6e, 0x3c, 0x59, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0xb1, 0xb5, 0x8c, 0x3e,
+  0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x0a, 0xbe, 0xea, 0x9c, 0xbb, 0xbd,
+  0x67, 0xfd, 0x1d, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x1f, 0x45, 0xaf, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0xac, 0x6c, 0x4a, 0xbe, 0x70, 0x3c, 0x59, 0x3e,
+  0x40, 0xdd, 0xa7, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xe6, 0x5d, 0x80, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x93, 0x1d, 0x94, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xbd, 0xb1, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x65, 0xfd, 0x1d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x66, 0xfd, 0x9d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xba, 0x3d, 0x8a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x97, 0x5c, 0xcf, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x47, 0x1c, 0xe3, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x2a, 0xcd, 0x2c, 0x3e,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xe6, 0x5d, 0x80, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x34, 0x55, 0xaa, 0x3e,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xa4, 0xe0, 0x3e,
+  0x66, 0xfd, 0x9d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xac, 0x6c, 0x4a, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0x32, 0x0c, 0x68, 0x3e,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xc5, 0xc5, 0x87, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x69, 0xfd, 0x1d, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x19, 0xfc, 0x6c, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xcf, 0x4d, 0x05, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc, 0xe6, 0x5d, 0x80, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x66, 0xfd, 0x9d, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xba, 0x3d, 0x8a, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x93, 0x1d, 0x94, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xc3, 0x7c, 0x45, 0x3e,
+  0xea, 0x9c, 0xbb, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0xd8, 0x8c, 0x40, 0x3e,
+  0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x45, 0x1c, 0x63, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc0, 0x7c, 0xc5, 0xbd, 0xd0, 0x4d, 0x05, 0x3e,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x19, 0xfc, 0x6c, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xea, 0x9c, 0xbb, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xe4, 0x5d, 0x00, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xe3, 0x5d, 0x80, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x1e, 0xfc, 0xec, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xba, 0x3d, 0x0a, 0xbe, 0x19, 0xfc, 0x6c, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x66, 0xfd, 0x9d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d,
+  0x1a, 0xfc, 0xec, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x6c, 0x3c, 0x59, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x93, 0x1d, 0x94, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x19, 0xfc, 0x6c, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x70, 0x3c, 0xd9, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe3, 0x5d, 0x80, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x16, 0xfc, 0xec, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x90, 0x1d, 0x94, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x18, 0xbd, 0x31, 0x3d,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0xd6, 0x8c, 0x40, 0xbe, 0xd6, 0x8c, 0x40, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x7c, 0x0d, 0x19, 0xbe, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x52, 0xed, 0x22, 0xbe,
+  0xcf, 0x4d, 0x05, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x62, 0xfd, 0x9d, 0xbc, 0x1a, 0xfc, 0xec, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x97, 0x5c, 0xcf, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x14, 0xbd, 0xb1, 0xbd, 0x29, 0xcd, 0x2c, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x29, 0xcd, 0x2c, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x14, 0xbd, 0xb1, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x6b, 0xfd, 0x1d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xc1, 0x7c, 0x45, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x97, 0x5c, 0xcf, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x50, 0xfd, 0x9d, 0xbb,
+  0x66, 0xfd, 0x9d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x90, 0x1d, 0x94, 0xbd, 0x1e, 0xfc, 0xec, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x3d, 0xdd, 0xa7, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0x44, 0x1c, 0xe3, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xcf, 0x4d, 0x05, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0xe3, 0x5d, 0x80, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x67, 0xfd, 0x1d, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x14, 0xbd, 0x31, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x22, 0xfc, 0xec, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x74, 0xfd, 0x1d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x67, 0xfd, 0x1d, 0xbe, 0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xe5, 0x5d, 0x00, 0x3e, 0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x40, 0xdd, 0xa7, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x70, 0x3c, 0xd9, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x40, 0xdd, 0xa7, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x40, 0xdd, 0xa7, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0x74, 0xfd, 0x1d, 0x3c, 0x66, 0xfd, 0x9d, 0xbd, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xba, 0x3d, 0x8a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x66, 0xfd, 0x9d, 0xbd, 0xeb, 0x9c, 0x3b, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0xea, 0x9c, 0xbb, 0xbd, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x90, 0x1d, 0x94, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xe4, 0x5d, 0x00, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xe4, 0x5d, 0x00, 0xbe, 0xba, 0x3d, 0x8a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x44, 0x1c, 0xe3, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xd6, 0x8c, 0x40, 0xbe,
+  0xcf, 0x4d, 0x05, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0x14, 0xbd, 0x31, 0xbe, 0xbf, 0x7c, 0x45, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x3e, 0xdd, 0x27, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x14, 0xbd, 0x31, 0xbe, 0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x1a, 0xfc, 0xec, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc4, 0x7c, 0xc5, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x40, 0xdd, 0xa7, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xe5, 0x5d, 0x00, 0x3e,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x93, 0x1d, 0x94, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e,
+  0xbc, 0x3d, 0x0a, 0x3e, 0x74, 0xfd, 0x1d, 0x3c, 0x1e, 0xfc, 0xec, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xbd, 0xb1, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xf4, 0xdb, 0xf6, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xc5, 0x7c, 0x45, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x69, 0xfd, 0x1d, 0x3e, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x44, 0x1c, 0xe3, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xba, 0x3d, 0x0a, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b, 0x66, 0xfd, 0x9d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x50, 0xfd, 0x9d, 0xbb,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xba, 0x3d, 0x8a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d,
+  0xe4, 0x5d, 0x00, 0xbe, 0xba, 0x3d, 0x8a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c, 0x52, 0xed, 0x22, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x67, 0xfd, 0x1d, 0xbe, 0x16, 0xfc, 0xec, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xe4, 0x5d, 0x00, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x52, 0xed, 0x22, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0x91, 0x1d, 0x14, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x44, 0x1c, 0xe3, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x1a, 0xfc, 0xec, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xc1, 0x7c, 0x45, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x3e, 0xdd, 0x27, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0x98, 0x5c, 0x4f, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0xd6, 0x8c, 0x40, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0x91, 0x1d, 0x14, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0xbf, 0x7c, 0x45, 0xbd,
+  0x14, 0xbd, 0x31, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0x52, 0xed, 0x22, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x1f, 0xfc, 0x6c, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x40, 0xdd, 0xa7, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x93, 0x1d, 0x94, 0x3d, 0x44, 0x1c, 0xe3, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6c, 0x3c, 0x59, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x91, 0x1d, 0x14, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x19, 0xfc, 0x6c, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x45, 0x1c, 0x63, 0xbe, 0xbf, 0x7c, 0x45, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x90, 0x1d, 0x94, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0x29, 0xcd, 0x2c, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x93, 0x1d, 0x94, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x44, 0x1c, 0xe3, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xcf, 0x4d, 0x05, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x91, 0x1d, 0x14, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x70, 0x3c, 0xd9, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c, 0x93, 0x1d, 0x94, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xcf, 0x4d, 0x05, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x52, 0xed, 0x22, 0xbe,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0xc1, 0x7c, 0x45, 0xbe,
+  0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32, 0xe3, 0x5d, 0x80, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb,
+  0x50, 0xfd, 0x9d, 0xbb, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x47, 0x1c, 0xe3, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x1e, 0xfc, 0xec, 0x3d,
+  0x18, 0xbd, 0x31, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0xc5, 0x7c, 0x45, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0x1a, 0xfc, 0xec, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x47, 0x1c, 0xe3, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x1e, 0xfc, 0xec, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x29, 0xcd, 0x2c, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x28, 0xfc, 0x6c, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x10, 0xfc, 0x6c, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xc5, 0x7c, 0x45, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xa7, 0x2d, 0x0f, 0x3e,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc,
+  0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbf, 0x7c, 0x45, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xc5, 0x7c, 0x45, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x3d, 0x8a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x44, 0x1c, 0xe3, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b, 0x29, 0xcd, 0x2c, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x19, 0xfc, 0x6c, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc5, 0x7c, 0x45, 0x3d, 0x66, 0xfd, 0x9d, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x66, 0xfd, 0x9d, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x9a, 0x5c, 0xcf, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x70, 0x3c, 0xd9, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x93, 0x1d, 0x94, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0x91, 0x1d, 0x14, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x93, 0x1d, 0x94, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0x46, 0x1c, 0x63, 0x3e,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x65, 0xfd, 0x1d, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x7e, 0x0d, 0x19, 0x3e, 0x72, 0x3c, 0x59, 0x3d, 0x08, 0xec, 0x71, 0x3e,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0xed, 0x9c, 0xbb, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xd0, 0x4d, 0x05, 0x3e, 0x6b, 0xfd, 0x1d, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x72, 0x3c, 0x59, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x16, 0xbd, 0xb1, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x74, 0xfd, 0x1d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c, 0xe3, 0x5d, 0x80, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x52, 0xed, 0x22, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x40, 0xdd, 0xa7, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0x18, 0xbd, 0x31, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xed, 0x9c, 0xbb, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x7c, 0x0d, 0x99, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x18, 0xbd, 0x31, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x70, 0x3c, 0xd9, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x26, 0x84, 0xea, 0xbe,
+  0xe6, 0x5d, 0x80, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x70, 0x3c, 0xd9, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x16, 0xbd, 0xb1, 0x3d, 0xcc, 0x04, 0xc3, 0xbe,
+  0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x47, 0x1c, 0xe3, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xbd, 0xb1, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc4, 0x7c, 0xc5, 0x3d, 0x53, 0xed, 0xa2, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x66, 0xfd, 0x9d, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x93, 0x1d, 0x94, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x5e, 0x75, 0xa0, 0x3e,
+  0x1e, 0xfc, 0xec, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xbb, 0x3d, 0x8a, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xe5, 0x5d, 0x00, 0x3e, 0xb8, 0x3d, 0x0a, 0xbd, 0xd0, 0x4d, 0x05, 0x3e,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x90, 0x1d, 0x94, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xe4, 0x5d, 0x00, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x29, 0xcd, 0x2c, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xea, 0x9c, 0xbb, 0xbd, 0xc1, 0x7c, 0x45, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x97, 0x5c, 0xcf, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x29, 0xcd, 0x2c, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0xd6, 0x8c, 0x40, 0xbe,
+  0xed, 0x9c, 0xbb, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d, 0x72, 0x85, 0x9b, 0xbe,
+  0xe6, 0x5d, 0x80, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0xeb, 0x9c, 0xbb, 0xbe,
+  0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xea, 0x9c, 0xbb, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xe6, 0x5d, 0x80, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xcf, 0x4d, 0x05, 0xbe, 0x14, 0xbd, 0x31, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xea, 0x9c, 0xbb, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xba, 0x3d, 0x8a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x67, 0xfd, 0x1d, 0xbe,
+  0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xa7, 0x2d, 0x0f, 0x3e,
+  0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c,
+  0x69, 0xfd, 0x1d, 0x3e, 0x5c, 0xfd, 0x1d, 0xbc, 0x1e, 0xfc, 0xec, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x93, 0x1d, 0x94, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0xc4, 0x7c, 0xc5, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x1b, 0xfc, 0x6c, 0xbe,
+  0x44, 0x1c, 0xe3, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x14, 0xbd, 0x31, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0xb8, 0x3d, 0x0a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xba, 0x3d, 0x0a, 0xbe, 0xbe, 0x3d, 0x0a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x1a, 0xfc, 0xec, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x97, 0x5c, 0xcf, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x1a, 0xfc, 0xec, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x12, 0xbd, 0x31, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xea, 0x9c, 0xbb, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x44, 0x1c, 0xe3, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x67, 0xfd, 0x1d, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x14, 0xbd, 0x31, 0xbe,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x16, 0xbd, 0xb1, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x2a, 0xcd, 0x2c, 0x3e,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xe6, 0x5d, 0x80, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x47, 0x1c, 0xe3, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x7d, 0x0d, 0x99, 0x3e,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x70, 0x3c, 0xd9, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0xa7, 0x2d, 0x8f, 0x3e,
+  0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6c, 0x3c, 0x59, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x44, 0x1c, 0xe3, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x91, 0x1d, 0x94, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xac, 0x6c, 0x4a, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d,
+  0xe3, 0x5d, 0x80, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xba, 0x3d, 0x0a, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x93, 0x1d, 0x94, 0x3d, 0x83, 0x4c, 0x54, 0xbe,
+  0x62, 0xfd, 0x9d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0xe4, 0x5d, 0x00, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x97, 0x5c, 0xcf, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0xe4, 0x5d, 0x00, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x3d, 0x8a, 0x3d, 0x91, 0x1d, 0x14, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x72, 0x3c, 0x59, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0x3c, 0x59, 0xbe,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x19, 0xfc, 0x6c, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0xed, 0x9c, 0xbb, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd, 0x92, 0x1d, 0x14, 0x3e,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xbd, 0x31, 0x3e,
+  0x6c, 0x3c, 0x59, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb,
+  0x16, 0xfc, 0xec, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x1f, 0xfc, 0x6c, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x44, 0x1c, 0xe3, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x12, 0xbd, 0x31, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x7c, 0x0d, 0x19, 0xbe,
+  0xeb, 0x9c, 0x3b, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x44, 0x1c, 0xe3, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x67, 0xfd, 0x1d, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xf1, 0xdb, 0xf6, 0xbd, 0x29, 0xcd, 0x2c, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0xc1, 0x7c, 0x45, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x72, 0x3c, 0x59, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0xdd, 0xcb, 0x7b, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6c, 0x3c, 0x59, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x91, 0x1d, 0x14, 0xbe,
+  0x16, 0xbd, 0xb1, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x93, 0x1d, 0x94, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x90, 0x1d, 0x94, 0xbd,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x12, 0xbd, 0x31, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x70, 0x3c, 0xd9, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d, 0x54, 0xed, 0x22, 0x3e,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x16, 0xfc, 0xec, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x44, 0x1c, 0xe3, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x3e, 0xdd, 0x27, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x67, 0xfd, 0x1d, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0xd6, 0x8c, 0x40, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x6e, 0x3c, 0x59, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xba, 0x3d, 0x8a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x44, 0x1c, 0xe3, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x14, 0xbd, 0x31, 0xbe, 0x6e, 0x3c, 0x59, 0xbe,
+  0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x66, 0xfd, 0x9d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x34, 0x55, 0xaa, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x6c, 0x3c, 0x59, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x10, 0xfc, 0x6c, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d, 0x68, 0xfd, 0x9d, 0xbe,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x93, 0x1d, 0x94, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0x28, 0xfc, 0x6c, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x72, 0x3c, 0x59, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x47, 0x1c, 0xe3, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x3d, 0x8a, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe6, 0x5d, 0x80, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x18, 0xbd, 0x31, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x29, 0xcd, 0x2c, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x14, 0xbd, 0x31, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x14, 0xbd, 0x31, 0xbe,
+  0x91, 0x1d, 0x14, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x90, 0x1d, 0x94, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe,
+  0xea, 0x9c, 0xbb, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0xc1, 0x7c, 0x45, 0xbe,
+  0x7c, 0x0d, 0x19, 0xbe, 0xbf, 0x7c, 0x45, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x14, 0xbd, 0x31, 0xbe, 0x29, 0xcd, 0x2c, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0x6c, 0x3c, 0x59, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x3e, 0xdd, 0x27, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x66, 0xfd, 0x9d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x91, 0x1d, 0x14, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x44, 0x1c, 0xe3, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0xc8, 0x7c, 0xc5, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x6e, 0xfd, 0x9d, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0xc5, 0x7c, 0x45, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x5a, 0x2c, 0x5e, 0xbe, 0x6c, 0x3c, 0x59, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x3e, 0xdd, 0x27, 0xbe, 0x62, 0xfd, 0x9d, 0xbc,
+  0xcf, 0x4d, 0x05, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0xc5, 0x7c, 0x45, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x14, 0xbd, 0xb1, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x16, 0xfc, 0xec, 0xbc,
+  0x7c, 0x0d, 0x19, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d, 0x66, 0xfd, 0x9d, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x98, 0x5c, 0x4f, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0x66, 0xfd, 0x9d, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x29, 0xcd, 0x2c, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x19, 0xfc, 0x6c, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe3, 0x5d, 0x80, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x44, 0x1c, 0xe3, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0x6c, 0x3c, 0x59, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xf2, 0xdb, 0x76, 0xbe, 0xdd, 0xcb, 0x7b, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x1b, 0xfc, 0x6c, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xc5, 0xc5, 0x87, 0xbe, 0x3e, 0xdd, 0xa7, 0xbe,
+  0x45, 0x1c, 0x63, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x53, 0xed, 0xa2, 0xbe,
+  0x29, 0xcd, 0xac, 0xbe, 0x53, 0xed, 0xa2, 0xbe, 0x62, 0xfd, 0x9d, 0xbc,
+  0x06, 0xec, 0x71, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0x12, 0xbd, 0x31, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xbb, 0x3d, 0x8a, 0xbe, 0x91, 0x1d, 0x94, 0xbe,
+  0x3e, 0xdd, 0xa7, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0xb0, 0xb5, 0x8c, 0xbe,
+  0xad, 0x6c, 0xca, 0xbe, 0x48, 0x65, 0xa5, 0xbe, 0xea, 0x9c, 0xbb, 0xbd,
+  0x9c, 0xa5, 0x91, 0xbe, 0x06, 0xec, 0x71, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x98, 0x5c, 0x4f, 0xbe, 0xe4, 0x5d, 0x80, 0xbe,
+  0xc5, 0xc5, 0x87, 0xbe, 0x3e, 0xdd, 0x27, 0xbe, 0x30, 0x0c, 0x68, 0xbe,
+  0x00, 0xad, 0x36, 0xbe, 0xc5, 0xc5, 0x87, 0xbe, 0x97, 0x5c, 0xcf, 0xbd,
+  0x14, 0xbd, 0x31, 0xbe, 0xd6, 0x8c, 0x40, 0xbe, 0x62, 0xfd, 0x9d, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x83, 0x4c, 0x54, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x00, 0xad, 0x36, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0x98, 0x5c, 0x4f, 0xbe, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc1, 0x7c, 0x45, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x83, 0x4c, 0x54, 0xbe, 0xc1, 0x7c, 0x45, 0xbe,
+  0x3e, 0xdd, 0x27, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0xdd, 0xcb, 0x7b, 0xbe, 0xd6, 0x8c, 0x40, 0xbe, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6e, 0x3c, 0x59, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x98, 0x5c, 0x4f, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x74, 0xfd, 0x1d, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x6c, 0x3c, 0x59, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xe6, 0x5d, 0x80, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0xe6, 0x5d, 0x80, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x66, 0xfd, 0x9d, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x90, 0x1d, 0x94, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x67, 0xfd, 0x1d, 0xbe, 0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x97, 0x5c, 0xcf, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x1a, 0xfc, 0xec, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0xc1, 0x7c, 0x45, 0xbe, 0x22, 0xfc, 0xec, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0x66, 0xfd, 0x9d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x44, 0x1c, 0xe3, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x3e, 0xdd, 0x27, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x29, 0xcd, 0x2c, 0xbe, 0xe4, 0x5d, 0x00, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xf2, 0xdb, 0x76, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0x00, 0x00, 0x40, 0x32, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x74, 0xfd, 0x1d, 0x3c, 0x90, 0x1d, 0x94, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0xf1, 0xdb, 0xf6, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xcf, 0x4d, 0x05, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0xcf, 0x4d, 0x05, 0xbe, 0x44, 0x1c, 0xe3, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x9c, 0xa5, 0x91, 0xbe, 0xa2, 0xe4, 0xcc, 0xbe,
+  0x6e, 0x3c, 0x59, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x14, 0xbd, 0x31, 0xbe, 0xcf, 0x4d, 0x05, 0xbe, 0x16, 0xfc, 0xec, 0xbc,
+  0xcf, 0x4d, 0x05, 0xbe, 0x1a, 0xfc, 0xec, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x91, 0x1d, 0x14, 0xbe, 0x66, 0xfd, 0x9d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x45, 0x1c, 0x63, 0xbe, 0x10, 0xfc, 0x6c, 0xbc,
+  0xeb, 0x9c, 0x3b, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0xbf, 0x7c, 0x45, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x3e, 0xdd, 0x27, 0xbe,
+  0xc1, 0x7c, 0x45, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0x14, 0xbd, 0xb1, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x98, 0x5c, 0x4f, 0xbe, 0x28, 0xfc, 0x6c, 0x3c,
+  0x3e, 0xdd, 0x27, 0xbe, 0x52, 0xed, 0x22, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x91, 0x1d, 0x14, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x93, 0x1d, 0x94, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x1a, 0xfc, 0xec, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x16, 0xbd, 0xb1, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d, 0xe5, 0x5d, 0x00, 0x3e,
+  0x28, 0xfc, 0x6c, 0x3c, 0x1e, 0xfc, 0xec, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0xf4, 0xdb, 0xf6, 0x3d, 0xbf, 0x7c, 0x45, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x16, 0xbd, 0xb1, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc4, 0x7c, 0xc5, 0x3d, 0xba, 0x3d, 0x0a, 0xbe,
+  0x72, 0x3c, 0x59, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x18, 0xbd, 0x31, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xe4, 0x5d, 0x00, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xe6, 0x5d, 0x80, 0x3d, 0x9c, 0xa5, 0x91, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x50, 0xfd, 0x9d, 0xbb, 0x12, 0xbd, 0x31, 0xbd,
+  0x18, 0xbd, 0x31, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x1a, 0xfc, 0xec, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x5a, 0x2c, 0x5e, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x65, 0xfd, 0x1d, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x67, 0xfd, 0x1d, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x7c, 0x0d, 0x19, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0x6e, 0x3c, 0xd9, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x6e, 0x3c, 0xd9, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x90, 0x1d, 0x94, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x28, 0xfc, 0x6c, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0xd0, 0x4d, 0x05, 0x3e,
+  0x47, 0x1c, 0xe3, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x50, 0xfd, 0x9d, 0xbb, 0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x22, 0xfc, 0xec, 0x3c, 0xd0, 0x4d, 0x05, 0x3e,
+  0x72, 0x3c, 0x59, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0xc3, 0x7c, 0x45, 0x3e,
+  0x47, 0x1c, 0xe3, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0x2a, 0xcd, 0x2c, 0x3e,
+  0x69, 0xfd, 0x1d, 0x3e, 0x47, 0x1c, 0xe3, 0x3d, 0x7e, 0x0d, 0x19, 0x3e,
+  0x80, 0xfd, 0x9d, 0x3b, 0x93, 0x1d, 0x94, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x22, 0xfc, 0xec, 0x3c, 0xe6, 0x5d, 0x80, 0x3d, 0x16, 0xbd, 0x31, 0x3e,
+  0x1e, 0xfc, 0xec, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x18, 0xbd, 0x31, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x93, 0x1d, 0x94, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b, 0xed, 0x9c, 0xbb, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x18, 0xbd, 0x31, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x9c, 0xa5, 0x91, 0xbe,
+  0x16, 0xfc, 0xec, 0xbc, 0x6c, 0x3c, 0x59, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0xe4, 0x5d, 0x00, 0xbe, 0x6e, 0xfd, 0x9d, 0x3c, 0x45, 0x1c, 0x63, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0xba, 0x3d, 0x0a, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x67, 0xfd, 0x1d, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x97, 0x5c, 0xcf, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0xf1, 0xdb, 0xf6, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x3e, 0xdd, 0x27, 0xbe, 0x91, 0x1d, 0x14, 0xbe, 0x1a, 0xfc, 0xec, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x7c, 0x0d, 0x19, 0xbe, 0x16, 0xfc, 0xec, 0xbc,
+  0x67, 0xfd, 0x1d, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xea, 0x9c, 0xbb, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xcf, 0x4d, 0x05, 0xbe,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6c, 0x3c, 0x59, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x19, 0xfc, 0x6c, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x29, 0xcd, 0x2c, 0xbe,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0xea, 0x9c, 0xbb, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x65, 0xfd, 0x1d, 0xbd, 0x47, 0x1c, 0xe3, 0x3d,
+  0xc5, 0x7c, 0x45, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x12, 0xbd, 0x31, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0xde, 0xcb, 0x7b, 0x3e,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x22, 0xfc, 0xec, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x1d, 0xfc, 0x6c, 0x3e,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0xed, 0x9c, 0xbb, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x47, 0x1c, 0xe3, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x90, 0x1d, 0x94, 0xbd,
+  0x93, 0x1d, 0x94, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x1a, 0xfc, 0xec, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xf1, 0xdb, 0xf6, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x29, 0xcd, 0x2c, 0xbe, 0x44, 0x1c, 0xe3, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x91, 0x1d, 0x14, 0xbe, 0xba, 0x3d, 0x0a, 0xbe,
+  0x67, 0xfd, 0x1d, 0xbe, 0xe4, 0x5d, 0x00, 0xbe, 0x44, 0x1c, 0xe3, 0xbd,
+  0x6e, 0x3c, 0x59, 0xbe, 0x97, 0x5c, 0xcf, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x91, 0x1d, 0x14, 0xbe,
+  0xe3, 0x5d, 0x80, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x16, 0xbd, 0xb1, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xcf, 0x4d, 0x05, 0xbe,
+  0xe6, 0x5d, 0x80, 0x3d, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32, 0x72, 0x3c, 0x59, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x40, 0xdd, 0xa7, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x10, 0xfc, 0x6c, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x65, 0xfd, 0x1d, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x28, 0xfc, 0x6c, 0x3c,
+  0x47, 0x1c, 0xe3, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xe6, 0x5d, 0x80, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x80, 0xfd, 0x9d, 0x3b,
+  0x00, 0x00, 0x40, 0x32, 0xc5, 0x7c, 0x45, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x47, 0x1c, 0xe3, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0x16, 0xbd, 0xb1, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0xe5, 0x5d, 0x00, 0x3e,
+  0x70, 0x3c, 0xd9, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0x90, 0x1d, 0x94, 0xbd,
+  0x70, 0x3c, 0xd9, 0x3d, 0xed, 0x9c, 0xbb, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x3d, 0x8a, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x66, 0xfd, 0x9d, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x47, 0x1c, 0xe3, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xbd, 0xb1, 0x3d,
+  0x80, 0xfd, 0x9d, 0x3b, 0x47, 0x1c, 0xe3, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x66, 0xfd, 0x9d, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x1f, 0xfc, 0x6c, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x65, 0xfd, 0x1d, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xba, 0x3d, 0x0a, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xba, 0x3d, 0x0a, 0xbe,
+  0xba, 0x3d, 0x0a, 0xbe, 0x67, 0xfd, 0x1d, 0xbe, 0x00, 0xad, 0x36, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xac, 0x6c, 0x4a, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x98, 0x5c, 0x4f, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0xe3, 0x5d, 0x80, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x12, 0xbd, 0x31, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0x6b, 0xfd, 0x1d, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xe6, 0x5d, 0x80, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x22, 0xfc, 0xec, 0x3c, 0x90, 0x1d, 0x94, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x00, 0x00, 0x40, 0x32, 0x28, 0xfc, 0x6c, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6a, 0xfd, 0x9d, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0xbf, 0x7c, 0x45, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x00, 0xad, 0xb6, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d,
+  0xea, 0x9c, 0xbb, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x3e, 0xdd, 0x27, 0xbe,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0x22, 0xfc, 0xec, 0x3c,
+  0xbf, 0x7c, 0x45, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xc5, 0x7c, 0x45, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xd0, 0x4d, 0x05, 0x3e,
+  0x93, 0x1d, 0x94, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x47, 0x1c, 0xe3, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0xc4, 0x7c, 0xc5, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x72, 0x3c, 0x59, 0x3d, 0x93, 0x1d, 0x94, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x28, 0xfc, 0x6c, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x12, 0xbd, 0x31, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc8, 0x7c, 0xc5, 0x3c, 0xbc, 0x3d, 0x8a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x00, 0x00, 0x40, 0x32, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x9a, 0x5c, 0xcf, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x1f, 0xfc, 0x6c, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0xe4, 0x5d, 0x00, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0x52, 0xed, 0x22, 0xbe, 0xcf, 0x4d, 0x05, 0xbe, 0x19, 0xfc, 0x6c, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xac, 0x6c, 0x4a, 0xbe, 0xc5, 0xc5, 0x87, 0xbe,
+  0x1b, 0xfc, 0x6c, 0xbe, 0xa6, 0x2d, 0x0f, 0xbe, 0x45, 0x1c, 0x63, 0xbe,
+  0x45, 0x1c, 0x63, 0xbe, 0xdd, 0xcb, 0x7b, 0xbe, 0x7c, 0x0d, 0x19, 0xbe,
+  0x6e, 0x3c, 0x59, 0xbe, 0xf2, 0xdb, 0x76, 0xbe, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x3d, 0xdd, 0xa7, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d, 0x12, 0xbd, 0x31, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x91, 0x1d, 0x14, 0xbe, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xe3, 0x5d, 0x80, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x10, 0xfc, 0x6c, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x98, 0x5c, 0x4f, 0xbe,
+  0xbf, 0x7c, 0x45, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c,
+  0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x79, 0xc4, 0xd6, 0xbe,
+  0x62, 0xfd, 0x9d, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x50, 0xfd, 0x9d, 0xbb,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xe6, 0x5d, 0x80, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b,
+  0x7c, 0x0d, 0x19, 0xbe, 0x72, 0x3c, 0x59, 0x3d, 0x64, 0xb4, 0xdb, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x7c, 0x0d, 0x19, 0xbe,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x00, 0x00, 0x40, 0x32, 0x50, 0xfd, 0x9d, 0xbb,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x93, 0x1d, 0x94, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x9c, 0xa5, 0x91, 0x3e,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x72, 0x3c, 0x59, 0x3d, 0x12, 0xbd, 0x31, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xc5, 0x7c, 0x45, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xbd, 0xb1, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x93, 0x1d, 0x94, 0x3d, 0x65, 0xfd, 0x1d, 0xbd,
+  0x72, 0x3c, 0x59, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x3d, 0xdd, 0xa7, 0xbd, 0x72, 0x3c, 0x59, 0x3d,
+  0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0xbe, 0x3d, 0x0a, 0x3d, 0x19, 0xfc, 0x6c, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x00, 0x00, 0x40, 0x32,
+  0x44, 0x1c, 0xe3, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x3d, 0xdd, 0xa7, 0xbd, 0xba, 0x3d, 0x0a, 0xbe, 0x00, 0x00, 0x40, 0x32,
+  0xba, 0x3d, 0x0a, 0xbe, 0xea, 0x9c, 0xbb, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x7c, 0x0d, 0x19, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0xeb, 0x9c, 0x3b, 0xbe, 0x10, 0xfc, 0x6c, 0xbc,
+  0x6e, 0x3c, 0xd9, 0xbd, 0x14, 0xbd, 0x31, 0xbe, 0xac, 0x6c, 0x4a, 0xbe,
+  0x29, 0xcd, 0x2c, 0xbe, 0xba, 0x3d, 0x0a, 0xbe, 0x5a, 0x2c, 0x5e, 0xbe,
+  0x5a, 0x2c, 0x5e, 0xbe, 0x5a, 0x2c, 0x5e, 0xbe, 0x91, 0x1d, 0x14, 0xbe,
+  0xdd, 0xcb, 0x7b, 0xbe, 0x00, 0xad, 0x36, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xac, 0x6c, 0x4a, 0xbe,
+  0xba, 0x3d, 0x8a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x1a, 0xfc, 0xec, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x80, 0xfd, 0x9d, 0x3b, 0xe3, 0x5d, 0x80, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0xd6, 0x8c, 0x40, 0xbe, 0xea, 0x9c, 0xbb, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x97, 0x5c, 0xcf, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0x00, 0x00, 0x40, 0x32,
+  0x16, 0xfc, 0xec, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x53, 0xed, 0xa2, 0xbe,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbc, 0x3d, 0x8a, 0x3d, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0x72, 0x3c, 0x59, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0x50, 0xfd, 0x9d, 0xbb, 0xc8, 0x7c, 0xc5, 0x3c, 0x6f, 0x3c, 0xd9, 0xbe,
+  0x62, 0xfd, 0x9d, 0xbc, 0xe3, 0x5d, 0x80, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x74, 0xfd, 0x1d, 0x3c, 0x1e, 0xfc, 0xec, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x14, 0xbd, 0xb1, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0xe3, 0x5d, 0x80, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x70, 0x3c, 0xd9, 0x3d,
+  0xe5, 0x5d, 0x00, 0x3e, 0x62, 0xfd, 0x9d, 0xbc, 0x46, 0x1c, 0x63, 0x3e,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x40, 0xdd, 0xa7, 0x3d, 0xe3, 0x5d, 0x80, 0xbd, 0xd8, 0x8c, 0x40, 0x3e,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x80, 0xfd, 0x9d, 0x3b,
+  0x10, 0xfc, 0x6c, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x16, 0xfc, 0xec, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0x3f, 0xdd, 0x27, 0x3e,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x90, 0x1d, 0x94, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0xea, 0x9c, 0xbb, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x18, 0xbd, 0x31, 0x3d, 0x16, 0xfc, 0xec, 0xbc,
+  0x80, 0xfd, 0x9d, 0x3b, 0xea, 0x9c, 0xbb, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x52, 0xed, 0x22, 0xbe, 0x14, 0xbd, 0xb1, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x00, 0xad, 0x36, 0xbe, 0x3e, 0xdd, 0x27, 0xbe, 0x50, 0xfd, 0x9d, 0xbb,
+  0xc0, 0x7c, 0xc5, 0xbd, 0xa6, 0x2d, 0x0f, 0xbe, 0x83, 0x4c, 0x54, 0xbe,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x52, 0xed, 0x22, 0xbe, 0xcf, 0x4d, 0x05, 0xbe,
+  0xe4, 0x5d, 0x00, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xc0, 0x7c, 0xc5, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0xcf, 0x4d, 0x05, 0xbe, 0x65, 0xfd, 0x1d, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x52, 0xed, 0x22, 0xbe,
+  0x90, 0x1d, 0x94, 0xbd, 0x1a, 0xfc, 0xec, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xcf, 0x4d, 0x05, 0xbe, 0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x44, 0x1c, 0xe3, 0xbd, 0xea, 0x9c, 0xbb, 0xbd, 0xea, 0x9c, 0xbb, 0xbd,
+  0x00, 0x00, 0x40, 0x32, 0xbf, 0x7c, 0x45, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x19, 0xfc, 0x6c, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x90, 0x1d, 0x94, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0xc0, 0x7c, 0xc5, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x0a, 0xbe,
+  0x10, 0xfc, 0x6c, 0xbc, 0x90, 0x1d, 0x94, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd, 0xed, 0x9c, 0xbb, 0x3d,
+  0xa6, 0x2d, 0x0f, 0xbe, 0x90, 0x1d, 0x94, 0xbd, 0x97, 0x5c, 0xcf, 0xbd,
+  0x80, 0xfd, 0x9d, 0x3b, 0x97, 0x5c, 0xcf, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x44, 0x1c, 0xe3, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x72, 0x3c, 0x59, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xe4, 0x5d, 0x00, 0xbe, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xba, 0x3d, 0x8a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x18, 0xbd, 0x31, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x16, 0xfc, 0xec, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x6e, 0xfd, 0x9d, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c, 0x62, 0xfd, 0x9d, 0xbc,
+  0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd, 0xbc, 0x3d, 0x0a, 0x3e,
+  0x14, 0xbd, 0xb1, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x16, 0xbd, 0xb1, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x16, 0xfc, 0xec, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x90, 0x1d, 0x94, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xe3, 0x5d, 0x80, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0xba, 0x3d, 0x8a, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x14, 0xbd, 0xb1, 0xbd, 0x50, 0xfd, 0x9d, 0xbb, 0x74, 0xfd, 0x1d, 0x3c,
+  0x00, 0x00, 0x40, 0x32, 0x97, 0x5c, 0xcf, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xf1, 0xdb, 0xf6, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd, 0x44, 0x1c, 0xe3, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x28, 0xfc, 0x6c, 0x3c, 0x1a, 0xfc, 0xec, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c, 0xea, 0x9c, 0xbb, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0x6c, 0x3c, 0x59, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0x80, 0xfd, 0x9d, 0x3b, 0x00, 0x00, 0x40, 0x32,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x10, 0xfc, 0x6c, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xbc, 0x7c, 0xc5, 0xbc, 0xe3, 0x5d, 0x80, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x1a, 0xfc, 0xec, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xea, 0x9c, 0xbb, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x3d, 0xdd, 0xa7, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x90, 0x1d, 0x94, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x3d, 0xdd, 0xa7, 0xbd, 0x19, 0xfc, 0x6c, 0xbd,
+  0x1a, 0xfc, 0xec, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0x6e, 0x3c, 0xd9, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xa6, 0x2d, 0x0f, 0xbe, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xbf, 0x7c, 0x45, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbc, 0x7c, 0xc5, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0x3d, 0xdd, 0xa7, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x00, 0x00, 0x40, 0x32,
+  0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x6e, 0xfd, 0x9d, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x74, 0xfd, 0x1d, 0x3c, 0x62, 0xfd, 0x9d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xe3, 0x5d, 0x80, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xea, 0x9c, 0xbb, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x50, 0xfd, 0x9d, 0xbb, 0x66, 0xfd, 0x9d, 0xbd,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x72, 0x3c, 0x59, 0x3d,
+  0xba, 0x3d, 0x8a, 0xbd, 0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x50, 0xfd, 0x9d, 0xbb, 0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0xe3, 0x5d, 0x80, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0x40, 0xdd, 0xa7, 0x3d,
+  0xea, 0x9c, 0xbb, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x90, 0x1d, 0x94, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0xba, 0x3d, 0x8a, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0x74, 0xfd, 0x1d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd, 0x80, 0xfd, 0x9d, 0x3b,
+  0x16, 0xfc, 0xec, 0xbc, 0xbf, 0x7c, 0x45, 0xbd, 0x50, 0xfd, 0x9d, 0xbb,
+  0xe3, 0x5d, 0x80, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x19, 0xfc, 0x6c, 0xbd, 0xe4, 0x5d, 0x00, 0xbe,
+  0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc, 0x50, 0xfd, 0x9d, 0xbb,
+  0x80, 0xfd, 0x9d, 0x3b, 0x19, 0xfc, 0x6c, 0xbd, 0x16, 0xfc, 0xec, 0xbc,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x80, 0xfd, 0x9d, 0x3b, 0x14, 0xbd, 0xb1, 0xbd,
+  0x97, 0x5c, 0xcf, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x62, 0xfd, 0x9d, 0xbc,
+  0xba, 0x3d, 0x8a, 0xbd, 0xbf, 0x7c, 0x45, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x19, 0xfc, 0x6c, 0xbd, 0x00, 0x00, 0x40, 0x32, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x65, 0xfd, 0x1d, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x62, 0xfd, 0x9d, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xe3, 0x5d, 0x80, 0xbd, 0x22, 0xfc, 0xec, 0x3c,
+  0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0xc5, 0x7c, 0x45, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6b, 0xfd, 0x1d, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x6b, 0xfd, 0x1d, 0x3d, 0xbf, 0x7c, 0x45, 0xbd,
+  0x50, 0xfd, 0x9d, 0xbb, 0xbf, 0x7c, 0x45, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x12, 0xbd, 0x31, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0xba, 0x3d, 0x8a, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x90, 0x1d, 0x94, 0xbd, 0x10, 0xfc, 0x6c, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x16, 0xfc, 0xec, 0xbc, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0x5c, 0xfd, 0x1d, 0xbc, 0x6e, 0x3c, 0xd9, 0xbd, 0xb8, 0x3d, 0x0a, 0xbd,
+  0xba, 0x3d, 0x8a, 0xbd, 0x5c, 0xfd, 0x1d, 0xbc, 0x19, 0xfc, 0x6c, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc, 0x22, 0xfc, 0xec, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x72, 0x3c, 0x59, 0x3d, 0x6c, 0x3c, 0x59, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x00, 0x00, 0x40, 0x32, 0xe6, 0x5d, 0x80, 0x3d,
+  0xbc, 0x3d, 0x8a, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0x16, 0xfc, 0xec, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x6e, 0xfd, 0x9d, 0x3c, 0x5c, 0xfd, 0x1d, 0xbc,
+  0x28, 0xfc, 0x6c, 0x3c, 0x18, 0xbd, 0x31, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x93, 0x1d, 0x94, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0x18, 0xbd, 0x31, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x00, 0x00, 0x40, 0x32, 0xb8, 0x3d, 0x0a, 0xbd, 0x1f, 0xfc, 0x6c, 0x3d,
+  0x10, 0xfc, 0x6c, 0xbc, 0xba, 0x3d, 0x8a, 0xbd, 0x12, 0xbd, 0x31, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0x28, 0xfc, 0x6c, 0x3c, 0xc5, 0x7c, 0x45, 0x3d,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x66, 0xfd, 0x9d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0x19, 0xfc, 0x6c, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x74, 0xfd, 0x1d, 0x3c, 0x00, 0x00, 0x40, 0x32,
+  0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x14, 0xbd, 0xb1, 0xbd, 0x6e, 0xfd, 0x9d, 0x3c,
+  0x80, 0xfd, 0x9d, 0x3b, 0x62, 0xfd, 0x9d, 0xbc, 0xc0, 0x7c, 0xc5, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0xe3, 0x5d, 0x80, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbf, 0x7c, 0x45, 0xbd, 0x65, 0xfd, 0x1d, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x6c, 0x3c, 0x59, 0xbd, 0x66, 0xfd, 0x9d, 0xbd,
+  0x66, 0xfd, 0x9d, 0xbd, 0x66, 0xfd, 0x9d, 0xbd, 0xbf, 0x7c, 0x45, 0xbd,
+  0x10, 0xfc, 0x6c, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xb8, 0x3d, 0x0a, 0xbd, 0x12, 0xbd, 0x31, 0xbd, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x62, 0xfd, 0x9d, 0xbc, 0x14, 0xbd, 0xb1, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x00, 0x00, 0x40, 0x32, 0xc1, 0x7c, 0x45, 0xbe,
+  0x00, 0x00, 0x40, 0x32, 0x74, 0xfd, 0x1d, 0x3c, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x16, 0xfc, 0xec, 0xbc, 0xbc, 0x7c, 0xc5, 0xbc, 0x12, 0xbd, 0x31, 0xbd,
+  0xbf, 0x7c, 0x45, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x91, 0x1d, 0x14, 0xbe,
+  0x14, 0xbd, 0xb1, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0xa6, 0x2d, 0x0f, 0xbe,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x1f, 0xfc, 0x6c, 0x3d, 0x50, 0xfd, 0x9d, 0xbb,
+  0x80, 0xfd, 0x9d, 0x3b, 0x10, 0xfc, 0x6c, 0xbc, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x62, 0xfd, 0x9d, 0xbc, 0x22, 0xfc, 0xec, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x74, 0xfd, 0x1d, 0x3c, 0x6e, 0x3c, 0xd9, 0xbd,
+  0x74, 0xfd, 0x1d, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x16, 0xfc, 0xec, 0xbc,
+  0x16, 0xbd, 0xb1, 0x3d, 0x1f, 0xfc, 0x6c, 0x3d, 0x14, 0xbd, 0xb1, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0xc8, 0x7c, 0xc5, 0x3c, 0xc8, 0x7c, 0xc5, 0x3c,
+  0xbc, 0x3d, 0x8a, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd, 0x65, 0xfd, 0x1d, 0xbd,
+  0x28, 0xfc, 0x6c, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0xea, 0x9c, 0xbb, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x00, 0x00, 0x40, 0x32, 0x62, 0xfd, 0x9d, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x19, 0xfc, 0x6c, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x6c, 0x3c, 0x59, 0xbd,
+  0x14, 0xbd, 0xb1, 0xbd, 0x6e, 0x3c, 0xd9, 0xbd, 0x14, 0xbd, 0xb1, 0xbd,
+  0xf1, 0xdb, 0xf6, 0xbd, 0x16, 0xfc, 0xec, 0xbc, 0x16, 0xfc, 0xec, 0xbc,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0xe6, 0x5d, 0x80, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x62, 0xfd, 0x9d, 0xbc, 0x1f, 0xfc, 0x6c, 0x3d, 0xb8, 0x3d, 0x0a, 0xbd,
+  0x22, 0xfc, 0xec, 0x3c, 0xc5, 0x7c, 0x45, 0x3d, 0x80, 0xfd, 0x9d, 0x3b,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x72, 0x3c, 0x59, 0x3d, 0x1e, 0xfc, 0xec, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0x18, 0xbd, 0x31, 0x3d,
+  0x47, 0x1c, 0xe3, 0x3d, 0x7e, 0x0d, 0x19, 0x3e, 0x5c, 0xfd, 0x1d, 0xbc,
+  0xc5, 0x7c, 0x45, 0x3d, 0x9a, 0x5c, 0xcf, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d, 0x22, 0xfc, 0xec, 0x3c,
+  0xc4, 0x7c, 0xc5, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0x00, 0x00, 0x40, 0x32,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x18, 0xbd, 0x31, 0x3d,
+  0x6a, 0xfd, 0x9d, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x65, 0xfd, 0x1d, 0xbd,
+  0x93, 0x1d, 0x94, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x1e, 0xfc, 0xec, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0xed, 0x9c, 0xbb, 0x3d,
+  0x16, 0xbd, 0xb1, 0x3d, 0x6a, 0xfd, 0x9d, 0x3d, 0x16, 0xbd, 0xb1, 0x3d,
+  0x16, 0xfc, 0xec, 0xbc, 0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x00, 0x00, 0x40, 0x32, 0xbe, 0x3d, 0x0a, 0x3d, 0x47, 0x1c, 0xe3, 0x3d,
+  0x93, 0x1d, 0x94, 0x3d, 0x50, 0xfd, 0x9d, 0xbb, 0xbe, 0x3d, 0x0a, 0x3d,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x80, 0xfd, 0x9d, 0x3b, 0x28, 0xfc, 0x6c, 0x3c,
+  0x6e, 0xfd, 0x9d, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0x62, 0xfd, 0x9d, 0xbc,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d, 0xbc, 0x3d, 0x8a, 0x3d,
+  0x70, 0x3c, 0xd9, 0x3d, 0x80, 0xfd, 0x9d, 0x3b, 0x80, 0xfd, 0x9d, 0x3b,
+  0xc5, 0x7c, 0x45, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xbc, 0x7c, 0xc5, 0xbc,
+  0x6a, 0xfd, 0x9d, 0x3d, 0xe6, 0x5d, 0x80, 0x3d, 0xe3, 0x5d, 0x80, 0xbd,
+  0x1e, 0xfc, 0xec, 0x3d, 0x40, 0xdd, 0xa7, 0x3d, 0xed, 0x9c, 0xbb, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0xc5, 0x7c, 0x45, 0x3d, 0xbe, 0x3d, 0x0a, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x50, 0xfd, 0x9d, 0xbb, 0xe6, 0x5d, 0x80, 0x3d,
+  0x1f, 0xfc, 0x6c, 0x3d, 0x72, 0x3c, 0x59, 0x3d, 0xc0, 0x7c, 0xc5, 0xbd,
+  0xc8, 0x7c, 0xc5, 0x3c, 0x6a, 0xfd, 0x9d, 0x3d, 0x6b, 0xfd, 0x1d, 0x3d,
+  0x28, 0xfc, 0x6c, 0x3c, 0x74, 0xfd, 0x1d, 0x3c, 0x74, 0xfd, 0x1d, 0x3c,
+  0x40, 0xdd, 0xa7, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x40, 0xdd, 0xa7, 0x3d,
+  0x6b, 0xfd, 0x1d, 0x3d, 0x16, 0xfc, 0xec, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x5c, 0xfd, 0x1d, 0xbc, 0xc5, 0x7c, 0x45, 0x3d, 0xbc, 0x3d, 0x0a, 0x3e,
+  0xe6, 0x5d, 0x80, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d, 0xf4, 0xdb, 0xf6, 0x3d,
+  0xbe, 0x3d, 0x0a, 0x3d, 0x93, 0x1d, 0x94, 0x3d, 0xc5, 0x7c, 0x45, 0x3d,
+  0x9a, 0x5c, 0xcf, 0x3d, 0x18, 0xbd, 0x31, 0x3d, 0x74, 0xfd, 0x1d, 0x3c,
+  0x22, 0xfc, 0xec, 0x3c, 0x22, 0xfc, 0xec, 0x3c, 0x70, 0x3c, 0xd9, 0x3d,
+  0xe6, 0x5d, 0x80, 0x3d, 0x22, 0xfc, 0xec, 0x3c, 0xe6, 0x5d, 0x80, 0x3d,
+  0xed, 0x9c, 0xbb, 0x3d, 0x5c, 0xfd, 0x1d, 0xbc, 0x00, 0x00, 0x40, 0x32,
+  0x6b, 0xfd, 0x1d, 0x3d, 0xc8, 0x7c, 0xc5, 0x3c, 0x18, 0xbd, 0x31, 0x3d,
+  0xbf, 0x7c, 0x45, 0xbd, 0x6c, 0x3c, 0x59, 0xbd, 0x62, 0xfd, 0x9d, 0xbc,
+  0x12, 0xbd, 0x31, 0xbd, 0x10, 0xfc, 0x6c, 0xbc, 0x6c, 0x3c, 0x59, 0xbd,
+  0x6c, 0x3c, 0x59, 0xbd, 0x22, 0xfc, 0xec, 0x3c, 0x19, 0xfc, 0x6c, 0xbd,
+  0xbc, 0x7c, 0xc5, 0xbc, 0x16, 0xfc, 0xec, 0xbc, 0xc8, 0x7c, 0xc5, 0x3c,
+  0x00, 0x00, 0x00, 0x00, 0xa6, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xec, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc6, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x8f, 0xaf, 0x44, 0x3d, 0x8c, 0x97, 0xb6, 0xbb, 0x91, 0x43, 0x9a, 0xbb,
+  0xbf, 0x79, 0x19, 0xbc, 0x36, 0x04, 0x2d, 0x3d, 0xf5, 0x56, 0xae, 0xbb,
+  0x6c, 0x6d, 0x05, 0xbb, 0xaa, 0xfd, 0xad, 0xbb, 0x77, 0x2b, 0x89, 0x3d,
+  0x45, 0x44, 0x01, 0xbc, 0xde, 0x94, 0x41, 0x3c, 0x44, 0x1f, 0x6a, 0x3e,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0xc1, 0x92, 0x0d, 0xbc, 0xcd, 0xca, 0x82, 0x3d,
+  0xea, 0xff, 0x93, 0xbc, 0xa6, 0xfd, 0x25, 0xbd, 0x64, 0xcd, 0xd2, 0x3b,
+  0x69, 0x50, 0xa3, 0x3d, 0x86, 0x36, 0xc8, 0xbc, 0x3b, 0x0c, 0x21, 0x3d,
+  0x0d, 0xd7, 0x9c, 0xbd, 0x72, 0x92, 0xb0, 0xbc, 0x00, 0x00, 0x00, 0x00,
+  0xfc, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xf4, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74,
+  0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00,
+  0x1c, 0x03, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00,
+  0xa8, 0x02, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00,
+  0xf8, 0x01, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0x5c, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00,
+  0xe0, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xd6, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x06, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd6, 0xfd, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0xf6, 0xfd, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0xea, 0xfd, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xae, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08,
+  0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x50, 0xf5, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66, 0xfe, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xa2, 0xfe, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x1a, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x07, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x3a, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x06, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xde, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
+  0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x68, 0x08, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00,
+  0xdc, 0x07, 0x00, 0x00, 0xa0, 0x07, 0x00, 0x00, 0x54, 0x07, 0x00, 0x00,
+  0x10, 0x07, 0x00, 0x00, 0x50, 0x06, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00,
+  0x4c, 0x05, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x00, 0x3c, 0x04, 0x00, 0x00,
+  0xac, 0x03, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00,
+  0xac, 0x02, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00,
+  0xc0, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+  0x5c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0xf8, 0xff, 0xff,
+  0x44, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0xe8, 0xf7, 0xff, 0xff,
+  0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c,
+  0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43,
+  0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x58, 0xf8, 0xff, 0xff,
+  0x38, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x3c, 0xf8, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x64, 0x65, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x33, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0xf8, 0xff, 0xff,
+  0x68, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x84, 0xf8, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0x00, 0x3b, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x5f, 0x64,
+  0x65, 0x6e, 0x73, 0x65, 0x2f, 0x70, 0x72, 0x65, 0x5f, 0x61, 0x63, 0x74,
+  0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6d, 0x69, 0x6e, 0x3b,
+  0x71, 0x75, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f,
+  0x70, 0x72, 0x65, 0x5f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x5f, 0x6d, 0x61, 0x78, 0x31, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x18, 0xfb, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00,
+  0xfc, 0xfa, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x88, 0xc4, 0x53, 0x3d, 0x3e, 0x00, 0x00, 0x00,
+  0x3b, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x65, 0x6e, 0x73, 0x65,
+  0x2f, 0x70, 0x72, 0x65, 0x5f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x5f, 0x6d, 0x69, 0x6e, 0x3b, 0x71, 0x75, 0x61, 0x6e,
+  0x74, 0x5f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x70, 0x72, 0x65, 0x5f,
+  0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6d,
+  0x61, 0x78, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0xb0, 0xf9, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x0a, 0x00, 0x00, 0x00, 0x94, 0xf9, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00,
+  0x74, 0x66, 0x6c, 0x2e, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0x5f, 0x63, 0x6f,
+  0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xdc, 0xf9, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x74, 0x66, 0x6c, 0x2e, 0x64, 0x65, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69,
+  0x7a, 0x65, 0x32, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x14, 0xfc, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x68, 0xfd, 0x9d, 0x3b, 0x0c, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
+  0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0xfa, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xec, 0x07, 0x00, 0x00,
+  0x74, 0xfa, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e,
+  0x72, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xec, 0x07, 0x00, 0x00, 0xd4, 0xfa, 0xff, 0xff,
+  0x40, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0xc0, 0xfa, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+  0x74, 0x66, 0x6c, 0x2e, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c,
+  0x5f, 0x32, 0x64, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x2c, 0xfb, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0xfb, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x64, 0x65, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x84, 0xfb, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x70, 0xfb, 0xff, 0xff, 0x43, 0x00, 0x00, 0x00, 0x3b, 0x71, 0x75, 0x61,
+  0x6e, 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x70, 0x6f,
+  0x73, 0x74, 0x5f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x5f, 0x6d, 0x69, 0x6e, 0x3b, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x5f,
+  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x5f,
+  0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6d,
+  0x61, 0x78, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x10, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x94, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0xfc, 0xfd, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa6, 0x97, 0x37, 0x3d,
+  0x42, 0x00, 0x00, 0x00, 0x3b, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x5f, 0x63,
+  0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x5f, 0x61,
+  0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6d, 0x69,
+  0x6e, 0x3b, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x76,
+  0x32, 0x64, 0x2f, 0x70, 0x6f, 0x73, 0x74, 0x5f, 0x61, 0x63, 0x74, 0x69,
+  0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x6d, 0x61, 0x78, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0xff,
+  0x40, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0xac, 0xfc, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00,
+  0x3b, 0x3b, 0x3b, 0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x62, 0x69,
+  0x61, 0x73, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x18, 0xfd, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xff, 0xff,
+  0x0e, 0x00, 0x00, 0x00, 0x74, 0x66, 0x6c, 0x2e, 0x64, 0x65, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0xfd, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x5c, 0xfd, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00, 0x3b, 0x71, 0x75, 0x61,
+  0x6e, 0x74, 0x69, 0x7a, 0x65, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2f,
+  0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x5f, 0x6c, 0x61, 0x79,
+  0x65, 0x72, 0x5f, 0x6d, 0x69, 0x6e, 0x3b, 0x71, 0x75, 0x61, 0x6e, 0x74,
+  0x69, 0x7a, 0x65, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2f, 0x71, 0x75,
+  0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72,
+  0x5f, 0x6d, 0x61, 0x78, 0x31, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x08, 0x00, 0x07, 0x00,
+  0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xa0, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b, 0x44, 0x00, 0x00, 0x00,
+  0x3b, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x5f, 0x6c, 0x61,
+  0x79, 0x65, 0x72, 0x2f, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65,
+  0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x5f, 0x6d, 0x69, 0x6e, 0x3b, 0x71,
+  0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x5f, 0x6c, 0x61, 0x79, 0x65,
+  0x72, 0x2f, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x5f, 0x6c,
+  0x61, 0x79, 0x65, 0x72, 0x5f, 0x6d, 0x61, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff,
+  0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xa4, 0xfe, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00,
+  0x73, 0x74, 0x64, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+  0x32, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x4e, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe4, 0xfe, 0xff, 0xff,
+  0x0d, 0x00, 0x00, 0x00, 0x73, 0x74, 0x64, 0x2e, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x61, 0x6e, 0x74, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0xec, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x73, 0x74, 0x64, 0x2e,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff,
+  0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00,
+  0x63, 0x6f, 0x6e, 0x76, 0x32, 0x64, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0xff,
+  0x0a, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x2f, 0x62, 0x69,
+  0x61, 0x73, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x18, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
+  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x5f, 0x31, 0x3a, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xa4, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x19, 0x19, 0x00, 0x00, 0x00,
+  0xd8, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x16,
+  0x16, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x11,
+  0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x72, 0x72, 0x00, 0x00, 0x00
+};
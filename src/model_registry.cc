@@ -0,0 +1,56 @@
+#include <cstddef>
+#include <cstring>
+
+#include "model.h"
+#include "model_registry.h"
+
+namespace {
+  // The model sizes live in other translation units, so this table is
+  // initialized at start-up rather than at compile time.
+  const model_entry_t models[] = {
+#ifdef MODEL_REGISTRY_HAS_QUANT
+    { "quant",    g_model,          g_model_len,          MODEL_QUANT_ARENA_SIZE },
+#endif
+#ifdef MODEL_REGISTRY_HAS_NO_QUANT
+    { "no_quant", g_model_no_quant, g_model_no_quant_len, MODEL_NO_QUANT_ARENA_SIZE },
+#endif
+#ifdef MODEL_REGISTRY_HAS_Q_AWARE
+    { "q_aware",  g_model_q_aware,  g_model_q_aware_len,  MODEL_Q_AWARE_ARENA_SIZE },
+#endif
+  };
+
+  constexpr size_t kModelCount = sizeof(models) / sizeof(models[0]);
+}  // namespace
+
+size_t model_registry_count(void)
+{
+  return kModelCount;
+}
+
+const model_entry_t* model_registry_get(size_t index)
+{
+  return (index < kModelCount) ? &models[index] : nullptr;
+}
+
+const model_entry_t* model_registry_find(const char* name)
+{
+  for (size_t i = 0; i < kModelCount; i++)
+  {
+    if (strcmp(models[i].name, name) == 0)
+    {
+      return &models[i];
+    }
+  }
+  return nullptr;
+}
+
+const model_entry_t* model_registry_default(void)
+{
+#if defined(CONFIG_MODEL_NO_QUANT)
+  return model_registry_find("no_quant");
+#elif defined(CONFIG_MODEL_Q_AWARE)
+  return model_registry_find("q_aware");
+#else
+  return model_registry_find("quant");
+#endif
+}
@@ -0,0 +1,307 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "esp_err.h"
+#include "esp_http_client.h"
+#include "esp_log.h"
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "flatbuffers/flatbuffers.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#include "model_source.h"
+
+static const char *TAG = "Model_Source";
+
+namespace {
+  constexpr char kPartitionScheme[] = "partition:";
+  constexpr char kHttpScheme[] = "http://";
+  constexpr int kHttpTimeoutMs = 10000;
+
+  bool has_prefix(const char* uri, const char* prefix)
+  {
+    return strncmp(uri, prefix, strlen(prefix)) == 0;
+  }
+
+  // The file name of a path or URL, without its directory, query or
+  // extension.
+  void set_name(model_source_t* source, const char* uri)
+  {
+    const char* start = strrchr(uri, '/');
+    start = (start != nullptr) ? start + 1 : uri;
+    size_t length = strcspn(start, ".?");
+    if (length >= sizeof(source->name))
+    {
+      length = sizeof(source->name) - 1;
+    }
+    memcpy(source->name, start, length);
+    source->name[length] = '\0';
+  }
+
+  // Regions the flatbuffers are loaded into, aligned like the linked models.
+  void* alloc_region(size_t size)
+  {
+    size = (size + MODEL_SOURCE_ALIGNMENT - 1) / MODEL_SOURCE_ALIGNMENT * MODEL_SOURCE_ALIGNMENT;
+#ifdef ESP_PLATFORM
+    // The external RAM, when there is some, is the only place a model fits
+    // next to the tensor arena.
+    return heap_caps_aligned_alloc(MODEL_SOURCE_ALIGNMENT, size, MALLOC_CAP_8BIT);
+#else
+    return aligned_alloc(MODEL_SOURCE_ALIGNMENT, size);
+#endif
+  }
+
+  void free_region(void* region)
+  {
+#ifdef ESP_PLATFORM
+    heap_caps_free(region);
+#else
+    free(region);
+#endif
+  }
+
+  // The only parsing of the flatbuffer: every offset the interpreter follows
+  // is checked to stay within the size bytes, so that GetModel() can trust
+  // it afterwards. The schema version is checked with the linked models', by
+  // app_tflite_init_model().
+  esp_err_t verify_model(const uint8_t* data, size_t size)
+  {
+    if (reinterpret_cast<uintptr_t>(data) % MODEL_SOURCE_ALIGNMENT != 0)
+    {
+      ESP_LOGE(TAG, "The model is not aligned on %d bytes.", MODEL_SOURCE_ALIGNMENT);
+      return ESP_ERR_INVALID_ARG;
+    }
+    flatbuffers::Verifier verifier(data, size);
+    if (!tflite::VerifyModelBuffer(verifier))
+    {
+      ESP_LOGE(TAG, "The model is not a valid TFLite flatbuffer.");
+      return ESP_ERR_INVALID_RESPONSE;
+    }
+    return ESP_OK;
+  }
+
+  esp_err_t open_partition(const char* label, model_source_t* source)
+  {
+#ifdef ESP_PLATFORM
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (partition == nullptr)
+    {
+      ESP_LOGE(TAG, "No data partition %s.", label);
+      return ESP_ERR_NOT_FOUND;
+    }
+    // Read through the flash cache like the linked models, nothing is
+    // copied. The flatbuffer does not record its size, the partition bounds
+    // it.
+    const void* data = nullptr;
+    spi_flash_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &data, &handle);
+    if (err != ESP_OK)
+    {
+      ESP_LOGE(TAG, "Cannot map partition %s: %s", label, esp_err_to_name(err));
+      return err;
+    }
+    source->mmap_handle = handle;
+    source->region = const_cast<void*>(data);
+    source->region_size = partition->size;
+    return ESP_OK;
+#else
+    (void) label;
+    (void) source;
+    ESP_LOGE(TAG, "There are no flash partitions on this platform.");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+  }
+
+  esp_err_t open_file(const char* path, size_t max_size, model_source_t* source)
+  {
+#ifdef ESP_PLATFORM
+    // The VFS files cannot be mapped, the model is read into RAM.
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+      ESP_LOGE(TAG, "Cannot open %s.", path);
+      return ESP_ERR_NOT_FOUND;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size <= 0 || static_cast<size_t>(size) > max_size)
+    {
+      ESP_LOGE(TAG, "%s is %ld bytes, at most %u can be loaded.", path, size, (unsigned) max_size);
+      fclose(file);
+      return ESP_ERR_INVALID_SIZE;
+    }
+    source->region = alloc_region(size);
+    if (source->region == nullptr)
+    {
+      fclose(file);
+      return ESP_ERR_NO_MEM;
+    }
+    source->region_size = size;
+    size_t read = fread(source->region, 1, size, file);
+    fclose(file);
+    return (read == static_cast<size_t>(size)) ? ESP_OK : ESP_FAIL;
+#else
+    // Mapped read-only: the pages are shared with the page cache, and with
+    // every other process running the same model. Nothing is loaded into
+    // RAM, so max_size does not bound it.
+    (void) max_size;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+      ESP_LOGE(TAG, "Cannot open %s.", path);
+      return ESP_ERR_NOT_FOUND;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size <= 0)
+    {
+      close(fd);
+      return ESP_ERR_INVALID_SIZE;
+    }
+    void* data = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+      ESP_LOGE(TAG, "Cannot map %s.", path);
+      return ESP_FAIL;
+    }
+    source->region = data;
+    source->region_size = status.st_size;
+    return ESP_OK;
+#endif
+  }
+
+  // The body is read straight into the region, without another buffer. The
+  // region is sized from Content-Length, or to max_size for a chunked body.
+  esp_err_t open_http(const char* url, size_t max_size, model_source_t* source)
+  {
+    esp_http_client_config_t config = {};
+    config.url = url;
+    config.method = HTTP_METHOD_GET;
+    config.timeout_ms = kHttpTimeoutMs;
+    esp_http_client_handle_t client = esp_http_client_init(&config);
+    if (client == nullptr)
+    {
+      return ESP_FAIL;
+    }
+    esp_err_t err = esp_http_client_open(client, 0);
+    if (err != ESP_OK)
+    {
+      ESP_LOGE(TAG, "Cannot connect to %s: %s", url, esp_err_to_name(err));
+      esp_http_client_cleanup(client);
+      return err;
+    }
+
+    int content_length = esp_http_client_fetch_headers(client);
+    int status_code = esp_http_client_get_status_code(client);
+    size_t capacity = (content_length > 0) ? static_cast<size_t>(content_length) : max_size;
+    if (status_code != 200)
+    {
+      ESP_LOGE(TAG, "GET %s returned HTTP %d.", url, status_code);
+      err = ESP_ERR_NOT_FOUND;
+    } else if (capacity > max_size) {
+      ESP_LOGE(TAG, "%s is %d bytes, at most %u can be loaded.", url, content_length, (unsigned) max_size);
+      err = ESP_ERR_INVALID_SIZE;
+    } else if ((source->region = alloc_region(capacity)) == nullptr) {
+      err = ESP_ERR_NO_MEM;
+    }
+
+    size_t received = 0;
+    while (err == ESP_OK)
+    {
+      // One more byte than the region holds tells a body that is too long.
+      char overflow;
+      bool full = (received == capacity);
+      char* destination = full ? &overflow : static_cast<char*>(source->region) + received;
+      int read_len = esp_http_client_read_response(client, destination, full ? 1 : capacity - received);
+      if (read_len < 0)
+      {
+        ESP_LOGE(TAG, "GET %s failed after %u bytes.", url, (unsigned) received);
+        err = ESP_FAIL;
+      } else if (read_len == 0) {
+        break;
+      } else if (full) {
+        ESP_LOGE(TAG, "%s is more than %u bytes.", url, (unsigned) capacity);
+        err = ESP_ERR_INVALID_SIZE;
+      }
+      received += full ? 0 : read_len;
+    }
+    esp_http_client_cleanup(client);
+    source->region_size = received;
+    return err;
+  }
+}  // namespace
+
+esp_err_t model_source_open(const char* uri, size_t max_size, model_source_t* source)
+{
+  memset(source, 0, sizeof(*source));
+  esp_err_t err;
+  if (has_prefix(uri, kPartitionScheme))
+  {
+    const char* label = uri + strlen(kPartitionScheme);
+    source->kind = MODEL_SOURCE_PARTITION;
+    snprintf(source->name, sizeof(source->name), "%s", label);
+    err = open_partition(label, source);
+  } else if (has_prefix(uri, kHttpScheme)) {
+    source->kind = MODEL_SOURCE_HTTP;
+    set_name(source, uri);
+    err = open_http(uri, max_size, source);
+  } else {
+    source->kind = MODEL_SOURCE_FILE;
+    set_name(source, uri);
+    err = open_file(uri, max_size, source);
+  }
+  if (err == ESP_OK)
+  {
+    err = verify_model(static_cast<const uint8_t*>(source->region), source->region_size);
+  }
+  if (err != ESP_OK)
+  {
+    model_source_close(source);
+    return err;
+  }
+
+  source->entry.name = source->name;
+  source->entry.data = static_cast<const unsigned char*>(source->region);
+  source->entry.size = source->region_size;
+  source->entry.arena_size = 0;
+  ESP_LOGI(TAG, "Model %s: %u bytes from %s", source->name, (unsigned) source->region_size, uri);
+  return ESP_OK;
+}
+
+void model_source_close(model_source_t* source)
+{
+  if (source->region != nullptr)
+  {
+    switch (source->kind)
+    {
+      case MODEL_SOURCE_PARTITION:
+#ifdef ESP_PLATFORM
+        spi_flash_munmap(source->mmap_handle);
+#endif
+        break;
+      case MODEL_SOURCE_FILE:
+#ifdef ESP_PLATFORM
+        free_region(source->region);
+#else
+        munmap(source->region, source->region_size);
+#endif
+        break;
+      case MODEL_SOURCE_HTTP:
+        free_region(source->region);
+        break;
+    }
+  }
+  source->region = nullptr;
+  source->region_size = 0;
+  source->entry.data = nullptr;
+}
@@ -0,0 +1,197 @@
+#include <cstdio>
+#include <cstring>
+
+#include "esp_log.h"
+
+#include "tensorflow/lite/micro/micro_time.h"
+
+#include "op_profiler.h"
+
+namespace {
+  static const char *TAG = "OpProfiler";
+
+  // Handle of the events that are not recorded.
+  constexpr uint32_t kNoNode = OP_PROFILER_MAX_NODES;
+
+  uint32_t histogram_bucket(uint32_t duration_us)
+  {
+    uint32_t bucket = (duration_us == 0) ? 0 : 32 - __builtin_clz(duration_us);
+    return (bucket < OP_PROFILER_HISTOGRAM_BUCKETS) ? bucket : OP_PROFILER_HISTOGRAM_BUCKETS - 1;
+  }
+
+  void merge_profile(op_profile_t* into, const op_profile_t* profile)
+  {
+    if (profile->count == 0)
+    {
+      return;
+    }
+    if (into->count == 0 || profile->min_us < into->min_us)
+    {
+      into->min_us = profile->min_us;
+    }
+    if (profile->max_us > into->max_us)
+    {
+      into->max_us = profile->max_us;
+    }
+    into->count += profile->count;
+    into->total_us += profile->total_us;
+    for (int i = 0; i < OP_PROFILER_HISTOGRAM_BUCKETS; i++)
+    {
+      into->histogram[i] += profile->histogram[i];
+    }
+  }
+
+  // Sorts the indexes of the profiles by decreasing total time.
+  void sort_by_total(const op_profile_t* profiles, size_t count, uint8_t* order)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      size_t k = i;
+      for (; k > 0 && profiles[order[k - 1]].total_us < profiles[i].total_us; k--)
+      {
+        order[k] = order[k - 1];
+      }
+      order[k] = i;
+    }
+  }
+
+  void print_profile_json(const char* key, int node, const op_profile_t* profile,
+                          uint64_t total_us, bool last)
+  {
+    printf("{\"%s\":", key);
+    if (node >= 0)
+    {
+      printf("%d,\"op\":", node);
+    }
+    printf("\"%s\",\"count\":%u,\"min_us\":%u,\"mean_us\":%u,\"max_us\":%u,\"total_us\":%llu,\"share\":%.3f,\"hist\":[",
+           profile->tag ? profile->tag : "", (unsigned) profile->count, (unsigned) profile->min_us,
+           (unsigned) (profile->count > 0 ? profile->total_us / profile->count : 0), (unsigned) profile->max_us,
+           (unsigned long long) profile->total_us, total_us > 0 ? (double) profile->total_us / total_us : 0.0);
+    // Trailing empty buckets are left out.
+    int used = OP_PROFILER_HISTOGRAM_BUCKETS;
+    while (used > 0 && profile->histogram[used - 1] == 0)
+    {
+      used--;
+    }
+    for (int i = 0; i < used; i++)
+    {
+      printf(i > 0 ? ",%u" : "%u", (unsigned) profile->histogram[i]);
+    }
+    printf(last ? "]}" : "]},");
+  }
+}  // namespace
+
+void OpProfiler::Reset(size_t node_count)
+{
+  if (node_count > OP_PROFILER_MAX_NODES)
+  {
+    ESP_LOGW(TAG, "Only the first %d of the %u nodes are profiled.", OP_PROFILER_MAX_NODES, (unsigned) node_count);
+  }
+  ticks_per_second_ = tflite::ticks_per_second();
+  if (ticks_per_second_ <= 0)
+  {
+    ESP_LOGW(TAG, "No timer for this platform, every duration will be 0.");
+  }
+  memset(nodes_, 0, sizeof(nodes_));
+  model_node_count_ = node_count;
+  node_count_ = (node_count < OP_PROFILER_MAX_NODES) ? node_count : OP_PROFILER_MAX_NODES;
+  next_node_ = 0;
+}
+
+uint32_t OpProfiler::BeginEvent(const char* tag)
+{
+  if (model_node_count_ == 0)
+  {
+    return kNoNode;
+  }
+  uint32_t handle = next_node_;
+  next_node_ = (next_node_ + 1 < model_node_count_) ? next_node_ + 1 : 0;
+  if (handle >= node_count_)
+  {
+    return kNoNode;
+  }
+  nodes_[handle].tag = tag;
+  start_ticks_ = tflite::GetCurrentTimeTicks();
+  return handle;
+}
+
+void OpProfiler::EndEvent(uint32_t event_handle)
+{
+  if (event_handle >= node_count_)
+  {
+    return;
+  }
+  // The unsigned difference stays right when the tick count wraps.
+  uint32_t ticks = static_cast<uint32_t>(tflite::GetCurrentTimeTicks()) - static_cast<uint32_t>(start_ticks_);
+  uint32_t duration_us = (ticks_per_second_ > 0)
+      ? static_cast<uint32_t>(static_cast<uint64_t>(ticks) * 1000000 / ticks_per_second_) : 0;
+
+  op_profile_t* profile = &nodes_[event_handle];
+  if (profile->count == 0 || duration_us < profile->min_us)
+  {
+    profile->min_us = duration_us;
+  }
+  if (duration_us > profile->max_us)
+  {
+    profile->max_us = duration_us;
+  }
+  profile->count++;
+  profile->total_us += duration_us;
+  profile->histogram[histogram_bucket(duration_us)]++;
+}
+
+uint32_t OpProfiler::invoke_count() const
+{
+  // Every node runs once per invoke.
+  return (node_count_ > 0) ? nodes_[0].count : 0;
+}
+
+const op_profile_t* OpProfiler::node(size_t index) const
+{
+  return (index < node_count_) ? &nodes_[index] : nullptr;
+}
+
+void OpProfiler::PrintJson(const char* model_name) const
+{
+  // Nodes of the same operator type are merged by name.
+  op_profile_t types[OP_PROFILER_MAX_NODES];
+  size_t type_count = 0;
+  uint64_t total_us = 0;
+  memset(types, 0, sizeof(types));
+  for (size_t i = 0; i < node_count_; i++)
+  {
+    const op_profile_t* profile = &nodes_[i];
+    if (profile->tag == nullptr)
+    {
+      continue;
+    }
+    size_t t = 0;
+    while (t < type_count && strcmp(types[t].tag, profile->tag) != 0)
+    {
+      t++;
+    }
+    if (t == type_count)
+    {
+      types[type_count++].tag = profile->tag;
+    }
+    merge_profile(&types[t], profile);
+    total_us += profile->total_us;
+  }
+
+  uint8_t order[OP_PROFILER_MAX_NODES];
+  printf("{\"profile\":\"ops\",\"model\":\"%s\",\"invokes\":%u,\"total_us\":%llu,\"op_types\":[",
+         model_name ? model_name : "", (unsigned) invoke_count(), (unsigned long long) total_us);
+  sort_by_total(types, type_count, order);
+  for (size_t i = 0; i < type_count; i++)
+  {
+    print_profile_json("op", -1, &types[order[i]], total_us, i == type_count - 1);
+  }
+  printf("],\"nodes\":[");
+  sort_by_total(nodes_, node_count_, order);
+  for (size_t i = 0; i < node_count_; i++)
+  {
+    print_profile_json("node", order[i], &nodes_[order[i]], total_us, i == node_count_ - 1);
+  }
+  printf("]}\n");
+  fflush(stdout);
+}